@@ -12,6 +12,7 @@
 
 #include <unordered_map>
 #include <filesystem>
+#include <future>
 #include <any>
 
 namespace YAML
@@ -442,6 +443,27 @@ public:
     static AnyMap fromYamlFile(const string& name,
                                const string& parent_name="");
 
+    //! Get a shared, read-only handle to the AnyMap created from a YAML file.
+    /*!
+     *  Files are located as for fromYamlFile(), which returns a copy of the
+     *  same map. Parsed files are cached, and repeated calls for an unmodified
+     *  file return the same object without copying it. Different files may be
+     *  parsed concurrently by multiple threads, while threads requesting a file
+     *  that is already being parsed wait for that parse to complete.
+     *
+     *  The shared map must not be modified. Because the implicit type
+     *  conversions done by AnyValue::as() modify the stored value, data which
+     *  may require conversion, such as the definitions of individual species or
+     *  reactions, should be read from a copy of the relevant node when the
+     *  shared map may be in use by other threads.
+     *
+     *  @since New in %Cantera 3.2.
+     *  @warning This method is an experimental part of the %Cantera API and may
+     *      be changed or removed without notice.
+     */
+    static shared_ptr<const AnyMap> sharedYamlFile(const string& name,
+                                                   const string& parent_name="");
+
     //! Create an AnyMap from a string containing a YAML document
     static AnyMap fromYamlString(const string& yaml);
 
@@ -717,9 +739,11 @@ private:
 
     //! Cache for previously-parsed input (YAML) files. The key is the full path
     //! to the file, and the second element of the value is the last-modified
-    //! time for the file, which is used to enable change detection.
+    //! time for the file, which is used to enable change detection. The first
+    //! element is made ready by the thread which parses the file.
     static std::unordered_map<string,
-                              pair<AnyMap, std::filesystem::file_time_type>> s_cache;
+        pair<std::shared_future<shared_ptr<const AnyMap>>,
+             std::filesystem::file_time_type>> s_cache;
 
     //! Information about fields that should appear first when outputting to
     //! YAML. Keys in this map are matched to `__type__` keys in AnyMap
@@ -0,0 +1,71 @@
+//! @file BinaryMechanism.h Declarations for reading and writing precompiled,
+//!     binary mechanism files.
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_BINARYMECHANISM_H
+#define CT_BINARYMECHANISM_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class Solution;
+
+//! @addtogroup serializeGroup
+//! @{
+
+//! Write a precompiled, binary representation of a Solution object.
+/*!
+ * The binary mechanism format stores the definition of a phase in a form which
+ * can be loaded much faster than the equivalent YAML input file. All quantities
+ * are stored in %Cantera's native SI+kmol unit system, so no unit conversions are
+ * needed when the file is loaded. The definitions of the elements, the species
+ * thermodynamic and transport parameters, and the rate parameters of the
+ * reactions are stored in flat, aligned arrays, which are used in place from a
+ * memory-mapped view of the file by newSolutionFromBinary().
+ *
+ * Flat storage is used for species with NASA 7-coefficient or constant heat
+ * capacity thermodynamic data and gas transport data, and for bulk phase
+ * reactions with Arrhenius, falloff, chemically-activated,
+ * pressure-dependent Arrhenius or Chebyshev rate parameterizations. All other
+ * species and reactions, including those with input fields that are not part of
+ * the flat representation such as notes, as well as the phase model parameters,
+ * are stored as embedded YAML and are parsed when the file is loaded.
+ *
+ * The file is written using the byte order of the current machine, and is only
+ * guaranteed to be readable by the %Cantera version used to create it. Binary
+ * mechanism files are therefore intended as a cache for YAML input files, rather
+ * than as a format for exchanging data.
+ *
+ * @param soln  Solution object to be written. Interfaces with adjacent phases
+ *     are not supported.
+ * @param filename  Name of the output file. By convention, the extension `.ctb`
+ *     is used, which is recognized by newSolution().
+ *
+ * @since New in %Cantera 3.2.
+ * @warning This function is an experimental part of the %Cantera API and may be
+ *     changed or removed without notice.
+ */
+void writeBinaryMechanism(shared_ptr<Solution> soln, const string& filename);
+
+//! Create a new Solution object from a binary mechanism file.
+/*!
+ * @param filename  Name of a file created by writeBinaryMechanism()
+ * @param transport  Name of the transport model. If `"default"`, the transport
+ *     model of the Solution object used to create the file is used.
+ *
+ * @since New in %Cantera 3.2.
+ * @warning This function is an experimental part of the %Cantera API and may be
+ *     changed or removed without notice.
+ */
+shared_ptr<Solution> newSolutionFromBinary(const string& filename,
+                                           const string& transport="default");
+
+//! @}
+
+}
+
+#endif
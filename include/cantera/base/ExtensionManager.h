@@ -105,6 +105,13 @@ public:
     //! reaction rate type.
     static string getSolutionWrapperType(const string& userType);
 
+    //! Returns `true` if any user-defined reaction rate types have been registered
+    //! using registerReactionDataLinker(). Rates of these types are implemented in
+    //! an external language and may not be created concurrently from multiple
+    //! threads.
+    //! @since New in %Cantera 3.2.
+    static bool hasUserRateTypes();
+
 protected:
     //! Functions for wrapping and linking ReactionData objects
     static map<string, function<void(ReactionDataDelegator&)>> s_ReactionData_linkers;
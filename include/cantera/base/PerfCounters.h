@@ -0,0 +1,114 @@
+/**
+ * @file PerfCounters.h
+ *    Lightweight instrumentation for collecting call counts and elapsed times of
+ *    selected functions (see @ref Cantera::ScopedTimer).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_PERFCOUNTERS_H
+#define CT_PERFCOUNTERS_H
+
+#include "ct_defs.h"
+#include <chrono>
+
+namespace Cantera
+{
+
+class AnyMap;
+struct PerfNode;
+
+//! Record the number of calls to and the time spent in a region of code.
+/*!
+ * A ScopedTimer measures the wall clock time between its construction and its
+ * destruction and adds it to the counter identified by `name`. Counters are
+ * hierarchical: a timer that is created while another timer is active on the same
+ * thread is recorded as a child of the active timer. For example, the time spent in
+ * `BulkKinetics::updateROP` while evaluating the right-hand side of a reactor network
+ * is reported separately from the time spent in calls made from elsewhere.
+ *
+ * Counters are accumulated separately for each thread without any locking, and are
+ * combined across threads when a report is generated by perfCounterReport(). When a
+ * thread exits, its counters are added to a combined total for exited threads.
+ *
+ * Within %Cantera, functions are instrumented using the #CT_PERF_SCOPE macro, which
+ * creates a ScopedTimer only if %Cantera was compiled with the `perf_counters`
+ * option. Applications can use ScopedTimer directly to add their own regions to the
+ * same report:
+ *
+ * @code
+ * {
+ *     ScopedTimer timer("my-application-step");
+ *     net.advance(t);
+ * }
+ * AnyMap report = perfCounterReport();
+ * @endcode
+ *
+ * @since New in %Cantera 3.2.
+ * @ingroup globalUtilFuncs
+ */
+class ScopedTimer
+{
+public:
+    //! Start timing a region of code
+    //! @param name  Name of the counter. Must refer to a string with static storage
+    //!     duration, such as a string literal.
+    explicit ScopedTimer(const char* name);
+
+    //! Stop timing and add the elapsed time to the counter
+    ~ScopedTimer();
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    PerfNode** m_current; //!< Active counter of the calling thread
+    PerfNode* m_parent; //!< Counter that was active when this timer was created
+    PerfNode* m_node; //!< Counter updated by this timer
+    std::chrono::steady_clock::time_point m_start; //!< Time of construction
+};
+
+//! Generate a report of all performance counters, combined across threads.
+/*!
+ * Each counter is represented by a map containing the number of completed `calls`,
+ * the total wall clock `time` in seconds, and, if any timers were active within it,
+ * a map of `children` with the same structure. Counters that have not been used
+ * since the last call to resetPerfCounters() are omitted. The report can be written
+ * to a YAML file using AnyMap::toYamlString().
+ *
+ * This function should not be called while instrumented code is running on other
+ * threads.
+ *
+ * @since New in %Cantera 3.2.
+ * @ingroup globalUtilFuncs
+ */
+AnyMap perfCounterReport();
+
+//! Reset all performance counters to zero.
+/*!
+ * This function should not be called while instrumented code is running on other
+ * threads.
+ *
+ * @since New in %Cantera 3.2.
+ * @ingroup globalUtilFuncs
+ */
+void resetPerfCounters();
+
+//! Returns `true` if %Cantera was compiled with the `perf_counters` option, that is,
+//! if functions instrumented using #CT_PERF_SCOPE contribute to the counters.
+//! @since New in %Cantera 3.2.
+//! @ingroup globalUtilFuncs
+bool perfCountersEnabled();
+
+}
+
+#ifdef CT_PERF_COUNTERS
+//! Time the remainder of the enclosing scope using a ScopedTimer with the given name.
+//! Expands to nothing unless %Cantera is compiled with the `perf_counters` option.
+#define CT_PERF_SCOPE(name) ::Cantera::ScopedTimer ct_perf_scope_(name)
+#else
+#define CT_PERF_SCOPE(name)
+#endif
+
+#endif
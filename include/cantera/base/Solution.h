@@ -205,7 +205,8 @@ shared_ptr<Solution> newSolution(const string& infile, const string& name,
  * This constructor wraps newThermo(), newKinetics() and newTransport() routines
  * for initialization.
  *
- * @param infile name of the input file
+ * @param infile name of the input file. Files with the extension `.ctb` are read
+ *               as binary mechanism files using newSolutionFromBinary().
  * @param name   name of the phase in the file.
  *               If this is blank, the first phase in the file is used.
  * @param transport name of the transport model.
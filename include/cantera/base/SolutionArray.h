@@ -8,12 +8,15 @@
 
 #include "cantera/base/global.h"
 #include "cantera/base/AnyMap.h"
+#include "cantera/numerics/eigen_dense.h"
 
 namespace Cantera
 {
 
 class Solution;
 class ThermoPhase;
+class Storage;
+class StateBuffer;
 
 //! A container class holding arrays of state information.
 /*!
@@ -151,6 +154,71 @@ public:
      */
     void setComponent(const string& name, const AnyValue& data);
 
+    /**
+     *  Retrieve a non-owning view of a SolutionArray component.
+     *
+     *  Views are available for components of the native state (see
+     *  Phase::nativeState) and for auxiliary components holding floating point data.
+     *  Data are not copied, and modifying the view modifies the SolutionArray. Views
+     *  are invalidated if the SolutionArray is resized or its storage order is
+     *  changed. For sliced SolutionArray objects, views are only available if the
+     *  selected entries are evenly spaced.
+     *
+     *  @param name  Name of component
+     *  @since New in %Cantera 3.2.
+     */
+    StridedVector componentView(const string& name);
+
+    /**
+     *  Retrieve a non-owning view of species data in the native basis of the phase
+     *  (mole or mass fractions), where rows correspond to SolutionArray entries and
+     *  columns correspond to species. Limitations of componentView() apply.
+     *
+     *  @since New in %Cantera 3.2.
+     */
+    StridedMatrix speciesView();
+
+    /**
+     *  Set storage order of state data.
+     *
+     *  By default, state data are stored in row-major order, where the state of each
+     *  entry is contiguous. In column-major order, values of each state component are
+     *  contiguous, which benefits analysis of individual components across many
+     *  entries at the expense of accessing individual states. The storage order of
+     *  file-backed data (see setBackingFile()) cannot be changed.
+     *
+     *  @param columnMajor  If `true`, use column-major order
+     *  @since New in %Cantera 3.2.
+     */
+    void setColumnMajor(bool columnMajor);
+
+    //! Return `true` if state data are stored in column-major order.
+    //! @since New in %Cantera 3.2.
+    bool columnMajor() const {
+        return m_columnMajor;
+    }
+
+    /**
+     *  Move state data to a memory-mapped file.
+     *
+     *  State data are held in a file that is mapped into memory, where the operating
+     *  system pages data in and out as needed. This allows for SolutionArray objects
+     *  that exceed available memory; all methods work transparently on file-backed
+     *  data, and sequential access via setLoc() triggers read-ahead of subsequent
+     *  entries. Auxiliary components remain in memory. The file serves as scratch
+     *  storage and is removed once the data are released; use save() to store data
+     *  permanently. Large arrays should be created empty and resized after calling
+     *  this method. Only available on POSIX systems.
+     *
+     *  @param fname  Name of backing file; an existing file is replaced
+     *  @since New in %Cantera 3.2.
+     */
+    void setBackingFile(const string& fname);
+
+    //! Return name of file backing state data; empty if data are held in memory.
+    //! @since New in %Cantera 3.2.
+    string backingFile() const;
+
     /**
      *  Update the buffered location used to access SolutionArray entries.
      */
@@ -244,6 +312,31 @@ public:
     void writeEntry(const string& fname, const string& name, const string& sub,
                     bool overwrite=false, int compression=0);
 
+    /**
+     *  Append SolutionArray data to a HDF container file.
+     *
+     *  Rows are appended to extendible (chunked) HDF datasets, which allows for results
+     *  to be streamed to file in blocks without holding the full data set in memory.
+     *  If the subgroup does not exist, it is created; otherwise, components of the
+     *  SolutionArray need to match the existing entry. Header information is written
+     *  if the group holding the subgroup is created.
+     *
+     *  @param fname  Name of HDF container file
+     *  @param name  Identifier of group holding header information
+     *  @param sub  Name identifier of subgroup holding SolutionArray data
+     *  @param compression  Compression level (0-9); only used when the entry is
+     *      created (default=0)
+     *  @param chunkSize  Number of rows per HDF chunk; only used when the entry is
+     *      created (default=0, which uses chunks of roughly 64 kB)
+     *  @returns  Number of rows held by the entry after appending data
+     *
+     *  @since New in %Cantera 3.2.
+     *  @warning This method is an experimental part of the %Cantera API and may be
+     *      changed or removed without notice.
+     */
+    size_t appendEntry(const string& fname, const string& name, const string& sub="",
+                       int compression=0, size_t chunkSize=0);
+
     /**
      *  Write SolutionArray data to AnyMap. Used by YAML serialization.
      *
@@ -327,13 +420,30 @@ public:
      */
     void readEntry(const AnyMap& root, const string& name, const string& sub);
 
+    /**
+     *  Restore SolutionArray data from a CSV file.
+     *
+     *  The file is expected to follow the layout written by writeEntry(): a header
+     *  line holding component names, where species columns are prefixed by `X_` or
+     *  `Y_`, followed by one line per entry. Rows are parsed concurrently, and
+     *  composition data that only differ from the native state in their basis are
+     *  converted without updating the underlying ThermoPhase object. Auxiliary
+     *  components are restored as integer, floating point or string data.
+     *
+     *  @param fname  Name of CSV file
+     *
+     *  @since New in %Cantera 3.2.
+     */
+    void readEntry(const string& fname);
+
     /**
      *  Restore SolutionArray data and header information from a container file.
      *
      *  This method retrieves data from a YAML or HDF files that were previously saved
-     *  using the save() method.
+     *  using the save() method. Data from CSV files is restored using readEntry(); in
+     *  this case, no header information is available.
      *
-     *  @param fname  Name of container file (YAML or HDF)
+     *  @param fname  Name of container file (YAML or HDF) or CSV file
      *  @param name  Identifier of location within the container file; this node/group
      *      contains header information and a subgroup holding actual SolutionArray data
      *  @param sub  Name identifier for the subgroup holding the SolutionArray data and
@@ -343,6 +453,20 @@ public:
     AnyMap restore(const string& fname, const string& name, const string& sub="");
 
 protected:
+    //! Write native state and extra components to HDF subgroup *path*; if *append* is
+    //! true, data are appended to extendible datasets.
+    void _writeColumns(Storage& file, const string& path, bool append);
+
+    //! Index of component *name* within the native state; npos if *name* is not part
+    //! of the native state
+    size_t _stateIndex(const string& name) const;
+
+    //! Save state of the associated ThermoPhase object to data entry *loc*
+    void _saveState(size_t loc);
+
+    //! Restore state of the associated ThermoPhase object from data entry *loc*
+    void _restoreState(size_t loc);
+
     //! Service function used to resize SolutionArray
     void _resize(size_t size);
 
@@ -385,11 +509,14 @@ protected:
     size_t m_size; //!< Number of entries in SolutionArray
     size_t m_dataSize; //!< Total size of unsliced data
     size_t m_stride; //!< Stride between SolutionArray entries
+    size_t m_compStride = 1; //!< Stride between state components of an entry
+    bool m_columnMajor = false; //!< `true` if state data are stored column-major
+    vector<double> m_work; //!< Work vector used for column-major storage
     AnyMap m_meta; //!< Metadata
     size_t m_loc = npos; //!< Buffered location within data vector
     vector<long int> m_apiShape; //!< Shape information used by high-level API's
 
-    shared_ptr<vector<double>> m_data; //!< Work vector holding states
+    shared_ptr<StateBuffer> m_data; //!< Buffer holding states
 
     //! Auxiliary (extra) components; size of first dimension has to match m_dataSize
     shared_ptr<map<string, AnyValue>> m_extra;
@@ -44,11 +44,24 @@ public:
 
     //! Set compression level (0..9)
     //!
-    //! Compression is only applied to matrix-type data; note that compression may
-    //! increase file size for small data sets (compression requires setting of chunk
-    //! sizes, which involves considerable overhead for metadata).
+    //! Compression is applied to both vector- and matrix-type data; note that
+    //! compression may increase file size for small data sets (compression requires
+    //! setting of chunk sizes, which involves considerable overhead for metadata).
     void setCompressionLevel(int level);
 
+    //! Set the number of rows per chunk for chunked data sets.
+    //!
+    //! Chunking is used for compressed data sets and for extendible data sets created
+    //! by appendData(). If zero (default), fixed-size data sets are stored as a single
+    //! chunk, while extendible data sets use chunks of roughly 64 kB.
+    //! @since New in %Cantera 3.2.
+    void setChunkSize(size_t rows);
+
+    //! Enable or disable the HDF shuffle filter, which is applied ahead of compression
+    //! and typically improves compression ratios for floating point data.
+    //! @since New in %Cantera 3.2.
+    void setShuffle(bool shuffle);
+
     //! Check whether location `id` represents a group
     bool hasGroup(const string& id) const;
 
@@ -84,7 +97,9 @@ public:
     //! Write attributes to a specified location
     //! @param id  storage location within file
     //! @param meta  AnyMap containing attributes
-    void writeAttributes(const string& id, const AnyMap& meta);
+    //! @param overwrite  if true, replace existing attributes (default=false); since
+    //!     %Cantera 3.2.
+    void writeAttributes(const string& id, const AnyMap& meta, bool overwrite=false);
 
     //! Read dataset from a specified location
     //! @param id  storage location within file
@@ -109,6 +124,21 @@ public:
     //!     `vector<vector<string>>`
     void writeData(const string& id, const string& name, const AnyValue& data);
 
+    //! Append rows to an extendible dataset at a specified location
+    //!
+    //! If the dataset does not exist, a chunked dataset that is unlimited in its first
+    //! dimension is created. Otherwise, data type and number of columns have to match
+    //! the existing dataset, which needs to have been created by this method.
+    //! @param id  storage location within file
+    //! @param name  name of vector/matrix entry
+    //! @param data  vector or matrix containing rows to be appended; supported types
+    //!     are the same as for writeData()
+    //! @returns  number of rows of the dataset after appending data
+    //! @since New in %Cantera 3.2.
+    //! @warning This method is an experimental part of the %Cantera API and may be
+    //!     changed or removed without notice.
+    size_t appendData(const string& id, const string& name, const AnyValue& data);
+
 private:
 #if CT_USE_HDF5
     //! ensure that HDF group is readable
@@ -120,6 +150,8 @@ private:
     unique_ptr<HighFive::File> m_file; //!< HDF container file
     bool m_write; //!< HDF access mode
     int m_compressionLevel=0; //!< HDF compression level
+    size_t m_chunkSize=0; //!< Number of rows per chunk (0 for automatic)
+    bool m_shuffle=false; //!< Flag indicating whether shuffle filter is used
 #endif
 };
 
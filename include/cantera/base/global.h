@@ -96,6 +96,25 @@ void appdelete();
 //! @copydoc Application::thread_complete
 void thread_complete();
 
+//! Call `func(i)` for each index `i` in the range [0, `n`), dividing the range
+//! between multiple threads.
+/*!
+ * Each thread handles a contiguous range of at least `grain` indices, and the
+ * number of threads is limited to the number of concurrent threads supported by
+ * the hardware. The calling thread handles the first range, and the remaining
+ * ranges are handled by a pool of worker threads which persists between calls.
+ * If only one thread would be used, or if the call is nested within another call
+ * to parallelFor() or the pool is in use by another thread, `func` is called
+ * directly from the calling thread for all indices. If `func` throws an exception,
+ * the exception from the thread handling the lowest indices is rethrown after all
+ * threads have completed. Log messages and warnings generated on the worker threads
+ * are written by the calling thread after all threads have completed, using the
+ * logger installed for the calling thread.
+ *
+ * @since New in %Cantera 3.2.
+ */
+void parallelFor(size_t n, const function<void(size_t)>& func, size_t grain=1);
+
 //! @defgroup globalSettings  Global Cantera Settings
 //! @brief Functions for accessing global %Cantera settings.
 //! @ingroup globalData
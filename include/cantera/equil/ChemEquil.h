@@ -9,11 +9,11 @@
 #define CT_CHEM_EQUIL_H
 
 #include "cantera/base/ct_defs.h"
+#include "cantera/numerics/DenseMatrix.h"
 
 namespace Cantera
 {
 
-class DenseMatrix;
 class ThermoPhase;
 //! map property strings to integers
 int _equilflag(const char* xy);
@@ -47,8 +47,19 @@ public:
      * Continuation flag. Set true if the calculation should be initialized from
      * the last calculation. Otherwise, the calculation will be started from
      * scratch and the initial composition and element potentials estimated.
+     *
+     * When set, the element potentials and temperature of the last converged
+     * solution are used as the starting point for the Newton iteration,
+     * bypassing the estimation of the initial composition and element
+     * potentials. If the iteration does not converge within
+     * #maxContinuationIterations iterations, the calculation is restarted from
+     * scratch.
      */
     bool contin = false;
+
+    //! Maximum number of Newton iterations attempted when starting from the
+    //! last converged solution before falling back to a full initial estimate.
+    int maxContinuationIterations = 100;
 };
 
 /**
@@ -133,7 +144,7 @@ protected:
      * input from the equilibrate function. Currently, this means that the 2
      * ThermoPhases have to have consist of the same species and elements.
      */
-    ThermoPhase* m_phase;
+    ThermoPhase* m_phase = nullptr;
 
     //! number of atoms of element m in species k.
     double nAtoms(size_t k, size_t m) const {
@@ -231,6 +242,26 @@ protected:
 
     void adjustEloc(ThermoPhase& s, vector<double>& elMolesGoal);
 
+    /**
+     * Solve for the dimensionless element potentials and log(T) using a damped
+     * Newton iteration, starting from the estimate in *x*. On success, the
+     * solution is stored for use as the starting point of subsequent
+     * calculations if EquilOpt::contin is set.
+     *
+     * @param s  phase object to be equilibrated
+     * @param x  initial estimate of the element potentials and log(T), of length
+     *     #m_mm + 1. Overwritten with the solution.
+     * @param elMolesGoal  specified vector of element abundances
+     * @param xval  target value of the first fixed property
+     * @param yval  target value of the second fixed property
+     * @param maxIter  maximum number of Newton iterations
+     * @param loglevel  Specify amount of debug logging (0 to disable)
+     * @return 0 on success. Throws a CanteraError if the iteration fails, after
+     *     restoring the state of *s* to the initial state.
+     */
+    int solveNewton(ThermoPhase& s, vector<double>& x, vector<double>& elMolesGoal,
+                    double xval, double yval, int maxIter, int loglevel);
+
     //! Update internally stored state information.
     void update(const ThermoPhase& s);
 
@@ -299,6 +330,24 @@ protected:
     vector<size_t> m_orderVectorElements;
     vector<size_t> m_orderVectorSpecies;
 
+    //! Element potentials and log(T) of the last converged solution. Empty if
+    //! there is no valid previous solution.
+    vector<double> m_lastSoln;
+
+    //! State of the phase at the start of the current calculation, restored if
+    //! the calculation fails.
+    vector<double> m_state;
+
+    //! Work arrays used by solveNewton(), retained between calls to avoid
+    //! repeated allocation.
+    DenseMatrix m_jac;
+    vector<double> m_x;
+    vector<double> m_resid;
+    vector<double> m_above;
+    vector<double> m_below;
+    vector<double> m_grad;
+    vector<double> m_oldx;
+
     //! Verbosity of printed output. No messages when m_loglevel == 0. More
     //! output as level increases.
     int m_loglevel;
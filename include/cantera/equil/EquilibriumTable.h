@@ -0,0 +1,183 @@
+/**
+ *  @file EquilibriumTable.h
+ *  Tabulated adiabatic and non-adiabatic equilibrium states of fuel/oxidizer
+ *  mixtures (see @ref equilGroup and class
+ *  @link Cantera::EquilibriumTable EquilibriumTable@endlink).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_EQUILIBRIUMTABLE_H
+#define CT_EQUILIBRIUMTABLE_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class Solution;
+class ThermoPhase;
+
+/**
+ * Table of equilibrium states of a fuel/oxidizer mixture on a structured grid of
+ * mixture fraction, enthalpy defect and pressure.
+ *
+ * The unburned mixture at mixture fraction @f$ Z @f$ is obtained by mixing the
+ * fuel and oxidizer streams at their respective temperatures. Its specific
+ * enthalpy is
+ * @f[
+ *     h(Z, \Delta h) = Z h_\mathrm{fuel} + (1 - Z) h_\mathrm{ox} + \Delta h
+ * @f]
+ * where @f$ \Delta h @f$ is the enthalpy defect, which is zero for adiabatic
+ * states and negative for states that have lost heat. Each table entry holds the
+ * state obtained by equilibrating this mixture at constant enthalpy and pressure.
+ *
+ * The table is filled by build(), which traverses each line of constant enthalpy
+ * defect and pressure along the mixture fraction axis so that each equilibrium
+ * calculation is started from the solution at the neighboring grid point. Lines
+ * can be distributed over several threads, each working on its own copy of the
+ * phase. Once built, the temperature, density and mole fractions at an arbitrary
+ * point inside the grid are obtained by multilinear interpolation, which does
+ * not require any equilibrium calculations.
+ *
+ * Tables can be stored in and read from YAML or HDF5 files using save() and
+ * restore(), which use the SolutionArray serialization.
+ *
+ * @ingroup equilGroup
+ */
+class EquilibriumTable
+{
+public:
+    //! Constructor.
+    //! @param sol  Solution object defining the gas phase
+    //! @param fuel  Composition of the fuel stream, as mole fractions
+    //! @param oxidizer  Composition of the oxidizer stream, as mole fractions
+    //! @param Tfuel  Temperature of the fuel stream [K]
+    //! @param Toxidizer  Temperature of the oxidizer stream [K]
+    EquilibriumTable(shared_ptr<Solution> sol, const string& fuel,
+                     const string& oxidizer, double Tfuel, double Toxidizer);
+
+    //! Set the grid on which the table is constructed. Each grid must be strictly
+    //! increasing. Any existing table data is discarded.
+    //! @param mixFrac  Mixture fraction values [-]
+    //! @param enthalpyDefect  Enthalpy defect values [J/kg]
+    //! @param pressure  Pressure values [Pa]
+    void setGrid(const vector<double>& mixFrac, const vector<double>& enthalpyDefect,
+                 const vector<double>& pressure);
+
+    //! Compute the equilibrium state at every grid point.
+    //! @param nThreads  Number of parts the table is divided into, which are
+    //!     filled in parallel using parallelFor(), each with its own copy of the
+    //!     phase. The number of threads used is also limited by the hardware.
+    //! @param loglevel  Controls amount of diagnostic output
+    void build(int nThreads=1, int loglevel=0);
+
+    //! Returns `true` if the table has been built or restored.
+    bool ready() const {
+        return !m_data.empty();
+    }
+
+    //! Number of values stored for each grid point: temperature, density, and
+    //! the mole fractions of all species.
+    size_t nValues() const {
+        return m_nv;
+    }
+
+    //! Mixture fraction grid
+    const vector<double>& mixtureFractionGrid() const {
+        return m_grid[0];
+    }
+
+    //! Enthalpy defect grid [J/kg]
+    const vector<double>& enthalpyDefectGrid() const {
+        return m_grid[1];
+    }
+
+    //! Pressure grid [Pa]
+    const vector<double>& pressureGrid() const {
+        return m_grid[2];
+    }
+
+    //! Interpolate all tabulated values at the specified point. Points outside
+    //! the grid are clipped to the grid boundaries.
+    //! @param Z  Mixture fraction
+    //! @param dh  Enthalpy defect [J/kg]
+    //! @param P  Pressure [Pa]
+    //! @param[out] values  Interpolated values, of length nValues(): temperature,
+    //!     density, and mole fractions
+    void interpolate(double Z, double dh, double P, double* values) const;
+
+    //! Equilibrium temperature [K] at the specified point
+    double temperature(double Z, double dh, double P) const {
+        double T;
+        interpolateRange(Z, dh, P, 0, 1, &T);
+        return T;
+    }
+
+    //! Equilibrium density [kg/m^3] at the specified point
+    double density(double Z, double dh, double P) const {
+        double rho;
+        interpolateRange(Z, dh, P, 1, 2, &rho);
+        return rho;
+    }
+
+    //! Get the equilibrium mole fractions at the specified point
+    //! @param Z  Mixture fraction
+    //! @param dh  Enthalpy defect [J/kg]
+    //! @param P  Pressure [Pa]
+    //! @param[out] X  Mole fractions, of length equal to the number of species
+    void getMoleFractions(double Z, double dh, double P, double* X) const;
+
+    //! Save the table to a YAML or HDF5 file
+    //! @param fname  Name of output file; the format is determined by the extension
+    //! @param name  Identifier of the root location within the container file
+    //! @param desc  Custom comment describing the dataset to be stored
+    //! @param overwrite  Force overwrite if *name* exists
+    void save(const string& fname, const string& name, const string& desc="",
+              bool overwrite=false);
+
+    //! Restore a table previously written by save(). The phase definition must be
+    //! compatible with the one used when the table was created.
+    //! @param fname  Name of YAML or HDF5 file
+    //! @param name  Identifier of the root location within the container file
+    void restore(const string& fname, const string& name);
+
+protected:
+    //! Interpolate the values with indices from *first* to *last* (exclusive) at
+    //! the specified point and store them in *out*.
+    void interpolateRange(double Z, double dh, double P, size_t first, size_t last,
+                          double* out) const;
+
+    //! Find the interval and weight for coordinate *x* along axis *axis*
+    void locate(size_t axis, double x, size_t& i, double& w) const;
+
+    //! Index of the first value of the grid point (iZ, iH, iP) in #m_data
+    size_t offset(size_t iZ, size_t iH, size_t iP) const {
+        return ((iP * m_grid[1].size() + iH) * m_grid[0].size() + iZ) * m_nv;
+    }
+
+    //! Fill all grid points for the lines of constant enthalpy defect and
+    //! pressure with (flattened) indices from *start* to *stop*.
+    void buildLines(ThermoPhase& phase, size_t start, size_t stop, int loglevel);
+
+    shared_ptr<Solution> m_sol; //!< Solution object defining the phase
+    string m_fuel; //!< Fuel composition
+    string m_oxidizer; //!< Oxidizer composition
+    double m_Tfuel; //!< Fuel temperature [K]
+    double m_Tox; //!< Oxidizer temperature [K]
+
+    //! Grids for mixture fraction, enthalpy defect and pressure
+    vector<double> m_grid[3];
+
+    size_t m_nsp; //!< Number of species
+    size_t m_nv; //!< Number of values per grid point
+
+    //! Tabulated values, ordered with mixture fraction varying fastest and
+    //! pressure varying slowest. Each grid point holds #m_nv values.
+    vector<double> m_data;
+};
+
+}
+
+#endif
@@ -0,0 +1,159 @@
+//! @file InteriorPointEquil.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_INTERIORPOINTEQUIL_H
+#define CT_INTERIORPOINTEQUIL_H
+
+#include "MultiPhase.h"
+#include "cantera/numerics/eigen_sparse.h"
+
+namespace Cantera
+{
+
+/**
+ * Multiphase chemical equilibrium solver based on a primal-dual interior-point
+ * minimization of the Gibbs free energy.
+ *
+ * The solver minimizes the dimensionless Gibbs free energy
+ * @f[
+ *     G(\mathbf{n})/RT = \sum_k n_k \mu_k(\mathbf{n}) / RT
+ * @f]
+ * of the mixture subject to the element conservation constraints
+ * @f$ A \mathbf{n} = \mathbf{b} @f$ and the bounds @f$ \mathbf{n} \ge 0 @f$.
+ * The bounds are handled with a logarithmic barrier, where the barrier
+ * parameter is reduced using Mehrotra's predictor-corrector scheme. Unlike
+ * MultiPhaseEquil and the VCS solver, no set of component species needs to be
+ * selected, and phases do not need to be added to or removed from the
+ * solution explicitly: species in unstable phases simply approach zero as the
+ * barrier parameter is reduced. The number of iterations required is largely
+ * independent of the size of the problem.
+ *
+ * Each Newton step requires the solution of the symmetric, indefinite
+ * Karush-Kuhn-Tucker (KKT) system
+ * @f[
+ *     \begin{bmatrix} H + N^{-1} Z & A^T \\ A & -\delta I \end{bmatrix}
+ *     \begin{bmatrix} \Delta \mathbf{n} \\ -\Delta \boldsymbol{\lambda} \end{bmatrix}
+ *     = \ldots
+ * @f]
+ * where the Hessian @f$ H @f$ of the Gibbs free energy is block diagonal with
+ * one block per phase. The blocks are evaluated analytically from the ideal
+ * mixing contribution and from the derivatives of the activity coefficients
+ * provided by ThermoPhase::getdlnActCoeffdlnN(). The KKT matrix is stored in
+ * sparse form; its sparsity pattern does not change between iterations, so the
+ * symbolic factorization is only computed once.
+ *
+ * Like MultiPhaseEquil, this class only handles chemical equilibrium at a
+ * specified temperature and pressure. Other property pairs are handled by
+ * MultiPhase::equilibrate, which iterates on T and P in an outer loop.
+ *
+ * @ingroup equilGroup
+ */
+class InteriorPointEquil
+{
+public:
+    //! Construct an equilibrium solver for a multiphase mixture.
+    //! @param mix Pointer to a multiphase mixture object.
+    InteriorPointEquil(MultiPhase* mix);
+
+    //! Equilibrate the mixture at constant temperature and pressure.
+    //! @param XY  Integer flag specifying properties to hold fixed. Only TP is
+    //!     supported.
+    //! @param err  Error tolerance for the dimensionless chemical potentials
+    //!     @f$ \mu_k/RT @f$ and the relative element balance
+    //! @param maxsteps  Maximum number of interior-point iterations
+    //! @param loglevel  Level of diagnostic output
+    //! @returns the final error
+    double equilibrate(int XY, double err=1.0e-9, int maxsteps=200,
+                       int loglevel=0);
+
+    //! Number of iterations taken by the last call to equilibrate()
+    int iterations() const {
+        return m_iter;
+    }
+
+    //! Dimensionless element potentials @f$ \lambda_m @f$ at the solution,
+    //! such that @f$ \mu_k/RT = \sum_m \lambda_m a_{mk} @f$ for all species
+    //! which are present. Elements which are not present in the mixture have
+    //! an element potential of zero.
+    void getElementPotentials(double* lambda) const;
+
+protected:
+    //! Set the mixture composition to the scaled mole numbers *n* and update
+    //! the dimensionless chemical potentials #m_mu
+    void updateMixture(const vector<double>& n);
+
+    //! Assemble the KKT matrix for the current state
+    void assembleKKT();
+
+    //! Solve the KKT system for the right hand side *rhs*, overwriting it with
+    //! the solution
+    void solveKKT(Eigen::VectorXd& rhs);
+
+    //! Compute the search direction for the barrier parameter *tau*.
+    //! @param tau  Target value of the complementarity products n_k z_k
+    //! @param corr  Second order correction terms for the complementarity
+    //!     conditions (Mehrotra corrector), or empty
+    void computeStep(double tau, const vector<double>& corr);
+
+    //! Largest step in (0, 1] along *dx* which keeps *x* positive, reduced by
+    //! the fraction-to-boundary factor *frac*
+    static double maxStep(const vector<double>& x, const vector<double>& dx,
+                          double frac);
+
+    MultiPhase* m_mix; //!< The mixture being equilibrated
+    size_t m_nsp; //!< Number of species included in the calculation
+    size_t m_nel; //!< Number of elements included in the calculation
+    int m_iter = 0; //!< Number of iterations taken
+
+    //! Indices in the mixture of the included species
+    vector<size_t> m_species;
+    //! Indices in the mixture of the included elements
+    vector<size_t> m_element;
+    //! Indices (in #m_species) of the included species in each phase
+    vector<vector<size_t>> m_phaseSpecies;
+
+    //! Element composition matrix (included elements x included species)
+    DenseMatrix m_A;
+    //! Scaled element abundances
+    vector<double> m_b;
+    //! Scale factor for mole numbers [kmol]
+    double m_scale = 1.0;
+
+    vector<double> m_n; //!< Scaled mole numbers
+    vector<double> m_z; //!< Multipliers for the bound constraints
+    vector<double> m_lambda; //!< Dimensionless element potentials
+    vector<double> m_mu; //!< Dimensionless chemical potentials
+
+    vector<double> m_rd; //!< Dual residual
+    vector<double> m_rp; //!< Primal residual (element balance)
+
+    vector<double> m_dn; //!< Step for the mole numbers
+    vector<double> m_dz; //!< Step for the bound multipliers
+    vector<double> m_dlambda; //!< Step for the element potentials
+
+    //! Work array for the mole numbers of all species in the mixture
+    vector<double> m_work;
+    //! Work array for the chemical potentials of all species in the mixture
+    vector<double> m_muMix;
+    //! Work array for activity coefficient derivatives
+    vector<double> m_dlnActCoeff;
+
+    //! Triplets used to assemble the KKT matrix
+    vector<Eigen::Triplet<double>> m_triplets;
+    //! KKT matrix
+    Eigen::SparseMatrix<double> m_kkt;
+    //! Sparse LDL^T factorization of the KKT matrix
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> m_solver;
+    //! True if the symbolic factorization has been computed
+    bool m_analyzed = false;
+    //! Primal regularization added to the Hessian
+    double m_deltaPrimal = 1.0e-12;
+    //! Dual regularization of the constraint block
+    double m_deltaDual = 1.0e-12;
+};
+
+}
+
+#endif
@@ -356,8 +356,9 @@ public:
      *  @param solver  Name of the solver to be used to equilibrate the phase.
      *      If solver = 'vcs', the vcs_MultiPhaseEquil solver will be used. If
      *      solver = 'gibbs', the MultiPhaseEquil solver will be used. If solver
-     *      = 'auto', the 'vcs' solver will be tried first, followed by the
-     *      'gibbs' solver if the first one fails.
+     *      = 'interior_point', the InteriorPointEquil solver will be used. If
+     *      solver = 'auto', the 'vcs' solver will be tried first, followed by
+     *      the 'gibbs' solver if the first one fails.
      *  @param rtol      Relative tolerance
      *  @param max_steps Maximum number of steps to take to find the solution
      *  @param max_iter  The maximum number of outer temperature or pressure
@@ -563,7 +564,7 @@ private:
     void calcElemAbundances() const;
 
     //! Set the mixture to a state of chemical equilibrium using the
-    //! MultiPhaseEquil solver.
+    //! MultiPhaseEquil or InteriorPointEquil solver.
     /*!
      * @param XY   Integer flag specifying properties to hold fixed.
      * @param err  Error tolerance for @f$ \Delta \mu/RT @f$ for all reactions.
@@ -573,9 +574,12 @@ private:
      * @param maxiter Maximum number of "outer" iterations for problems holding
      *                fixed something other than (T,P).
      * @param loglevel Level of diagnostic output
+     * @param interiorPoint If true, use the InteriorPointEquil solver for the
+     *                fixed TP problems instead of MultiPhaseEquil.
      */
     double equilibrate_MultiPhaseEquil(int XY, double err, int maxsteps,
-                                       int maxiter, int loglevel);
+                                       int maxiter, int loglevel,
+                                       bool interiorPoint=false);
 
     //! Vector of the number of moles in each phase.
     /*!
@@ -58,6 +58,14 @@ public:
         return m_iter;
     }
 
+    //! Set the number of threads used to test the stability of phases which
+    //! are not currently present. Stability tests of different phases are
+    //! independent, and running them concurrently can reduce the solution
+    //! time for systems with many potential condensed phases.
+    void setNumThreads(int nThreads) {
+        m_vsolve.m_numThreads = nThreads;
+    }
+
     //! Equilibrate the solution using the current element abundances
     //! stored in the MultiPhase object
     /*!
@@ -46,6 +46,10 @@ public:
     //! number of optimizations of the components basis set done
     int Basis_Opts;
 
+    //! Total number of basis optimizations which reused the stoichiometric
+    //! coefficients from the previous evaluation
+    int T_Basis_Reuse;
+
     //! Current number of times the initial thermo equilibrium estimator has
     //! been called
     int T_Calls_Inest;
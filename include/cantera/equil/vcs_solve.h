@@ -440,6 +440,21 @@ public:
      */
     double vcs_phaseStabilityTest(const size_t iph);
 
+    //! Quantities which determine the result of the phase stability test
+    //! for a phase.
+    /*!
+     * Returns pairs of the global index of each species in the phase and
+     * either the dimensionless free energy of its formation reaction (for
+     * noncomponent species) or its dimensionless chemical potential (for
+     * component species). vcs_popPhaseID() reuses the result of the previous
+     * stability test for the phase only if none of these values has changed by
+     * more than a relative tolerance of 1e-8, that is, if the test would be
+     * repeated with effectively identical inputs.
+     *
+     * @param iph Phase id of the deleted phase
+     */
+    vector<double> vcs_phaseStabilityKey(const size_t iph) const;
+
     //! Solve an equilibrium problem at a particular fixed temperature
     //! and pressure
     /*!
@@ -1104,6 +1119,36 @@ public:
      */
     vector<double> m_scSize;
 
+    //! Indices of the components with nonzero stoichiometric coefficients in
+    //! each formation reaction.
+    /*!
+     * This is a sparse representation of the nonzero pattern of
+     * #m_stoichCoeffRxnMatrix, which is used to avoid looping over all
+     * components when evaluating reaction quantities. It is updated by
+     * vcs_basopt() and permuted along with the reactions by vcs_switch_pos().
+     *
+     * length = nspecies0
+     */
+    vector<vector<size_t>> m_stoichNonzeroComp;
+
+    //! Species ordering (#m_speciesMapIndex) for which #m_stoichCoeffRxnMatrix
+    //! was last evaluated. If the ordering of the species and elements and the
+    //! number of components are unchanged, vcs_basopt() reuses the existing
+    //! stoichiometric coefficients instead of recomputing them.
+    vector<size_t> m_stoichSpeciesMap;
+
+    //! Element ordering (#m_elementMapIndex) for which #m_stoichCoeffRxnMatrix
+    //! was last evaluated.
+    vector<size_t> m_stoichElementMap;
+
+    //! Number of components for which #m_stoichCoeffRxnMatrix was last
+    //! evaluated.
+    size_t m_stoichNumComponents = npos;
+
+    //! If false, vcs_basopt() always recomputes the stoichiometric coefficients
+    //! instead of reusing the coefficients of an unchanged basis.
+    bool m_reuseStoichCoeffs = true;
+
     //! total size of the species
     /*!
      *  This is used as a multiplier to the mole number in figuring out which
@@ -1145,6 +1190,11 @@ public:
      */
     int m_doEstimateEquil = -1;
 
+    //! Number of threads used to run the stability tests for phases which
+    //! may be brought back into existence, using parallelFor(). Tests are only
+    //! run concurrently if no debug output is requested.
+    int m_numThreads = 1;
+
     //! Total moles of the species
     /*!
      *  Total number of moles of the kth species.
@@ -1200,6 +1250,13 @@ public:
     //! possible births of zeroed phases.
     vector<double> m_deltaGRxn_Deficient;
 
+    //! Values returned by vcs_phaseStabilityKey() for each phase at the time
+    //! of its last stability test. Empty if no valid result is available.
+    vector<vector<double>> m_phaseStabilityKey;
+
+    //! Result of the last stability test for each phase
+    vector<double> m_phaseStabilityFunc;
+
     //! Temporary vector of Rxn DeltaG's
     /*!
      *  This is used from time to time, for printing purposes
@@ -117,6 +117,20 @@ public:
         return m_Ea_R * GasConstant;
     }
 
+    //! Return the activation energy divided by the gas constant [K], as specified
+    //! by input parameters
+    //! @since New in %Cantera 3.2.
+    double activationEnergy_R() const {
+        return m_Ea_R;
+    }
+
+    //! Return the natural logarithm of the pre-exponential factor, which is only
+    //! defined for positive pre-exponential factors
+    //! @since New in %Cantera 3.2.
+    double logPreExponentialFactor() const {
+        return m_logA;
+    }
+
     //! Return reaction order associated with the reaction rate
     double order() const {
         return m_order;
@@ -0,0 +1,210 @@
+/**
+ *  @file BatchSurfChem.h
+ *  Declarations for the simultaneous integration of the surface coverage
+ *  equations for many independent surface states (see @ref surfSolverGroup and
+ *  class @link Cantera::BatchSurfChem BatchSurfChem@endlink).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_BATCHSURFCHEM_H
+#define CT_BATCHSURFCHEM_H
+
+#include "cantera/numerics/FuncEval.h"
+
+#include <functional>
+
+namespace Cantera
+{
+
+class Interface;
+class Integrator;
+class SurfPhase;
+class SystemJacobian;
+
+//! Advances the surface coverages of many independent copies of a surface
+//! phase in time.
+/*!
+ * Each copy of the surface, referred to as a *block*, is defined by a complete
+ * set of states for the surface phase and all of the adjacent phases
+ * participating in its InterfaceKinetics object. Within each block, the same
+ * equations as in ImplicitSurfChem are solved, that is
+ * @f[
+ *     \dot \theta_k = \dot s_k (\sigma_k / s_0)
+ * @f]
+ * for @f$ k > 0 @f$ and @f$ \sum_k \dot \theta_k = 0 @f$ for the first
+ * species. The states of the adjacent phases are held constant.
+ *
+ * Rather than creating one integrator for each surface state, all blocks are
+ * advanced together using a single CVODES instance. The Newton iterations use
+ * the GMRES linear solver, preconditioned with the sparse, block-diagonal
+ * Jacobian of the full system. Each block of this Jacobian is evaluated from
+ * the analytical derivatives provided by Kinetics::netProductionRates_ddCi(),
+ * or by finite differences if these are not available. Since the blocks are
+ * uncoupled, the preconditioner is exact up to the approximations used in the
+ * block Jacobians, and the cost of the linear algebra grows linearly with the
+ * number of blocks.
+ *
+ * All blocks share the species, reactions and rate parameters of a single
+ * Interface object. The evaluation of the right hand side and of the block
+ * Jacobians can be distributed over several threads using setThreads(), in
+ * which case each thread works on its own copy of the Interface object.
+ *
+ * The solution vector contains the coverages of all surface species for block
+ * 0, followed by the coverages for block 1, and so on.
+ *
+ * @since New in %Cantera 3.2.
+ * @warning This class is an experimental part of the %Cantera API and may be
+ *     changed or removed without notice.
+ * @ingroup surfSolverGroup
+ */
+class BatchSurfChem : public FuncEval
+{
+public:
+    //! Constructor.
+    /*!
+     * Each block is initialized with the current state of the phases of *soln*.
+     *
+     * @param soln  Interface object containing a surface phase and its
+     *     InterfaceKinetics object
+     * @param nBatch  Number of independent surface states
+     * @param rtol  The relative tolerance for the integrator
+     * @param atol  The absolute tolerance for the integrator
+     */
+    BatchSurfChem(shared_ptr<Interface> soln, size_t nBatch,
+                  double rtol=1.e-7, double atol=1.e-14);
+
+    ~BatchSurfChem() override;
+
+    //! Number of blocks
+    size_t nBatch() const {
+        return m_nBatch;
+    }
+
+    //! Number of surface species in each block
+    size_t nSurfSpecies() const {
+        return m_nsp;
+    }
+
+    //! Store the current state of the surface and the adjacent phases of the
+    //! Interface object as the state of block *i*.
+    void storeState(size_t i);
+
+    //! Set the surface and the adjacent phases of the Interface object to the
+    //! state of block *i*.
+    void restoreState(size_t i);
+
+    //! Get the coverages of block *i*.
+    void getCoverages(size_t i, double* theta) const;
+
+    //! Set the coverages of block *i*. The values are normalized so that they
+    //! sum to one.
+    void setCoverages(size_t i, const double* theta);
+
+    //! Set the number of threads used to evaluate the governing equations and
+    //! the Jacobian. Each thread works on its own copy of the Interface object.
+    void setThreads(size_t nThreads);
+
+    //! Set the relative and absolute integration tolerances.
+    void setTolerances(double rtol=1.e-7, double atol=1.e-14);
+
+    //! Set the maximum number of CVODES integration steps.
+    void setMaxSteps(size_t maxSteps=20000);
+
+    //! Set the maximum integration step size. A value of zero disables this
+    //! option.
+    void setMaxStepSize(double maxStep=0.0);
+
+    //! Initialize the integrator from the stored block states. Must be called
+    //! after the states of the blocks have been changed.
+    void initialize(double t0=0.0);
+
+    //! Integrate all blocks from *t0* to *t1*. The integrator is reinitialized
+    //! first, and the coverages of all blocks are updated with the solution.
+    //! The states of the phases of the Interface object are not modified.
+    void integrate(double t0, double t1);
+
+    //! Get the Jacobian of block *i* with respect to the coverages of that
+    //! block, in the form used by the integrator.
+    //! @param i  Block index
+    //! @param[out] jac  Jacobian, stored column-major in an array of length
+    //!     nSurfSpecies() * nSurfSpecies()
+    void getBlockJacobian(size_t i, double* jac);
+
+    // overloaded methods of class FuncEval
+
+    size_t neq() const override {
+        return m_nBatch * m_nsp;
+    }
+
+    void eval(double t, double* y, double* ydot, double* p) override;
+    void getState(double* y) override;
+    void preconditionerSetup(double t, double* y, double gamma) override;
+    void preconditionerSolve(double* rhs, double* output) override;
+    void updatePreconditioner(double gamma) override;
+
+protected:
+    //! Apply the function *func* to all blocks, distributing contiguous ranges
+    //! of blocks over threads using parallelFor(). The function receives the
+    //! index of the Interface copy used for the range and the block index.
+    void forEachBlock(const std::function<void(size_t, size_t)>& func);
+
+    //! Set the phases of worker *w* to the stored state of block *i*, with the
+    //! surface coverages taken from *theta*.
+    void setWorkerState(size_t w, size_t i, const double* theta);
+
+    //! Evaluate the coverage time derivatives for the current state of worker
+    //! *w*
+    void evalWorker(size_t w, double* ydot);
+
+    //! Evaluate the block Jacobian for the current state of worker *w* and the
+    //! coverages *theta*. The result is stored column-major in *jac*.
+    void jacobianWorker(size_t w, const double* theta, double* jac);
+
+    //! Check that *i* is a valid block index, and throw an IndexError otherwise
+    void checkBlockIndex(const string& func, size_t i) const;
+
+    //! Create the copies of the Interface object used by each worker thread
+    void setupWorkers();
+
+    shared_ptr<Interface> m_soln; //!< Interface object shared by all blocks
+    size_t m_nBatch; //!< Number of blocks
+    size_t m_nsp; //!< Number of surface species in each block
+
+    //! Interface objects used by each worker thread. The first entry is #m_soln.
+    vector<shared_ptr<Interface>> m_workers;
+    //! Surface phases of each worker
+    vector<SurfPhase*> m_surf;
+    //! Requested number of threads
+    size_t m_nThreads = 1;
+
+    //! Offsets of the states of each phase of the kinetics object within the
+    //! state of a block
+    vector<size_t> m_stateStart;
+    //! Stored states of all phases for all blocks
+    vector<double> m_blockState;
+
+    //! Coverages of all blocks; initial conditions for the integrator
+    vector<double> m_coverages;
+
+    unique_ptr<Integrator> m_integ; //!< CVODES integrator
+    //! Block-diagonal preconditioner
+    shared_ptr<SystemJacobian> m_precon;
+    double m_rtol; //!< Relative tolerance
+    double m_atol; //!< Absolute tolerance
+    size_t m_maxSteps = 20000; //!< Maximum number of steps
+    double m_maxStep = 0.0; //!< Maximum step size
+
+    //! Dense block Jacobians of all blocks
+    vector<double> m_blockJac;
+    //! Work arrays for each worker, holding the net production rates of all
+    //! kinetic species (length nTotalSpecies()) followed by the two rate vectors
+    //! and the perturbed coverages used for finite difference Jacobians (each of
+    //! length #m_nsp)
+    vector<vector<double>> m_work;
+};
+
+}
+
+#endif
@@ -79,6 +79,8 @@ public:
     Eigen::SparseMatrix<double> fwdRatesOfProgress_ddCi() override;
     Eigen::SparseMatrix<double> revRatesOfProgress_ddCi() override;
     Eigen::SparseMatrix<double> netRatesOfProgress_ddCi() override;
+    void getNetRatesOfProgress_ddX(Eigen::SparseMatrix<double>& jac) override;
+    void getNetRatesOfProgress_ddCi(Eigen::SparseMatrix<double>& jac) override;
     //! @}
 
     //! @name Rate calculation intermediate methods
@@ -141,6 +143,29 @@ protected:
     Eigen::SparseMatrix<double> calculateCompositionDerivatives(
         StoichManagerN& stoich, const vector<double>& in, bool ddX=true);
 
+    //! Process net rate-of-progress derivatives in place
+    //! @param jac  matrix receiving derivatives; its sparsity pattern is replaced if
+    //!     it does not match #m_jacPattern
+    //! @param ddX true: w.r.t mole fractions false: w.r.t species concentrations
+    //! @since New in %Cantera 3.2.
+    void updateCompositionDerivatives(Eigen::SparseMatrix<double>& jac, bool ddX);
+
+    //! Add derivatives to the values of a matrix with sparsity pattern #m_jacPattern
+    //! @param stoich  stoichiometry manager
+    //! @param in  rate expression used for the derivative calculation
+    //! @param ddX true: w.r.t mole fractions false: w.r.t species concentrations
+    //! @param factor  factor applied to all contributions
+    //! @param index  position within `values` for each derivative entry of `stoich`
+    //! @param values  values of the output matrix
+    //! @since New in %Cantera 3.2.
+    void addCompositionDerivatives(StoichManagerN& stoich, const vector<double>& in,
+                                   bool ddX, double factor, const vector<int>& index,
+                                   double* values);
+
+    //! Set up #m_jacPattern and the index maps used by addCompositionDerivatives()
+    //! @since New in %Cantera 3.2.
+    void buildCompositionDerivativesPattern();
+
     //! Helper function ensuring that all rate derivatives can be calculated
     //! @param name  method name used for error output
     //! @throw CanteraError if ideal gas assumption does not hold
@@ -176,6 +201,13 @@ protected:
     bool m_jac_skip_falloff;
     double m_jac_rtol_delta;
 
+    //! Sparsity pattern of net rate-of-progress derivatives, with zero values
+    Eigen::SparseMatrix<double> m_jacPattern;
+    bool m_jacPatternValid = false; //!< Indicates whether #m_jacPattern is current
+    vector<int> m_jacIndexFwd; //!< Positions of forward stoichiometric terms
+    vector<int> m_jacIndexRev; //!< Positions of reverse stoichiometric terms
+    vector<int> m_jacIndexThirdBody; //!< Positions of third-body terms
+
     bool m_ROP_ok = false;
 
     //! Buffers for partial rop results with length nReactions()
@@ -0,0 +1,166 @@
+/**
+ *  @file ButlerVolmerEvaluator.h
+ *  Batch evaluation of charge-transfer currents at electrode interfaces (see
+ *  @ref kineticsmgr and class
+ *  @link Cantera::ButlerVolmerEvaluator ButlerVolmerEvaluator@endlink).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_BUTLERVOLMEREVALUATOR_H
+#define CT_BUTLERVOLMEREVALUATOR_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class Interface;
+class Kinetics;
+
+//! Evaluates the current due to charge-transfer reactions for many states of an
+//! electrode interface at once.
+/*!
+ * Models of porous electrodes, such as pseudo-two-dimensional battery models,
+ * evaluate the interface current at every node of the spatial discretization.
+ * At each of these nodes, only a few quantities differ: the temperature, the
+ * electric potential of the electrode, and the concentration of the species
+ * which is transported to or from the interface, for example the lithium ion in
+ * the electrolyte. Evaluating the current with InterfaceKinetics requires
+ * setting the state of all phases and recomputing the rate constants and
+ * equilibrium constants of all reactions for each node.
+ *
+ * This class evaluates the current and its derivatives with respect to the
+ * potential and the concentration directly. For a charge-transfer reaction
+ * @f$ j @f$ transferring @f$ n_j @f$ elementary charges to the electrode phase,
+ * the forward and reverse rates of progress are
+ * @f[
+ *     R_{f,j} = \hat{k}_{f,j}(T) \, C_s^{o_{f,j}}
+ *         \exp \left( -\beta_j \frac{n_j F \phi}{RT} \right)
+ *     \qquad
+ *     R_{r,j} = \hat{k}_{r,j}(T) \, C_s^{o_{r,j}}
+ *         \exp \left( (1 - \beta_j) \frac{n_j F \phi}{RT} \right)
+ * @f]
+ * where @f$ \phi @f$ is the electric potential of the electrode phase,
+ * @f$ C_s @f$ is the activity concentration of the selected species, and
+ * @f$ o_{f,j} @f$ and @f$ o_{r,j} @f$ are its orders in the forward and reverse
+ * directions. The factors @f$ \hat{k}_{f,j}(T) @f$ and @f$ \hat{k}_{r,j}(T) @f$
+ * contain the rate constants at zero electrode potential and the activity
+ * concentrations of all other species. They are evaluated using the
+ * InterfaceKinetics object once for each temperature, and are then stored for
+ * use with further nodes at the same temperature. The current flowing into the
+ * electrode phase is
+ * @f[
+ *     i = F \sum_j n_j (R_{f,j} - R_{r,j})
+ * @f]
+ * which is the same as the value returned by InterfaceKinetics::interfaceCurrent()
+ * for the electrode phase.
+ *
+ * All other properties, such as the coverages, the standard chemical potentials,
+ * the activity concentrations of other species, and the electric potentials of
+ * the other phases, are taken from the current state of the phases of the
+ * Interface object. The stored rate factors are discarded automatically if the
+ * state of any of these phases changes. If other parameters affecting the rates
+ * are modified, such as rate multipliers or rate parameters, clearCache() must
+ * be called.
+ *
+ * @since New in %Cantera 3.2.
+ * @warning This class is an experimental part of the %Cantera API and may be
+ *     changed or removed without notice.
+ * @ingroup kineticsmgr
+ */
+class ButlerVolmerEvaluator
+{
+public:
+    //! Constructor.
+    //! @param soln  Interface object containing the charge-transfer reactions
+    //! @param electrode  Name of the phase whose electric potential varies and
+    //!     for which the current is evaluated
+    //! @param species  Name of the species whose activity concentration varies
+    ButlerVolmerEvaluator(shared_ptr<Interface> soln, const string& electrode,
+                          const string& species);
+
+    //! Number of reactions transferring charge to the electrode phase
+    size_t nChargeTransferReactions() const {
+        return m_rxn.size();
+    }
+
+    //! Evaluate the current and its derivatives for a batch of nodes.
+    //! @param nNodes  Number of nodes
+    //! @param T  Temperatures [K], length *nNodes*
+    //! @param conc  Activity concentrations of the selected species, length
+    //!     *nNodes*. Units depend on the phase of the species.
+    //! @param phi  Electric potentials of the electrode phase [V], length
+    //!     *nNodes*
+    //! @param[out] current  Currents into the electrode phase [A/m^2], length
+    //!     *nNodes*
+    //! @param[out] dcurrent_dphi  Derivatives of the currents with respect to
+    //!     the potential [A/m^2/V], length *nNodes*. Not evaluated if `nullptr`.
+    //! @param[out] dcurrent_dconc  Derivatives of the currents with respect to
+    //!     the activity concentration, length *nNodes*. Not evaluated if
+    //!     `nullptr`.
+    void eval(size_t nNodes, const double* T, const double* conc, const double* phi,
+              double* current, double* dcurrent_dphi=nullptr,
+              double* dcurrent_dconc=nullptr);
+
+    //! Discard the stored rate factors for all temperatures.
+    void clearCache() {
+        m_cache.clear();
+    }
+
+    //! Number of temperatures for which rate factors are currently stored
+    size_t nCachedTemperatures() const {
+        return m_cache.size();
+    }
+
+protected:
+    //! Evaluate the rate factors for temperature *T* and store them in the
+    //! cache. The states of all phases are restored afterwards.
+    const vector<double>& rateFactors(double T);
+
+    //! Discard the stored rate factors if the state of any of the phases has
+    //! changed since they were evaluated
+    void checkState();
+
+    //! Sum of the state numbers of all phases, used to detect state changes
+    int stateNumber() const;
+
+    shared_ptr<Interface> m_soln; //!< Interface object
+    shared_ptr<Kinetics> m_kin; //!< Kinetics object of #m_soln
+    size_t m_electrode; //!< Index of the electrode phase in #m_kin
+    size_t m_species; //!< Kinetics species index of the selected species
+
+    //! Indices of the charge-transfer reactions
+    vector<size_t> m_rxn;
+    //! Number of charges transferred to the electrode phase by each reaction
+    vector<double> m_nCharge;
+    //! Charge transfer coefficient of each reaction
+    vector<double> m_beta;
+    //! Forward reaction order of the selected species for each reaction
+    vector<double> m_orderFwd;
+    //! Reverse reaction order of the selected species for each reaction
+    vector<double> m_orderRev;
+    //! Forward orders of other species (kinetics species index and order) for
+    //! each reaction
+    vector<vector<pair<size_t, double>>> m_otherFwd;
+    //! Reverse orders of other species for each reaction
+    vector<vector<pair<size_t, double>>> m_otherRev;
+
+    //! Rate factors for the forward and reverse directions of each reaction,
+    //! stored by temperature
+    map<double, vector<double>> m_cache;
+    //! Maximum number of temperatures stored in #m_cache
+    size_t m_maxCacheSize = 1000;
+    //! State number of the phases at the time the cache was filled
+    int m_stateNum = -1;
+    //! Electric potentials of the phases at the time the cache was filled
+    vector<double> m_phi;
+
+    //! Work arrays
+    vector<double> m_kf, m_kr, m_actConc;
+};
+
+}
+
+#endif
@@ -57,6 +57,72 @@ protected:
     double m_pressure_buf = -1.0; //!< buffered pressure
 };
 
+//! Evaluator for all reactions using the ChebyshevRate parameterization
+/*!
+ * Coefficients of all Chebyshev fits handled by a MultiRate object are stored in
+ * a single flat array. The dot products of the coefficients with the reduced
+ * pressure polynomials are updated only when the pressure changes, so that each
+ * evaluation at constant pressure only requires the temperature polynomials.
+ * @ingroup otherRateGroup
+ * @since New in %Cantera 3.2.
+ */
+class ChebyshevEvaluator : public RateEvaluator
+{
+public:
+    //! Collect parameters of ChebyshevRate objects held by a MultiRate object
+    template <class Rates>
+    void setup(Rates& rates) {
+        clear();
+        for (auto& [rxn, rate] : rates) {
+            m_rxn.push_back(rxn);
+            m_nT.push_back(rate.m_coeffs.nRows());
+            m_nP.push_back(rate.m_coeffs.nColumns());
+            m_TrNum.push_back(rate.TrNum_);
+            m_TrDen.push_back(rate.TrDen_);
+            m_PrNum.push_back(rate.PrNum_);
+            m_PrDen.push_back(rate.PrDen_);
+            const auto& coeffs = rate.m_coeffs.data();
+            m_coeffs.insert(m_coeffs.end(), coeffs.begin(), coeffs.end());
+            m_coeffOffset.push_back(m_coeffs.size());
+            m_dotOffset.push_back(m_dotOffset.back() + m_nT.back());
+        }
+        m_dotProd.resize(m_dotOffset.back());
+        markReady();
+    }
+
+    //! Update dot products with the reduced pressure polynomials if the pressure
+    //! changed
+    void update(const ChebyshevData& shared_data);
+
+    //! Evaluate rate constants of all Chebyshev reactions
+    void getRateConstants(const ChebyshevData& shared_data, double* kf) const;
+
+protected:
+    //! Remove all stored parameters
+    void clear();
+
+    double m_log10P = NAN; //!< log10(p) used for last update
+
+    vector<size_t> m_rxn; //!< Reaction indices
+    vector<size_t> m_nT; //!< Number of temperature coefficients
+    vector<size_t> m_nP; //!< Number of pressure coefficients
+    vector<double> m_TrNum; //!< Terms appearing in the reduced temperature
+    vector<double> m_TrDen; //!< Terms appearing in the reduced temperature
+    vector<double> m_PrNum; //!< Terms appearing in the reduced pressure
+    vector<double> m_PrDen; //!< Terms appearing in the reduced pressure
+
+    //! Coefficients of all reactions; the column-major `nT` by `nP` coefficient
+    //! array of the j-th reaction spans `m_coeffOffset[j]` to `m_coeffOffset[j+1]`
+    vector<double> m_coeffs;
+    vector<size_t> m_coeffOffset = {0}; //!< Offsets of reactions within #m_coeffs
+
+    //! Dot products of coefficients with the reduced pressure polynomial; values
+    //! for the j-th reaction span `m_dotOffset[j]` to `m_dotOffset[j+1]`
+    vector<double> m_dotProd;
+    vector<size_t> m_dotOffset = {0}; //!< Offsets of reactions within #m_dotProd
+};
+
+
 //! Pressure-dependent rate expression where the rate coefficient is expressed
 //! as a bivariate Chebyshev polynomial in temperature and pressure.
 /*!
@@ -91,6 +157,9 @@ protected:
 class ChebyshevRate final : public ReactionRate
 {
 public:
+    //! Evaluator used by MultiRate to process all Chebyshev reactions at once
+    using Evaluator = ChebyshevEvaluator;
+
     //! Default constructor.
     ChebyshevRate() = default;
 
@@ -227,6 +296,8 @@ protected:
 
     Array2D m_coeffs; //!<< coefficient array
     vector<double> dotProd_; //!< dot product of coeffs with the reduced pressure polynomial
+
+    friend class ChebyshevEvaluator;
 };
 
 }
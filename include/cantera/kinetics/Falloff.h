@@ -232,6 +232,157 @@ protected:
 };
 
 
+//! Base class for evaluators that calculate the rate constants of all falloff
+//! reactions handled by a MultiRate object in a single pass.
+/*!
+ * Parameters are stored as structure-of-arrays. The low- and high-pressure limits
+ * and the temperature-dependent parts of the falloff function are only updated
+ * when the temperature changes, while the reduced pressure and the broadening
+ * function are evaluated in flat loops over contiguous arrays.
+ *
+ * Derived classes provide the methods `setup()`, `update()` and
+ * `getRateConstants()`, which are used by MultiRate if the rate type declares the
+ * evaluator as its nested `Evaluator` type.
+ *
+ * @ingroup falloffGroup
+ * @since New in %Cantera 3.2.
+ */
+class FalloffEvaluator : public RateEvaluator
+{
+protected:
+    //! Store reaction index, limits and type of a falloff reaction
+    void addReaction(size_t rxn, FalloffRate& rate);
+
+    //! Remove all stored parameters
+    void clear();
+
+    //! Update the low- and high-pressure limits
+    //! @return  `true` if the temperature changed since the last update
+    bool updateLimits(const FalloffData& shared_data);
+
+    //! Combine limits, third-body concentrations and values of the falloff function
+    //! @param shared_data  data shared by all reactions of a given type
+    //! @param kf  output array of rate constants, indexed by reaction
+    //! @param falloff  function returning the falloff function value for the j-th
+    //!     stored reaction given the reduced pressure
+    template <class Func>
+    void evaluate(const FalloffData& shared_data, double* kf, Func falloff) const {
+        const double* conc3b = shared_data.conc_3b.data();
+        for (size_t j = 0; j < m_rxn.size(); j++) {
+            double pr = conc3b[m_rxn[j]] * m_kLow[j] / (m_kHigh[j] + SmallNumber);
+            double F = falloff(j, pr);
+            if (m_activated[j]) {
+                kf[m_rxn[j]] = F / (1.0 + pr) * m_kLow[j];
+            } else {
+                kf[m_rxn[j]] = pr * (F / (1.0 + pr)) * m_kHigh[j];
+            }
+        }
+    }
+
+    double m_temperature = NAN; //!< Temperature used for last update
+
+    vector<size_t> m_rxn; //!< Reaction indices
+    vector<char> m_activated; //!< Flags for chemically activated reactions
+    vector<double> m_ALow; //!< Pre-exponential factors of low-pressure limits
+    vector<double> m_bLow; //!< Temperature exponents of low-pressure limits
+    vector<double> m_EaLow_R; //!< Activation temperatures of low-pressure limits
+    vector<double> m_AHigh; //!< Pre-exponential factors of high-pressure limits
+    vector<double> m_bHigh; //!< Temperature exponents of high-pressure limits
+    vector<double> m_EaHigh_R; //!< Activation temperatures of high-pressure limits
+    vector<double> m_kLow; //!< Low-pressure limits at #m_temperature
+    vector<double> m_kHigh; //!< High-pressure limits at #m_temperature
+};
+
+
+//! Evaluator for all reactions using the Troe falloff parameterization
+//! @ingroup falloffGroup
+//! @since New in %Cantera 3.2.
+class TroeEvaluator : public FalloffEvaluator
+{
+public:
+    //! Collect parameters of TroeRate objects held by a MultiRate object
+    template <class Rates>
+    void setup(Rates& rates) {
+        clear();
+        m_a.clear();
+        m_rt3.clear();
+        m_rt1.clear();
+        m_t2.clear();
+        for (auto& [rxn, rate] : rates) {
+            addReaction(rxn, rate);
+            m_a.push_back(rate.m_a);
+            m_rt3.push_back(rate.m_rt3);
+            m_rt1.push_back(rate.m_rt1);
+            m_t2.push_back(rate.m_t2);
+        }
+        m_logFcent.resize(m_a.size());
+        m_cc.resize(m_a.size());
+        m_nn.resize(m_a.size());
+        markReady();
+    }
+
+    //! Update limits and @f$ F_{cent} @f$ terms if the temperature changed
+    void update(const FalloffData& shared_data);
+
+    //! Evaluate rate constants of all Troe falloff reactions
+    void getRateConstants(const FalloffData& shared_data, double* kf) const;
+
+protected:
+    vector<double> m_a; //!< Parameter a
+    vector<double> m_rt3; //!< Parameter 1/T_3 [K^-1]
+    vector<double> m_rt1; //!< Parameter 1/T_1 [K^-1]
+    vector<double> m_t2; //!< Parameter T_2 [K]
+    vector<double> m_logFcent; //!< Values of log10(F_cent) at current temperature
+    vector<double> m_cc; //!< Values of C at current temperature
+    vector<double> m_nn; //!< Values of N at current temperature
+};
+
+
+//! Evaluator for all reactions using the SRI falloff parameterization
+//! @ingroup falloffGroup
+//! @since New in %Cantera 3.2.
+class SriEvaluator : public FalloffEvaluator
+{
+public:
+    //! Collect parameters of SriRate objects held by a MultiRate object
+    template <class Rates>
+    void setup(Rates& rates) {
+        clear();
+        m_a.clear();
+        m_b.clear();
+        m_c.clear();
+        m_d.clear();
+        m_e.clear();
+        for (auto& [rxn, rate] : rates) {
+            addReaction(rxn, rate);
+            m_a.push_back(rate.m_a);
+            m_b.push_back(rate.m_b);
+            m_c.push_back(rate.m_c);
+            m_d.push_back(rate.m_d);
+            m_e.push_back(rate.m_e);
+        }
+        m_base.resize(m_a.size());
+        m_scale.resize(m_a.size());
+        markReady();
+    }
+
+    //! Update limits and temperature-dependent terms if the temperature changed
+    void update(const FalloffData& shared_data);
+
+    //! Evaluate rate constants of all SRI falloff reactions
+    void getRateConstants(const FalloffData& shared_data, double* kf) const;
+
+protected:
+    vector<double> m_a; //!< Parameter a
+    vector<double> m_b; //!< Parameter b [K]
+    vector<double> m_c; //!< Parameter c [K]
+    vector<double> m_d; //!< Parameter d
+    vector<double> m_e; //!< Parameter e
+    vector<double> m_base; //!< Values of a exp(-b/T) + exp(-T/c)
+    vector<double> m_scale; //!< Values of d T^e
+};
+
+
 //! The Lindemann falloff parameterization.
 /**
  * This class implements the trivial falloff function F = 1.0 @cite lindemann1922.
@@ -312,6 +463,9 @@ public:
     TroeRate(const ArrheniusRate& low, const ArrheniusRate& high,
              const vector<double>& c);
 
+    //! Evaluator used by MultiRate to process all Troe falloff reactions at once
+    using Evaluator = TroeEvaluator;
+
     unique_ptr<MultiRateBase> newMultiRate() const override {
         return make_unique<MultiRate<TroeRate, FalloffData>>();
     }
@@ -359,6 +513,8 @@ protected:
 
     //! parameter T_2 in the 4-parameter Troe falloff function. [K]
     double m_t2;
+
+    friend class TroeEvaluator;
 };
 
 //! The SRI falloff function
@@ -412,6 +568,9 @@ public:
         setFalloffCoeffs(c);
     }
 
+    //! Evaluator used by MultiRate to process all SRI falloff reactions at once
+    using Evaluator = SriEvaluator;
+
     unique_ptr<MultiRateBase> newMultiRate() const override {
         return make_unique<MultiRate<SriRate, FalloffData>>();
     }
@@ -462,6 +621,8 @@ protected:
 
     //! parameter d in the 5-parameter SRI falloff function. Dimensionless.
     double m_e;
+
+    friend class SriEvaluator;
 };
 
 //! The 1- or 2-parameter Tsang falloff parameterization.
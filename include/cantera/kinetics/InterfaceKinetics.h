@@ -137,6 +137,7 @@ public:
     bool addReaction(shared_ptr<Reaction> r, bool resize=true) override;
     void modifyReaction(size_t i, shared_ptr<Reaction> rNew) override;
     void setMultiplier(size_t i, double f) override;
+    void invalidateCache() override;
     //! @}
 
     //! Internal routine that updates the Rates of Progress of the reactions
@@ -162,6 +163,7 @@ public:
      * This method fills out the array of generalized concentrations by calling
      * method getActivityConcentrations for each phase, which classes
      * representing phases should overload to return the appropriate quantities.
+     * Phases whose state has not changed since the last call are skipped.
      */
     void _update_rates_C();
 
@@ -214,6 +216,9 @@ public:
     //! Update the standard state chemical potentials and species equilibrium
     //! constant entries
     /*!
+     *  The standard state chemical potentials are only re-evaluated for phases
+     *  whose state has changed since the last call.
+     *
      *  Virtual because it is overridden when dealing with experimental open
      *  circuit voltage overrides
      */
@@ -293,6 +298,10 @@ public:
 
     void setDerivativeSettings(const AnyMap& settings) override;
     void getDerivativeSettings(AnyMap& settings) const override;
+    void getFwdRateConstants_ddT(double* dkfwd) override;
+    void getFwdRatesOfProgress_ddT(double* drop) override;
+    void getRevRatesOfProgress_ddT(double* drop) override;
+    void getNetRatesOfProgress_ddT(double* drop) override;
     Eigen::SparseMatrix<double> fwdRatesOfProgress_ddCi() override;
     Eigen::SparseMatrix<double> revRatesOfProgress_ddCi() override;
     Eigen::SparseMatrix<double> netRatesOfProgress_ddCi() override;
@@ -309,6 +318,19 @@ protected:
     //! Multiply rate with inverse equilibrium constant
     void applyEquilibriumConstants(double* rop);
 
+    //! Multiply rate with scaled temperature derivatives of the inverse
+    //! equilibrium constant
+    /*!
+     *  This (scaled) derivative is handled by a finite difference, where the
+     *  temperatures of all phases are perturbed.
+     */
+    void applyEquilibriumConstants_ddT(double* drkcn);
+
+    //! Process temperature derivative of the rate constants
+    //! @param[in,out] drop  rate expression used for the derivative calculation;
+    //!     overwritten by the derivative
+    void process_ddT(double* drop);
+
     //! Process mole fraction derivative
     //! @param stoich  stoichiometry manager
     //! @param in  rate expression used for the derivative calculation
@@ -317,10 +339,21 @@ protected:
     Eigen::SparseMatrix<double> calculateCompositionDerivatives(StoichManagerN& stoich,
                                             const vector<double>& in);
 
+    //! Process derivatives of rates of progress with respect to concentrations
+    //! which arise from the coverage dependence of rate constants and, for
+    //! CoverageDependentSurfPhase, of the equilibrium constants.
+    //! @param ropf  forward rates of progress weighting the rate constant
+    //!     derivatives, or `nullptr`
+    //! @param ropr  reverse rates of progress weighting the rate constant and
+    //!     inverse equilibrium constant derivatives, or `nullptr`
+    //! @return a sparse matrix of derivative contributions for each reaction of
+    //! dimensions nTotalReactions by nTotalSpecies
+    Eigen::SparseMatrix<double> calculateCoverageDerivatives(const double* ropf,
+                                                             const double* ropr);
+
     //! Helper function ensuring that all rate derivatives can be calculated
     //! @param name  method name used for error output
-    //! @throw CanteraError if coverage dependence or electrochemical reactions are
-    //! included
+    //! @throw CanteraError if electrochemical reactions are included
     void assertDerivativesValid(const string& name);
 
     //! @}
@@ -414,6 +447,29 @@ protected:
      */
     vector<double> m_phi;
 
+    //! Check whether the state of phase *n* differs from the state recorded in
+    //! *states*, and record the current state.
+    /*!
+     *  The state of each phase is identified by its temperature, density,
+     *  pressure and Phase::stateMFNumber(). The latter is also incremented by
+     *  Phase::invalidateCache(), which is called when species are modified or
+     *  when phase parameters affecting standard chemical potentials or activity
+     *  concentrations are changed. The recorded states are stored in *states*,
+     *  with #m_nStateVars entries for each phase.
+     */
+    bool phaseStateChanged(size_t n, vector<double>& states);
+
+    //! Number of values used to identify the state of each phase
+    static const size_t m_nStateVars = 4;
+
+    //! States of the phases when their activity concentrations were last
+    //! evaluated in _update_rates_C().
+    vector<double> m_concStates;
+
+    //! States of the phases when their standard chemical potentials were last
+    //! evaluated in updateMu0().
+    vector<double> m_mu0States;
+
     //! Pointer to the single surface phase
     SurfPhase* m_surf = nullptr;
 
@@ -138,6 +138,31 @@ public:
     //! @param shared_data  data shared by all reactions of a given type
     void updateFromStruct(const InterfaceData& shared_data);
 
+    //! Evaluate the derivatives of the logarithm of the rate coefficient with
+    //! respect to the coverages of the species it depends on.
+    /*!
+     *  For each coverage dependency, the derivative is
+     *  @f[
+     *      \frac{\partial \ln k_f}{\partial \theta_k} = a_k \ln 10
+     *          - \frac{1}{T} \frac{d E_k(\theta_k)}{d \theta_k}
+     *          + \frac{m_k}{\theta_k}
+     *  @f]
+     *  where @f$ E_k(\theta_k) @f$ is the linear or polynomial activation energy
+     *  modifier in temperature units.
+     *
+     *  @param coverages  Surface coverages, indexed by kinetics species index
+     *  @param T  Temperature [K]
+     *  @param kf  Current value of the rate coefficient
+     *  @param[out] dlnk  Pairs of kinetics species index and derivative; entries
+     *      are appended to the vector.
+     *
+     *  @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     *  @since New in %Cantera 3.2.
+     */
+    virtual void getCoverageDerivatives(const double* coverages, double T, double kf,
+                                        vector<pair<size_t, double>>& dlnk) const;
+
     //! Calculate modifications for the forward reaction rate for interfacial charge
     //! transfer reactions.
     /*!
@@ -349,6 +374,13 @@ public:
     //! and stickingWeight.
     void setContext(const Reaction& rxn, const Kinetics& kin);
 
+    //! Evaluate the derivatives of the logarithm of the rate coefficient with
+    //! respect to the coverages, including the effect of the Motz & Wise
+    //! correction.
+    //! @see InterfaceRateBase::getCoverageDerivatives
+    void getCoverageDerivatives(const double* coverages, double T, double kf,
+                                vector<pair<size_t, double>>& dlnk) const override;
+
 protected:
     bool m_motzWise; //!< boolean indicating whether Motz & Wise correction is used
     bool m_explicitMotzWise; //!< Correction cannot be overriden by default
@@ -428,7 +460,17 @@ public:
     //! divided by reaction rate
     //! @param shared_data  data shared by all reactions of a given type
     double ddTScaledFromStruct(const DataType& shared_data) const {
-        throw NotImplementedError("InterfaceRate<>::ddTScaledFromStruct");
+        if (m_exchangeCurrentDensityFormulation) {
+            throw NotImplementedError("InterfaceRate<>::ddTScaledFromStruct",
+                "Not implemented for exchange current density formulation.");
+        }
+        double out = (RateType::activationEnergy() / GasConstant * shared_data.recipT
+            + RateType::temperatureExponent() + m_ecov * shared_data.recipT)
+            * shared_data.recipT;
+        if (m_chargeTransfer) {
+            out += m_beta * m_deltaPotential_RT * shared_data.recipT;
+        }
+        return out;
     }
 
     double preExponentialFactor() const override {
@@ -571,7 +613,28 @@ public:
     //! divided by reaction rate
     //! @param shared_data  data shared by all reactions of a given type
     double ddTScaledFromStruct(const DataType& shared_data) const {
-        throw NotImplementedError("StickingRate<>::ddTScaledFromStruct");
+        if (m_exchangeCurrentDensityFormulation) {
+            throw NotImplementedError("StickingRate<>::ddTScaledFromStruct",
+                "Not implemented for exchange current density formulation.");
+        }
+        // derivative of the sticking coefficient
+        double out = (RateType::activationEnergy() / GasConstant * shared_data.recipT
+            + RateType::temperatureExponent() + m_ecov * shared_data.recipT)
+            * shared_data.recipT;
+        if (m_chargeTransfer) {
+            out += m_beta * m_deltaPotential_RT * shared_data.recipT;
+        }
+        if (m_motzWise) {
+            double gamma = RateType::evalRate(shared_data.logT, shared_data.recipT) *
+                std::exp(std::log(10.0) * m_acov - m_ecov * shared_data.recipT
+                         + m_mcov);
+            if (m_chargeTransfer) {
+                gamma *= voltageCorrection();
+            }
+            out /= 1 - 0.5 * gamma;
+        }
+        // contribution of the collision frequency
+        return out + 0.5 * shared_data.recipT;
     }
 
     double preExponentialFactor() const override {
@@ -582,6 +645,13 @@ public:
     double activationEnergy() const override {
         return RateType::activationEnergy() + m_ecov * GasConstant;
     }
+
+    void addCoverageDependence(const string& sp, double a, double m,
+                               const vector<double>& e) override
+    {
+        InterfaceRateBase::addCoverageDependence(sp, a, m, e);
+        RateType::setCompositionDependence(true);
+    }
 };
 
 //! Arrhenius-type interface sticking rate specifications
@@ -670,8 +670,9 @@ public:
      *    when calculating numerical derivatives. The default value is 1e-8.
      *
      * For InterfaceKinetics, the following keyword/value pairs are supported:
-     *  - `skip-coverage-dependence` (boolean): if `false` (default), rate constant
-     *    coverage dependence is not considered when evaluating derivatives.
+     *  - `skip-coverage-dependence` (boolean): if `true`, the coverage dependence
+     *    of rate constants and standard chemical potentials is not considered when
+     *    evaluating derivatives. The default is `false`.
      *  - `skip-electrochemistry` (boolean): if `false` (default), electrical charge
      *    is not considered in evaluating the derivatives and these reactions are
      *    treated as normal surface reactions.
@@ -958,6 +959,48 @@ public:
             "Not implemented for kinetics type '{}'.", kineticsType());
     }
 
+    /**
+     * Calculate derivatives for net rates-of-progress with respect to species
+     * mole fractions, storing the result in a caller-owned matrix.
+     *
+     * Equivalent to netRatesOfProgress_ddX(). Kinetics managers that support it
+     * determine the sparsity pattern once and afterwards only update the values of
+     * `jac`, without allocating memory, provided that its pattern is not modified
+     * by the caller between calls. Otherwise, `jac` is reassigned.
+     *
+     * @param[in,out] jac  Matrix with nReactions() rows and nTotalSpecies() columns
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     *
+     * @since New in %Cantera 3.2.
+     */
+    virtual void getNetRatesOfProgress_ddX(Eigen::SparseMatrix<double>& jac)
+    {
+        jac = netRatesOfProgress_ddX();
+        jac.makeCompressed();
+    }
+
+    /**
+     * Calculate derivatives for net rates-of-progress with respect to species
+     * concentration, storing the result in a caller-owned matrix.
+     *
+     * Equivalent to netRatesOfProgress_ddCi(); see getNetRatesOfProgress_ddX() for
+     * details on how `jac` is reused.
+     *
+     * @param[in,out] jac  Matrix with nReactions() rows and nTotalSpecies() columns
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     *
+     * @since New in %Cantera 3.2.
+     */
+    virtual void getNetRatesOfProgress_ddCi(Eigen::SparseMatrix<double>& jac)
+    {
+        jac = netRatesOfProgress_ddCi();
+        jac.makeCompressed();
+    }
+
     /**
      * Calculate derivatives for species creation rates with respect to temperature
      * at constant pressure, molar concentration and mole fractions.
@@ -1117,6 +1160,40 @@ public:
      */
     Eigen::SparseMatrix<double> netProductionRates_ddCi();
 
+    /**
+     * Calculate derivatives for species net production rates with respect to species
+     * mole fractions, storing the result in a caller-owned matrix.
+     *
+     * Equivalent to netProductionRates_ddX(). The sparsity pattern of the product
+     * of the stoichiometric matrix with the rate-of-progress derivatives is
+     * determined once; afterwards, only the values of `jac` are updated as long as
+     * its pattern is not modified by the caller between calls.
+     *
+     * @param[in,out] jac  Square matrix with nTotalSpecies() rows and columns
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     *
+     * @since New in %Cantera 3.2.
+     */
+    void getNetProductionRates_ddX(Eigen::SparseMatrix<double>& jac);
+
+    /**
+     * Calculate derivatives for species net production rates with respect to species
+     * concentration, storing the result in a caller-owned matrix.
+     *
+     * Equivalent to netProductionRates_ddCi(); see getNetProductionRates_ddX() for
+     * details on how `jac` is reused.
+     *
+     * @param[in,out] jac  Square matrix with nTotalSpecies() rows and columns
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     *
+     * @since New in %Cantera 3.2.
+     */
+    void getNetProductionRates_ddCi(Eigen::SparseMatrix<double>& jac);
+
     /** @} End of Kinetics Derivatives */
     //! @} End of addtogroup derivGroup
 
@@ -1297,6 +1374,27 @@ public:
      */
     virtual bool addReaction(shared_ptr<Reaction> r, bool resize=true);
 
+    /**
+     * Add several reactions to the mechanism. This is equivalent to calling
+     * addReaction() with `resize = false` for each reaction, followed by a single
+     * call to resizeReactions(), except that storage for the new reactions is
+     * reserved in advance.
+     *
+     * @param reactions  Reactions to be added, in order
+     * @param checked  If `true`, each reaction has already been checked using
+     *     Reaction::check(), Reaction::validate(), and Reaction::checkSpecies(),
+     *     with the last returning `true`, and these checks are not repeated. This
+     *     allows the checks to be done concurrently for many reactions, as is done
+     *     by addReactions(Kinetics&, const AnyMap&, const AnyMap&).
+     * @param errors  If not `nullptr`, a CanteraError raised while adding a
+     *     reaction is caught and its message is appended to this vector, and the
+     *     remaining reactions are still added. Otherwise, the error is rethrown.
+     * @return  the number of reactions that were added
+     * @since New in %Cantera 3.2.
+     */
+    size_t addReactions(const vector<shared_ptr<Reaction>>& reactions,
+                        bool checked=false, vector<string>* errors=nullptr);
+
     /**
      * Modify the rate expression associated with a reaction. The
      * stoichiometric equation, type of the reaction, reaction orders, third
@@ -1466,6 +1564,36 @@ protected:
     Eigen::SparseMatrix<double> m_stoichMatrix;
     //! @}
 
+    //! Multiply #m_stoichMatrix with rate-of-progress derivatives `rop`, reusing
+    //! the sparsity pattern of `out` from previous calls.
+    //! @since New in %Cantera 3.2.
+    void multiplyStoichMatrix(const Eigen::SparseMatrix<double>& rop,
+                              Eigen::SparseMatrix<double>& out);
+
+    //! @name Buffers for in-place production rate derivatives
+    //! @{
+
+    //! Rate-of-progress derivatives used by getNetProductionRates_ddX() and
+    //! getNetProductionRates_ddCi()
+    Eigen::SparseMatrix<double> m_ropJac;
+
+    //! Sparsity pattern of the rate-of-progress derivatives used to set up
+    //! #m_productJacPattern and the product terms
+    Eigen::SparseMatrix<double> m_productJacSource;
+
+    //! Sparsity pattern of the production rate derivatives, with zero values
+    Eigen::SparseMatrix<double> m_productJacPattern;
+
+    //! Position within the output values for each product term
+    vector<int> m_productJacOut;
+
+    //! Position within the rate-of-progress derivative values for each product term
+    vector<int> m_productJacIn;
+
+    //! Stoichiometric coefficient for each product term
+    vector<double> m_productJacCoeffs;
+    //! @}
+
     //! Boolean indicating whether Kinetics object is fully configured
     bool m_ready = false;
 
@@ -1536,6 +1664,10 @@ protected:
     //! See skipUndeclaredSpecies()
     bool m_skipUndeclaredSpecies = false;
 
+    //! Set by addReactions() when the reactions being added have already been
+    //! checked
+    bool m_reactionsChecked = false;
+
     //! See skipUndeclaredThirdBodies()
     bool m_skipUndeclaredThirdBodies = false;
 
@@ -11,10 +11,58 @@
 #include "ReactionRate.h"
 #include "MultiRateBase.h"
 #include "cantera/base/utilities.h"
+#include "cantera/base/PerfCounters.h"
 
 namespace Cantera
 {
 
+//! Placeholder used by MultiRate for rate types without a batch evaluator
+struct NoRateEvaluator {};
+
+//! Determine the batch evaluator used by MultiRate for a rate type, which is given
+//! by the nested type `RateType::Evaluator` if it exists.
+//! @since New in %Cantera 3.2.
+template <class T, class=void>
+struct RateEvaluatorType : std::false_type
+{
+    using type = NoRateEvaluator;
+};
+
+template <class T>
+struct RateEvaluatorType<T, std::void_t<typename T::Evaluator>> : std::true_type
+{
+    using type = typename T::Evaluator;
+};
+
+//! Base class for batch evaluators used by MultiRate, which tracks whether the
+//! parameters collected from the rate objects are up to date.
+//!
+//! Derived classes provide the methods `setup()`, `update()` and
+//! `getRateConstants()`, and call markReady() at the end of `setup()`.
+//! @since New in %Cantera 3.2.
+class RateEvaluator
+{
+public:
+    //! Mark stored parameters as outdated after reactions were added or replaced
+    void invalidate() {
+        m_ready = false;
+    }
+
+    //! Return `true` if parameters are set up
+    bool ready() const {
+        return m_ready;
+    }
+
+protected:
+    //! Mark stored parameters as up to date
+    void markReady() {
+        m_ready = true;
+    }
+
+private:
+    bool m_ready = false; //!< Flag indicating whether parameters are set up
+};
+
 //! A class template handling ReactionRate specializations.
 //! @ingroup rateEvaluators
 template <class RateType, class DataType>
@@ -24,6 +72,10 @@ class MultiRate final : public MultiRateBase
     CT_DEFINE_HAS_MEMBER(has_ddT, ddTScaledFromStruct)
     CT_DEFINE_HAS_MEMBER(has_ddP, perturbPressure)
     CT_DEFINE_HAS_MEMBER(has_ddM, perturbThirdBodies)
+    CT_DEFINE_HAS_MEMBER(has_ready, ready)
+
+    //! Flag indicating whether rates are evaluated by a batch evaluator
+    static constexpr bool has_evaluator = RateEvaluatorType<RateType>::value;
 
 public:
     string type() override {
@@ -38,6 +90,9 @@ public:
         m_indices[rxn_index] = m_rxn_rates.size();
         m_rxn_rates.emplace_back(rxn_index, dynamic_cast<RateType&>(rate));
         m_shared.invalidateCache();
+        if constexpr (has_evaluator) {
+            m_evaluator.invalidate();
+        }
     }
 
     bool replace(size_t rxn_index, ReactionRate& rate) override {
@@ -52,6 +107,9 @@ public:
                  "with a new rate of type '{}'.", type(), rate.type());
         }
         m_shared.invalidateCache();
+        if constexpr (has_evaluator) {
+            m_evaluator.invalidate();
+        }
         if (m_indices.find(rxn_index) != m_indices.end()) {
             size_t j = m_indices[rxn_index];
             m_rxn_rates.at(j).second = dynamic_cast<RateType&>(rate);
@@ -63,9 +121,18 @@ public:
     void resize(size_t nSpecies, size_t nReactions, size_t nPhases) override {
         m_shared.resize(nSpecies, nReactions, nPhases);
         m_shared.invalidateCache();
+        if constexpr (has_evaluator) {
+            m_kbuf.resize(nReactions);
+        }
     }
 
     void getRateConstants(double* kf) override {
+        if constexpr (has_evaluator) {
+            if (_evaluatorActive()) {
+                _evaluate(kf);
+                return;
+            }
+        }
         for (auto& [iRxn, rate] : m_rxn_rates) {
             kf[iRxn] = rate.evalFromStruct(m_shared);
         }
@@ -82,11 +149,12 @@ public:
             double dTinv = 1. / (m_shared.temperature * deltaT);
             m_shared.perturbTemperature(deltaT);
             _update();
+            _evaluatePerturbed();
 
             // apply numerical derivative
             for (auto& [iRxn, rate] : m_rxn_rates) {
                 if (kf[iRxn] != 0.) {
-                    double k1 = rate.evalFromStruct(m_shared);
+                    double k1 = _perturbedRate(iRxn, rate);
                     rop[iRxn] *= dTinv * (k1 / kf[iRxn] - 1.);
                 } // else not needed: derivative is already zero
             }
@@ -103,10 +171,11 @@ public:
             double dPinv = 1. / (m_shared.pressure * deltaP);
             m_shared.perturbPressure(deltaP);
             _update();
+            _evaluatePerturbed();
 
             for (auto& [iRxn, rate] : m_rxn_rates) {
                 if (kf[iRxn] != 0.) {
-                    double k1 = rate.evalFromStruct(m_shared);
+                    double k1 = _perturbedRate(iRxn, rate);
                     rop[iRxn] *= dPinv * (k1 / kf[iRxn] - 1.);
                 } // else not needed: derivative is already zero
             }
@@ -128,10 +197,11 @@ public:
             double dMinv = 1. / deltaM;
             m_shared.perturbThirdBodies(deltaM);
             _update();
+            _evaluatePerturbed();
 
             for (auto& [iRxn, rate] : m_rxn_rates) {
                 if (kf[iRxn] != 0. && m_shared.conc_3b[iRxn] > 0.) {
-                    double k1 = rate.evalFromStruct(m_shared);
+                    double k1 = _perturbedRate(iRxn, rate);
                     rop[iRxn] *= dMinv * (k1 / kf[iRxn] - 1.);
                     rop[iRxn] /= m_shared.conc_3b[iRxn];
                 } else {
@@ -169,6 +239,7 @@ public:
     }
 
     bool update(const ThermoPhase& phase, const Kinetics& kin) override {
+        CT_PERF_SCOPE("MultiRate::update");
         bool changed = m_shared.update(phase, kin);
         if (changed) {
             // call helper function only if needed: implementation depends on whether
@@ -195,6 +266,15 @@ public:
 protected:
     //! Helper function to process updates
     void _update() {
+        if constexpr (has_evaluator) {
+            if (_evaluatorActive()) {
+                // per-reaction updates are superseded by the batch evaluator
+                if (m_evaluator.ready()) {
+                    m_evaluator.update(m_shared);
+                }
+                return;
+            }
+        }
         if constexpr (has_update<RateType>::value) {
             for (auto& [i, rxn] : m_rxn_rates) {
                 rxn.updateFromStruct(m_shared);
@@ -202,10 +282,56 @@ protected:
         }
     }
 
+    //! Return `true` if rate constants are evaluated by the batch evaluator, which
+    //! requires shared data to be sized for the parent Kinetics object
+    bool _evaluatorActive() const {
+        if constexpr (!has_evaluator) {
+            return false;
+        } else if constexpr (has_ready<DataType>::value) {
+            return m_shared.ready;
+        } else {
+            return true;
+        }
+    }
+
+    //! Helper function evaluating all rate constants using the batch evaluator
+    void _evaluate(double* kf) {
+        if (!m_evaluator.ready()) {
+            m_evaluator.setup(m_rxn_rates);
+            m_evaluator.update(m_shared);
+        }
+        m_evaluator.getRateConstants(m_shared, kf);
+    }
+
+    //! Helper function evaluating rate constants at perturbed conditions, if they
+    //! are evaluated by the batch evaluator
+    void _evaluatePerturbed() {
+        if constexpr (has_evaluator) {
+            if (_evaluatorActive()) {
+                _evaluate(m_kbuf.data());
+            }
+        }
+    }
+
+    //! Helper function returning the rate constant at perturbed conditions, using
+    //! the same evaluation path as getRateConstants()
+    double _perturbedRate(size_t iRxn, RateType& rate) {
+        if (_evaluatorActive()) {
+            return m_kbuf[iRxn];
+        }
+        return rate.evalFromStruct(m_shared);
+    }
+
     //! Vector of pairs of reaction rates indices and reaction rates
     vector<pair<size_t, RateType>> m_rxn_rates;
     map<size_t, size_t> m_indices; //! Mapping of indices
     DataType m_shared;
+
+    //! Batch evaluator, if provided by the rate type
+    typename RateEvaluatorType<RateType>::type m_evaluator;
+
+    //! Rate constants at perturbed conditions, if evaluated by #m_evaluator
+    vector<double> m_kbuf;
 };
 
 }
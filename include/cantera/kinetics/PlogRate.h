@@ -7,6 +7,7 @@
 #define CT_PLOGRATE_H
 
 #include "cantera/kinetics/Arrhenius.h"
+#include "cantera/kinetics/MultiRate.h"
 
 namespace Cantera
 {
@@ -54,6 +55,94 @@ protected:
 };
 
 
+//! Evaluator for all reactions using the PlogRate parameterization
+/*!
+ * Parameters of all Arrhenius expressions and pressure grids handled by a
+ * MultiRate object are stored in flat arrays. The bracketing pressure interval
+ * and interpolation weight of each reaction are updated only when the pressure
+ * changes, which makes evaluation at constant pressure a single loop over all
+ * reactions.
+ * @ingroup otherRateGroup
+ * @since New in %Cantera 3.2.
+ */
+class PlogEvaluator : public RateEvaluator
+{
+public:
+    //! Collect parameters of PlogRate objects held by a MultiRate object
+    template <class Rates>
+    void setup(Rates& rates) {
+        clear();
+        for (auto& [rxn, rate] : rates) {
+            m_rxn.push_back(rxn);
+            size_t offset = m_A.size();
+            for (const auto& arrhenius : rate.rates_) {
+                addArrhenius(arrhenius);
+            }
+            for (const auto& [logP, indices] : rate.pressures_) {
+                m_logP.push_back(logP);
+                m_first.push_back(offset + indices.first);
+                m_last.push_back(offset + indices.second);
+            }
+            m_grid.push_back(m_logP.size());
+        }
+        m_ilow.resize(m_rxn.size(), 0);
+        m_ihigh.resize(m_rxn.size(), 0);
+        m_logP1.resize(m_rxn.size(), 1000.);
+        m_logP2.resize(m_rxn.size(), -1000.);
+        m_rDeltaP.resize(m_rxn.size(), -1.0);
+        markReady();
+    }
+
+    //! Update bracketing pressure intervals if the pressure changed
+    void update(const PlogData& shared_data);
+
+    //! Evaluate rate constants of all PLOG reactions
+    void getRateConstants(const PlogData& shared_data, double* kf) const;
+
+protected:
+    //! Remove all stored parameters
+    void clear();
+
+    //! Store parameters of an Arrhenius expression
+    void addArrhenius(const ArrheniusRate& rate);
+
+    //! Evaluate the natural logarithm of the (summed) rate at the pressure given by
+    //! the grid point `i`
+    double logRate(size_t i, double logT, double recipT) const {
+        if (m_first[i] == m_last[i]) {
+            return m_logA[m_first[i]] + m_b[m_first[i]] * logT
+                - m_Ea_R[m_first[i]] * recipT;
+        }
+        double k = 1e-300; // non-zero to make log(k) finite
+        for (size_t n = m_first[i]; n < m_last[i]; n++) {
+            k += m_A[n] * std::exp(m_b[n] * logT - m_Ea_R[n] * recipT);
+        }
+        return std::log(k);
+    }
+
+    double m_logPressure = NAN; //!< log(p) used for last update
+
+    vector<size_t> m_rxn; //!< Reaction indices
+    vector<double> m_A; //!< Pre-exponential factors of all Arrhenius expressions
+    vector<double> m_logA; //!< Logarithms of pre-exponential factors
+    vector<double> m_b; //!< Temperature exponents
+    vector<double> m_Ea_R; //!< Activation temperatures
+
+    //! Offsets of the pressure grid of each reaction within #m_logP; the grid of
+    //! the j-th reaction spans `m_grid[j]` to `m_grid[j+1]`
+    vector<size_t> m_grid = {0};
+    vector<double> m_logP; //!< log(p) of pressure grid points, including sentinels
+    vector<size_t> m_first; //!< First Arrhenius expression at each grid point
+    vector<size_t> m_last; //!< One past the last Arrhenius expression at each point
+
+    vector<size_t> m_ilow; //!< Grid point at the lower end of the current interval
+    vector<size_t> m_ihigh; //!< Grid point at the upper end of the current interval
+    vector<double> m_logP1; //!< log(p) at the lower end of the current interval
+    vector<double> m_logP2; //!< log(p) at the upper end of the current interval
+    vector<double> m_rDeltaP; //!< Reciprocal of the current interval width
+};
+
+
 //! Pressure-dependent reaction rate expressed by logarithmically interpolating
 //! between Arrhenius rate expressions at various pressures.
 /*!
@@ -76,6 +165,9 @@ protected:
 class PlogRate final : public ReactionRate
 {
 public:
+    //! Evaluator used by MultiRate to process all PLOG reactions at once
+    using Evaluator = PlogEvaluator;
+
     //! Default constructor.
     PlogRate() = default;
 
@@ -194,6 +286,8 @@ protected:
     size_t ilow1_, ilow2_, ihigh1_, ihigh2_;
 
     double rDeltaP_ = -1.0; //!< reciprocal of (logP2 - logP1)
+
+    friend class PlogEvaluator;
 };
 
 }
@@ -778,6 +778,24 @@ public:
      *  @param rates   Rates-of-progress.
      */
     Eigen::SparseMatrix<double> derivatives(const double* conc, const double* rates)
+    {
+        return derivativesView(conc, rates);
+    }
+
+    //! Calculate derivatives with respect to species concentrations without
+    //! creating a new matrix.
+    /*!
+     * Same as derivatives(), but returns a view of internal storage. The sparsity
+     * pattern of the view is fixed by resizeCoeffs(), while its values are
+     * overwritten by the next call to this method or derivatives().
+     *
+     *  @param conc    Species concentration.
+     *  @param rates   Rates-of-progress.
+     *
+     * @since New in %Cantera 3.2.
+     */
+    Eigen::Map<const Eigen::SparseMatrix<double>> derivativesView(
+        const double* conc, const double* rates)
     {
         // calculate derivative entries using known sparse storage order
         std::fill(m_values.begin(), m_values.end(), 0.);
@@ -786,7 +804,7 @@ public:
         _derivatives(m_c3_list.begin(), m_c3_list.end(), conc, rates, m_values);
         _derivatives(m_cn_list.begin(), m_cn_list.end(), conc, rates, m_values);
 
-        return Eigen::Map<Eigen::SparseMatrix<double>>(
+        return Eigen::Map<const Eigen::SparseMatrix<double>>(
             m_stoichCoeffs.cols(), m_stoichCoeffs.rows(), m_values.size(),
             m_outerIndices.data(), m_innerIndices.data(), m_values.data());
     }
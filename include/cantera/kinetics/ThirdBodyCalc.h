@@ -9,6 +9,7 @@
 #define CT_THIRDBODYCALC_H
 
 #include "cantera/base/ct_defs.h"
+#include "cantera/numerics/eigen_sparse.h"
 
 namespace Cantera
 {
@@ -31,52 +32,40 @@ public:
             m_no_mass_action_index.push_back(m_reaction_index.size() - 1);
         }
 
-        m_species.emplace_back();
-        m_eff.emplace_back();
         for (const auto& [k, efficiency] : efficiencies) {
             AssertTrace(k != npos);
-            m_species.back().push_back(k);
-            m_eff.back().push_back(efficiency - default_efficiency);
-            m_efficiencyList.emplace_back(
-                static_cast<int>(rxnNumber),
-                static_cast<int>(k), efficiency - default_efficiency);
+            m_species.push_back(k);
+            m_eff.push_back(efficiency - default_efficiency);
         }
+        m_offsets.push_back(m_species.size());
     }
 
-    //! Resize the sparse coefficient matrix
+    //! Set up the sparsity pattern of the derivative matrix
     void resizeCoeffs(size_t nSpc, size_t nRxn) {
-        // Sparse Efficiency coefficient matrix
-        Eigen::SparseMatrix<double> efficiencies;
-        efficiencies.setZero();
-        efficiencies.resize(nRxn, nSpc);
-        efficiencies.reserve(m_efficiencyList.size());
-        efficiencies.setFromTriplets(
-            m_efficiencyList.begin(), m_efficiencyList.end());
-
-        // derivative matrix multipliers
-        vector<Eigen::Triplet<double>> triplets;
-        triplets.reserve(m_reaction_index.size() * nSpc);
-        for (size_t i = 0; i < m_default.size(); i++) {
-            if (m_default[i] != 0) {
-                for (size_t j = 0; j < nSpc; j++) {
-                    triplets.emplace_back(
-                        static_cast<int>(m_reaction_index[i]),
-                        static_cast<int>(j), m_default[i]);
-                }
-            }
+        m_nSpecies = nSpc;
+        SparseTriplets triplets = derivativesPattern();
+        m_pattern.resize(nRxn, nSpc);
+        m_pattern.setFromTriplets(triplets.begin(), triplets.end());
+        m_pattern.makeCompressed();
+        m_patternIndex.resize(triplets.size());
+        for (size_t n = 0; n < triplets.size(); n++) {
+            m_patternIndex[n] = sparseStorageIndex(
+                m_pattern, triplets[n].row(), triplets[n].col());
         }
-        Eigen::SparseMatrix<double> defaults(nRxn, nSpc);
-        defaults.reserve(triplets.size());
-        defaults.setFromTriplets(triplets.begin(), triplets.end());
-        m_multipliers = efficiencies + defaults;
     }
 
     //! Update third-body concentrations in full vector
+    /*!
+     *  The effective concentration of reaction *i* is the product of the default
+     *  efficiency with the total concentration plus the sparse product of the
+     *  efficiency table with the species concentrations.
+     */
     void update(const vector<double>& conc, double ctot, double* concm) const {
+        const double* c = conc.data();
         for (size_t i = 0; i < m_reaction_index.size(); i++) {
             double sum = 0.0;
-            for (size_t j = 0; j < m_species[i].size(); j++) {
-                sum += m_eff[i][j] * conc[m_species[i][j]];
+            for (size_t n = m_offsets[i]; n < m_offsets[i + 1]; n++) {
+                sum += m_eff[n] * c[m_species[n]];
             }
             concm[m_reaction_index[i]] = m_default[i] * ctot + sum;
         }
@@ -94,9 +83,52 @@ public:
     /*!
      *  @param product   Product of law of mass action and rate terms.
      */
-    Eigen::SparseMatrix<double> derivatives(const double* product) {
-        Eigen::Map<const Eigen::VectorXd> mapped(product, m_multipliers.rows());
-        return mapped.asDiagonal() * m_multipliers;
+    Eigen::SparseMatrix<double> derivatives(const double* product) const {
+        Eigen::SparseMatrix<double> out = m_pattern;
+        addDerivatives(product, 1.0, m_patternIndex, out.valuePtr());
+        return out;
+    }
+
+    //! Add derivatives with respect to species concentrations to the values of a
+    //! sparse matrix with a fixed sparsity pattern.
+    /*!
+     *  @param product   Product of law of mass action and rate terms.
+     *  @param factor    Factor applied to all contributions.
+     *  @param index     Position within `values` for each entry returned by
+     *      derivativesPattern().
+     *  @param values    Values of the sparse output matrix.
+     *  @since New in %Cantera 3.2.
+     */
+    void addDerivatives(const double* product, double factor,
+                        const vector<int>& index, double* values) const
+    {
+        const int* ix = index.data();
+        for (size_t i = 0; i < m_reaction_index.size(); i++) {
+            double scale = factor * product[m_reaction_index[i]];
+            if (m_default[i] != 0) {
+                double value = scale * m_default[i];
+                for (size_t k = 0; k < m_nSpecies; k++) {
+                    values[*ix++] += value;
+                }
+            }
+            for (size_t n = m_offsets[i]; n < m_offsets[i + 1]; n++) {
+                values[*ix++] += scale * m_eff[n];
+            }
+        }
+    }
+
+    //! Entries (reaction index, species index) of the derivative matrix with
+    //! dimensions nReactions by nSpecies, in the order used by addDerivatives().
+    //! Entries may appear more than once.
+    //! @since New in %Cantera 3.2.
+    SparseTriplets derivativesPattern() const {
+        SparseTriplets triplets;
+        triplets.reserve(nDerivativeTerms());
+        forEachDerivativeTerm([&](size_t i, size_t k, double) {
+            triplets.emplace_back(static_cast<int>(m_reaction_index[i]),
+                                  static_cast<int>(k), 0.0);
+        });
+        return triplets;
     }
 
     //! Scale entries involving third-body collider in law of mass action by factor
@@ -124,6 +156,32 @@ public:
     }
 
 protected:
+    //! Number of terms contributing to the derivative matrix
+    size_t nDerivativeTerms() const {
+        size_t n = m_species.size();
+        for (double eff : m_default) {
+            n += (eff != 0) ? m_nSpecies : 0;
+        }
+        return n;
+    }
+
+    //! Call `func(i, k, multiplier)` for each term contributing to the derivative
+    //! of the effective concentration of third-body reaction *i* with respect to
+    //! the concentration of species *k*, in the order used by addDerivatives().
+    template<class F>
+    void forEachDerivativeTerm(F func) const {
+        for (size_t i = 0; i < m_reaction_index.size(); i++) {
+            if (m_default[i] != 0) {
+                for (size_t k = 0; k < m_nSpecies; k++) {
+                    func(i, k, m_default[i]);
+                }
+            }
+            for (size_t n = m_offsets[i]; n < m_offsets[i + 1]; n++) {
+                func(i, m_species[n], m_eff[n]);
+            }
+        }
+    }
+
     //! Indices of reactions that use third-bodies within vector of concentrations
     vector<size_t> m_reaction_index;
 
@@ -135,21 +193,29 @@ protected:
     //! in the rate expression
     vector<size_t> m_no_mass_action_index;
 
-    //! m_species[i][j] is the index of the j-th species in reaction i.
-    vector<vector<size_t>> m_species;
+    //! Efficiency table in compressed sparse row format, where row *i* holds the
+    //! species with non-default efficiencies for the *i*-th entry of
+    //! #m_reaction_index. Entries of row *i* are stored at positions
+    //! `m_offsets[i]` to `m_offsets[i+1] - 1` of #m_species and #m_eff.
+    vector<size_t> m_offsets = {0};
 
-    //! m_eff[i][j] is the efficiency of the j-th species in reaction i.
-    vector<vector<double>> m_eff;
+    //! Species index for each entry of the efficiency table
+    vector<size_t> m_species;
+
+    //! Efficiency for each entry of the efficiency table, relative to the default
+    //! efficiency of the corresponding reaction
+    vector<double> m_eff;
 
     //! The default efficiency for each reaction
     vector<double> m_default;
 
-    //! Sparse efficiency matrix (compensated for defaults)
-    //! Each triplet corresponds to (reaction index, species index, efficiency)
-    vector<Eigen::Triplet<double>> m_efficiencyList;
+    size_t m_nSpecies = 0; //!< Number of species (columns of derivative matrix)
+
+    //! Sparsity pattern of the derivative matrix, with zero values
+    Eigen::SparseMatrix<double> m_pattern;
 
-    //! Sparse derivative multiplier matrix
-    Eigen::SparseMatrix<double> m_multipliers;
+    //! Position within #m_pattern for each entry returned by derivativesPattern()
+    vector<int> m_patternIndex;
 };
 
 }
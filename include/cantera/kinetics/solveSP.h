@@ -11,6 +11,7 @@
 
 #include "cantera/kinetics/InterfaceKinetics.h"
 #include "cantera/numerics/DenseMatrix.h"
+#include "cantera/numerics/eigen_dense.h"
 
 //! @defgroup solvesp_methods Surface Problem Solver Methods
 //! @ingroup surfSolverGroup
@@ -135,10 +136,20 @@ namespace Cantera
  *  in this Newton iteration compared to that in the nonlinear solver. A value
  *  of 0.1 is used so surface species are safely overconverged.
  *
- *  Functions called:
- *  - `ct_dgetrf` -- First half of LAPACK direct solve of a full Matrix
- *  - `ct_dgetrs` -- Second half of LAPACK direct solve of a full matrix.
- *    Returns solution vector in the right-hand-side vector, resid.
+ *  ### Jacobian evaluation
+ *  The Jacobian is assembled from the analytic derivatives of the net
+ *  production rates with respect to the species concentrations, provided by
+ *  InterfaceKinetics::netProductionRates_ddCi(). If these derivatives are not
+ *  available, for example for mechanisms with coverage dependent or
+ *  electrochemical reactions, the Jacobian is evaluated column by column using
+ *  finite differences.
+ *
+ *  The LU factorization of the Jacobian is reused for subsequent iterations as
+ *  long as the Newton iteration converges rapidly, the pseudo time step does not
+ *  change by more than a factor of two, and no damping is required. Since the
+ *  converged surface state is retained by the surface phases, a subsequent call
+ *  at the same temperature and pressure starts from the previous solution and
+ *  may also start with the previous factorization.
  */
 class solveSP
 {
@@ -304,6 +315,34 @@ private:
                      const double* CSolnSPOld, const bool do_time,
                      const double deltaT);
 
+    //! Evaluate the Jacobian from the analytic derivatives of the species net
+    //! production rates with respect to the species concentrations provided by
+    //! the InterfaceKinetics objects.
+    /*!
+     *  The residual must have been evaluated at the current solution before this
+     *  method is called.
+     *
+     *  @param jac     Jacobian to be evaluated.
+     *  @param do_time Calculate a time dependent Jacobian
+     *  @param deltaT  Delta time for time dependent problem.
+     *  @returns `false` if the derivatives are not available for one of the
+     *      kinetics objects, for example due to coverage dependent or
+     *      electrochemical reactions. In this case, the Jacobian needs to be
+     *      evaluated using finite differences.
+     */
+    bool analyticJacobian(DenseMatrix& jac, const bool do_time, const double deltaT);
+
+    //! Returns `true` if the current LU factorization of the Jacobian can be used
+    //! for the next Newton iteration instead of evaluating a new Jacobian.
+    /*!
+     *  @param inv_t  Inverse of the time step for the next iteration
+     *  @param damp   Damping factor applied in the previous iteration
+     *  @param update_norm  Norm of the update in the previous iteration
+     *  @param update_norm_old  Norm of the update in the iteration before that
+     */
+    bool canReuseJacobian(double inv_t, double damp, double update_norm,
+                          double update_norm_old) const;
+
     //! Vector of interface kinetics objects
     /*!
      * Each of these is associated with one and only one surface phase.
@@ -479,6 +518,43 @@ private:
     //! Newton's method.
     DenseMatrix m_Jac;
 
+    //! For each InterfaceKinetics object, the index in the solution vector of
+    //! each kinetic species, or @ref npos if the species is not an unknown of
+    //! the surface problem. Used to map the analytic rate derivatives onto the
+    //! Jacobian.
+    vector<vector<size_t>> m_kinEqnIndex;
+
+    //! Set to `false` if the analytic rate derivatives are unavailable, in which
+    //! case the Jacobian is always evaluated using finite differences
+    bool m_analyticJac = true;
+
+    //! LU factorization of #m_Jac, which may be reused for several iterations
+    //! of the Newton method and across calls to solveSurfProb()
+    Eigen::PartialPivLU<Eigen::MatrixXd> m_jacLU;
+
+    //! `true` if #m_jacLU holds a valid factorization
+    bool m_jacFactored = false;
+
+    //! Number of Newton iterations that have used the current factorization
+    int m_jacAge = 0;
+
+    //! Maximum number of Newton iterations that may use the same factorization
+    int m_maxJacAge = 5;
+
+    //! Inverse time step used when evaluating the factored Jacobian
+    double m_jacInvT = 0.0;
+
+    //! Temperature [K] at which the factored Jacobian was evaluated
+    double m_jacTemperature = 0.0;
+
+    //! Pressure [Pa] at which the factored Jacobian was evaluated
+    double m_jacPressure = 0.0;
+
+    //! Largest species in each surface phase when the factored Jacobian was
+    //! evaluated. These determine which rows of the Jacobian hold the site
+    //! conservation equations.
+    vector<size_t> m_jacSurfLarge;
+
 public:
     int m_ioflag = 0;
 };
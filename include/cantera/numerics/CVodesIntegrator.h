@@ -71,6 +71,11 @@ public:
         return static_cast<int>(m_np);
     }
     double sensitivity(size_t k, size_t p) override;
+    void setAdjointCheckpointSteps(int nsteps) override {
+        m_adjointSteps = nsteps;
+    }
+    void integrateAdjoint(const double* lambda, double* lambda0,
+                          double* dgdp) override;
 
     //! Returns a string listing the weighted error estimates associated
     //! with each solution component.
@@ -89,6 +94,17 @@ protected:
 private:
     void sensInit(double t0, FuncEval& func);
 
+    //! Take a single step of the forward problem towards *tout*, storing checkpoints
+    //! if adjoint sensitivity analysis is enabled. Returns the CVODES flag.
+    int stepForward(double tout);
+
+    //! Set up the backward problem used for adjoint sensitivity analysis, with
+    //! initial values taken from #m_yB and #m_qB.
+    void adjointInit();
+
+    //! Free the backward problem and associated linear solver objects
+    void adjointFree();
+
     //! Check whether a CVODES method indicated an error. If so, throw an exception
     //! containing the method name and the error code stashed by the cvodes_err() function.
     void checkError(long flag, const string& ctMethod, const string& cvodesMethod) const;
@@ -132,6 +148,16 @@ private:
     //! Indicates whether the sensitivities stored in m_yS have been updated
     //! for at the current integrator time.
     bool m_sens_ok = false;
+
+    //! Number of integrator steps between checkpoints used for adjoint sensitivity
+    //! analysis. Zero if adjoint sensitivity analysis is disabled.
+    int m_adjointSteps = 0;
+    bool m_adjoint = false; //!< Indicates whether CVODES adjoint memory is allocated
+    int m_indexB = -1; //!< CVODES identifier of the backward problem
+    N_Vector m_yB = nullptr; //!< Adjoint variables
+    N_Vector m_qB = nullptr; //!< Quadrature of the adjoint sensitivity integrand
+    void* m_linsolB = nullptr; //!< Linear solver object for the backward problem
+    void* m_linsol_matrixB = nullptr; //!< Matrix used by #m_linsolB
 };
 
 } // namespace
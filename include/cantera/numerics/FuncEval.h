@@ -137,6 +137,74 @@ public:
      */
     int preconditioner_solve_nothrow(double* rhs, double* output);
 
+    /**
+     * Evaluate the right-hand side of the adjoint equations,
+     * @f$ \dot{\lambda} = -J^T \lambda @f$, where @f$ J @f$ is the Jacobian of
+     * the right-hand side of eval() with respect to the solution vector.
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[in] lambda adjoint variables, length neq()
+     * @param[out] lambdaDot rate of change of the adjoint variables, length neq()
+     * @warning This function is an experimental part of the %Cantera API and may be
+     * changed or removed without notice.
+     * @since New in %Cantera 3.2.
+     */
+    virtual void evalAdjoint(double t, double* y, double* lambda, double* lambdaDot) {
+        throw NotImplementedError("FuncEval::evalAdjoint");
+    }
+
+    /**
+     * Evaluate the integrand of the adjoint sensitivity quadrature,
+     * @f$ -\lambda^T \partial f / \partial p @f$, where @f$ f @f$ is the
+     * right-hand side of eval() and @f$ p @f$ is the vector of sensitivity
+     * parameters.
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[in] lambda adjoint variables, length neq()
+     * @param[out] qDot integrand, length nparams()
+     * @warning This function is an experimental part of the %Cantera API and may be
+     * changed or removed without notice.
+     * @since New in %Cantera 3.2.
+     */
+    virtual void evalAdjointQuadrature(double t, double* y, double* lambda,
+                                       double* qDot) {
+        throw NotImplementedError("FuncEval::evalAdjointQuadrature");
+    }
+
+    /**
+     * Evaluate the Jacobian of the right-hand side of the adjoint equations with
+     * respect to the adjoint variables, @f$ -J^T @f$, where @f$ J @f$ is the
+     * Jacobian of the right-hand side of eval().
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[out] jacB dense matrix stored in column-major order, size neq() by
+     *     neq(). Only nonzero elements are set.
+     * @warning This function is an experimental part of the %Cantera API and may be
+     * changed or removed without notice.
+     * @since New in %Cantera 3.2.
+     */
+    virtual void evalAdjointJacobian(double t, double* y, double* jacB) {
+        throw NotImplementedError("FuncEval::evalAdjointJacobian");
+    }
+
+    //! Evaluate the right-hand side of the adjoint equations using return code to
+    //! indicate status. Used when calling from a C-based integrator.
+    //! @see evalNoThrow(), evalAdjoint()
+    //! @since New in %Cantera 3.2.
+    int evalAdjointNoThrow(double t, double* y, double* lambda, double* lambdaDot);
+
+    //! Evaluate the integrand of the adjoint sensitivity quadrature using return
+    //! code to indicate status. Used when calling from a C-based integrator.
+    //! @see evalNoThrow(), evalAdjointQuadrature()
+    //! @since New in %Cantera 3.2.
+    int evalAdjointQuadratureNoThrow(double t, double* y, double* lambda, double* qDot);
+
+    //! Evaluate the Jacobian of the adjoint equations using return code to indicate
+    //! status. Used when calling from a C-based integrator.
+    //! @see evalNoThrow(), evalAdjointJacobian()
+    //! @since New in %Cantera 3.2.
+    int evalAdjointJacobianNoThrow(double t, double* y, double* jacB);
+
     //! Fill in the vector *y* with the current state of the system.
     //! Used for getting the initial state for ODE systems.
     virtual void getState(double* y) {
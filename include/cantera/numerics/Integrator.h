@@ -261,6 +261,34 @@ public:
         return 0.0;
     }
 
+    //! Enable adjoint sensitivity analysis by storing checkpoints of the forward
+    //! solution every *nsteps* integrator steps. A value of zero disables adjoint
+    //! sensitivity analysis. Takes effect the next time the integrator is
+    //! initialized, in which case forward sensitivities are not computed.
+    //! @warning This function is an experimental part of the %Cantera API and may be
+    //! changed or removed without notice.
+    //! @since New in %Cantera 3.2.
+    virtual void setAdjointCheckpointSteps(int nsteps) {
+        warn("setAdjointCheckpointSteps");
+    }
+
+    //! Integrate the adjoint equations backward from the current time to the
+    //! initial time, and evaluate the derivatives of a scalar objective function of
+    //! the solution at the current time with respect to the sensitivity parameters.
+    //! @param[in] lambda  Derivatives of the objective function with respect to the
+    //!     solution vector at the current time, length nEquations()
+    //! @param[out] lambda0  Values of the adjoint variables at the initial time,
+    //!     length nEquations()
+    //! @param[out] dgdp  Derivatives of the objective function with respect to the
+    //!     sensitivity parameters, length FuncEval::nparams()
+    //! @warning This function is an experimental part of the %Cantera API and may be
+    //! changed or removed without notice.
+    //! @since New in %Cantera 3.2.
+    virtual void integrateAdjoint(const double* lambda, double* lambda0,
+                                  double* dgdp) {
+        throw NotImplementedError("Integrator::integrateAdjoint");
+    }
+
     //! Get solver stats from integrator
     virtual AnyMap solverStats() const {
         AnyMap stats;
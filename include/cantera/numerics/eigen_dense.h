@@ -27,6 +27,9 @@ typedef Eigen::Map<Eigen::VectorXd> MappedVector;
 typedef Eigen::Map<const Eigen::VectorXd> ConstMappedVector;
 typedef Eigen::Map<Eigen::RowVectorXd> MappedRowVector;
 typedef Eigen::Map<const Eigen::RowVectorXd> ConstMappedRowVector;
+typedef Eigen::Map<Eigen::VectorXd, 0, Eigen::InnerStride<>> StridedVector;
+typedef Eigen::Map<Eigen::MatrixXd, 0,
+                   Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>> StridedMatrix;
 
 //! @}
 
@@ -5,6 +5,8 @@
 #define CT_EIGEN_SPARSE_H
 
 #include "cantera/base/config.h"
+#include <algorithm>
+#include <vector>
 #if CT_USE_SYSTEM_EIGEN
     #if CT_USE_SYSTEM_EIGEN_PREFIXED
     #include <eigen3/Eigen/Sparse>
@@ -19,6 +21,41 @@ namespace Cantera
 {
 //! @ingroup matrices
 typedef std::vector<Eigen::Triplet<double>> SparseTriplets;
+
+//! Check whether two compressed sparse matrices have the same dimensions and
+//! sparsity pattern.
+//! @ingroup matrices
+//! @since New in %Cantera 3.2.
+inline bool sameSparsityPattern(const Eigen::SparseMatrix<double>& a,
+                                const Eigen::SparseMatrix<double>& b)
+{
+    if (a.rows() != b.rows() || a.cols() != b.cols() || !a.isCompressed()
+        || !b.isCompressed() || a.nonZeros() != b.nonZeros())
+    {
+        return false;
+    }
+    return std::equal(a.outerIndexPtr(), a.outerIndexPtr() + a.outerSize() + 1,
+                      b.outerIndexPtr())
+        && std::equal(a.innerIndexPtr(), a.innerIndexPtr() + a.nonZeros(),
+                      b.innerIndexPtr());
+}
+
+//! Find the position of an entry within the value array of a compressed,
+//! column-major sparse matrix.
+//! @return  index into `mat.valuePtr()`, or -1 if the entry is not part of the
+//!     sparsity pattern.
+//! @ingroup matrices
+//! @since New in %Cantera 3.2.
+inline int sparseStorageIndex(const Eigen::SparseMatrix<double>& mat, int row, int col)
+{
+    const int* begin = mat.innerIndexPtr() + mat.outerIndexPtr()[col];
+    const int* end = mat.innerIndexPtr() + mat.outerIndexPtr()[col + 1];
+    const int* it = std::lower_bound(begin, end, row);
+    if (it == end || *it != row) {
+        return -1;
+    }
+    return static_cast<int>(it - mat.innerIndexPtr());
+}
 }
 
 #endif
@@ -305,6 +305,17 @@ public:
      * @f]
      */
     void getStandardChemPotentials(double* mu0) const override;
+
+    //! Get the derivatives of the standard state chemical potentials with
+    //! respect to the surface coverages at constant temperature. Units: J/kmol.
+    /*!
+     * @param[out] dmu0  Array of length `nSpecies()*nSpecies()`, where element
+     *     `dmu0[k + nSpecies()*j]` is set to
+     *     @f$ \partial \mu^o_k / \partial \theta_j @f$.
+     *
+     * @since New in %Cantera 3.2.
+     */
+    void getStandardChemPotentials_ddCov(double* dmu0) const;
     //! @}
 
     //! @name Methods calculating partial molar thermodynamic properties
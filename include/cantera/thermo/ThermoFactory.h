@@ -70,7 +70,7 @@ shared_ptr<ThermoPhase> newThermo(const AnyMap& phaseNode,
 
 //! Create and Initialize a ThermoPhase object from an input file.
 /*!
- * This function uses AnyMap::fromYamlFile() to read the input file, newThermo()
+ * This function uses AnyMap::sharedYamlFile() to read the input file, newThermo()
  * to create an empty ThermoPhase of the appropriate type, and setupPhase() to
  * initialize the phase.
  *
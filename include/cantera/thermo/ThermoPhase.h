@@ -20,6 +20,8 @@
 namespace Cantera
 {
 
+class ChemEquil;
+
 /**
  * @defgroup thermoprops Thermodynamic Properties
  *
@@ -394,7 +396,8 @@ class ThermoPhase : public Phase
 public:
     //! Constructor. Note that ThermoPhase is meant to be used as a base class,
     //! so this constructor should not be called explicitly.
-    ThermoPhase() = default;
+    ThermoPhase();
+    ~ThermoPhase() override;
 
     //! @name  Information Methods
     //! @{
@@ -1694,13 +1697,14 @@ public:
      *      If solver = 'element_potential', the ChemEquil element potential
      *      solver will be used. If solver = 'vcs', the VCS solver will be used.
      *      If solver = 'gibbs', the MultiPhaseEquil solver will be used. If
-     *      solver = 'auto', the solvers will be tried in order if the initial
-     *      solver(s) fail.
+     *      solver = 'interior_point', the InteriorPointEquil solver will be
+     *      used. If solver = 'auto', the solvers will be tried in order if the
+     *      initial solver(s) fail.
      *  @param rtol      Relative tolerance
      *  @param max_steps Maximum number of steps to take to find the solution
-     *  @param max_iter  For the 'gibbs' and 'vcs' solvers, this is the maximum
-     *      number of outer temperature or pressure iterations to take when T
-     *      and/or P is not held fixed.
+     *  @param max_iter  For the 'gibbs', 'interior_point' and 'vcs' solvers,
+     *      this is the maximum number of outer temperature or pressure
+     *      iterations to take when T and/or P is not held fixed.
      *  @param estimate_equil For MultiPhaseEquil solver, an integer indicating
      *      whether the solver should estimate its own initial condition. If 0,
      *      the initial mole fraction vector in the ThermoPhase object is used
@@ -1711,6 +1715,12 @@ public:
      *      log_level=0 suppresses diagnostics, and increasingly-verbose
      *      messages are written as loglevel increases.
      *
+     * The ChemEquil solver used for the 'element_potential' and 'auto' options
+     * is retained between calls. Its Newton iteration is started from the
+     * element potentials found by the previous successful call, which reduces
+     * the cost of repeated calculations at nearby states. If this fails, the
+     * calculation is restarted from an estimated initial state.
+     *
      * @ingroup equilGroup
      */
     void equilibrate(const string& XY, const string& solver="auto",
@@ -2070,6 +2080,11 @@ protected:
 
     //! reference to Solution
     std::weak_ptr<Solution> m_soln;
+
+    //! Element potential equilibrium solver used by equilibrate(). Retained
+    //! between calls so that its workspace and the last converged solution can
+    //! be reused as the starting point for the next calculation.
+    unique_ptr<ChemEquil> m_equil;
 };
 
 }
@@ -36,6 +36,8 @@ public:
 
     void eval(double t, double* LHS, double* RHS) override;
 
+    void getProductionRateAdjoint(const double* lambda, double* out) override;
+
     void updateState(double* y) override;
 
 protected:
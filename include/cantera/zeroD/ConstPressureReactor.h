@@ -34,6 +34,8 @@ public:
     void initialize(double t0=0.0) override;
     void eval(double t, double* LHS, double* RHS) override;
 
+    void getProductionRateAdjoint(const double* lambda, double* out) override;
+
     void updateState(double* y) override;
 
     //! Return the index in the solution vector for this reactor of the
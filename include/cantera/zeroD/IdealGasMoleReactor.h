@@ -36,6 +36,8 @@ public:
 
     void eval(double t, double* LHS, double* RHS) override;
 
+    void getProductionRateAdjoint(const double* lambda, double* out) override;
+
     void updateState(double* y) override;
 
     //! Calculate an approximate Jacobian to accelerate preconditioned solvers
@@ -47,6 +49,14 @@ public:
 
     bool preconditionerSupported() const override {return true;};
 
+    //! The Jacobian is exact for a reactor without walls, flow devices, and
+    //! surfaces if the derivatives of the rates of progress are not simplified
+    //! and none of the rates depend on pressure.
+    //!
+    //! Derivatives with respect to the volume are omitted, which does not affect
+    //! the other components since the volume is constant in this case.
+    bool jacobianIsExact() const override;
+
 protected:
     void setThermo(ThermoPhase& thermo) override;
 
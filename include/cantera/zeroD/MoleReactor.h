@@ -34,6 +34,8 @@ public:
 
     void eval(double t, double* LHS, double* RHS) override;
 
+    void getProductionRateAdjoint(const double* lambda, double* out) override;
+
     size_t componentIndex(const string& nm) const override;
 
     string componentName(size_t k) override;
@@ -60,6 +62,10 @@ protected:
 
     //! const value for the species start index
     const size_t m_sidx = 2;
+
+    //! Buffer for derivatives of species production rates with respect to species
+    //! concentrations, which keeps its sparsity pattern between Jacobian evaluations
+    Eigen::SparseMatrix<double> m_dnk_dnj;
 };
 
 }
@@ -218,6 +218,36 @@ public:
     //! Reset the reaction rate multipliers
     virtual void resetSensitivity(double* params);
 
+    //! Multiply the transposed derivatives of the governing equations with respect
+    //! to the net production rates of the gas phase species with *lambda*.
+    //!
+    //! The state of the reactor must have been set using updateState(). Used for
+    //! adjoint sensitivity analysis.
+    //! @param[in] lambda  Adjoint variables of this reactor, length neq()
+    //! @param[out] out  Values of @f$ \sum_j \lambda_j \partial \dot{y}_j /
+    //!     \partial \dot{\omega}_k @f$ for each gas phase species *k*
+    //!
+    //! @warning  This method is an experimental part of the %Cantera
+    //! API and may be changed or removed without notice.
+    //! @since New in %Cantera 3.2.
+    virtual void getProductionRateAdjoint(const double* lambda, double* out);
+
+    //! Add the derivatives of @f$ \lambda^T \dot{y} @f$ with respect to the
+    //! reaction sensitivity parameters of this reactor to *dgdp*.
+    //!
+    //! The derivatives of the net rates of progress with respect to the rate
+    //! multipliers are evaluated analytically, so the cost is independent of the
+    //! number of parameters. The state of the reactor must have been set using
+    //! updateState(). Used for adjoint sensitivity analysis.
+    //! @param[in] lambda  Adjoint variables of this reactor, length neq()
+    //! @param[in,out] dgdp  Derivatives with respect to all sensitivity parameters of
+    //!     the reactor network, indexed by the global parameter index
+    //!
+    //! @warning  This method is an experimental part of the %Cantera
+    //! API and may be changed or removed without notice.
+    //! @since New in %Cantera 3.2.
+    void addAdjointSensitivities(const double* lambda, double* dgdp);
+
     //! Return a false if preconditioning is not supported or true otherwise.
     //!
     //! @warning  This method is an experimental part of the %Cantera
@@ -227,6 +257,16 @@ public:
     //!
     virtual bool preconditionerSupported() const {return false;};
 
+    //! Return true if jacobian() is exact for the current configuration of the
+    //! reactor, rather than an approximation suitable only for preconditioning.
+    //!
+    //! Used to evaluate the adjoint equations without finite differences.
+    //!
+    //! @warning  This method is an experimental part of the %Cantera
+    //! API and may be changed or removed without notice.
+    //! @since New in %Cantera 3.2.
+    virtual bool jacobianIsExact() const {return false;};
+
 protected:
     void setKinetics(Kinetics& kin) override;
 
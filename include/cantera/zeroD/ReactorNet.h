@@ -78,6 +78,29 @@ public:
     //! sensitivity equations.
     void setSensitivityTolerances(double rtol, double atol);
 
+    //! Set the method used to compute sensitivities with respect to the registered
+    //! sensitivity parameters.
+    /*!
+     *  Options are `"forward"` (default), where the sensitivity of every state
+     *  variable is integrated together with the state, and `"adjoint"`, where the
+     *  forward integration only stores checkpoints and the sensitivities of a single
+     *  scalar function of the final state are obtained afterwards from
+     *  adjointSensitivities(). The adjoint method is much cheaper when the number of
+     *  parameters is large, but is currently limited to reaction rate multipliers
+     *  of reactors integrated with CVODES.
+     *
+     *  @warning This method is an experimental part of the %Cantera API and may be
+     *      changed or removed without notice.
+     *  @since New in %Cantera 3.2.
+     */
+    void setSensitivityMethod(const string& method);
+
+    //! The method used to compute sensitivities; see setSensitivityMethod().
+    //! @since New in %Cantera 3.2.
+    const string& sensitivityMethod() const {
+        return m_sensitivityMethod;
+    }
+
     //! Current value of the simulation time [s], for reactor networks that are solved
     //! in the time domain.
     double time();
@@ -181,6 +204,9 @@ public:
      *  For species enthalpy sensitivities, the parameter is a perturbation to
      *  the molar enthalpy of formation, such that the dimensions of the
      *  sensitivity are kmol/J.
+     *
+     *  Forward sensitivities are not available if the sensitivity method is
+     *  `"adjoint"`; use adjointSensitivities() instead.
      */
     double sensitivity(size_t k, size_t p);
 
@@ -192,6 +218,29 @@ public:
         return sensitivity(k, p);
     }
 
+    //! Compute the sensitivities of a scalar function of the current state with
+    //! respect to all sensitivity parameters using the adjoint method.
+    /*!
+     *  Integrates the adjoint equations backward from the current time to the
+     *  time where the integration was (re)initialized. Requires the sensitivity
+     *  method to be set to `"adjoint"` before the forward integration.
+     *
+     *  @param dgdy  Derivative of the scalar function @f$ G(y) @f$ with respect to
+     *      each component of the global state vector, length neq().
+     *  @returns The unnormalized sensitivities @f$ dG/dp @f$ for each parameter
+     *      in the order they were registered, length nparams().
+     *
+     *  This method can be called repeatedly to evaluate the sensitivities of
+     *  several functions of the same forward solution. Continuing the integration
+     *  afterwards restarts the forward problem from the current state, so later
+     *  adjoint sensitivities are relative to that state.
+     *
+     *  @warning This method is an experimental part of the %Cantera API and may be
+     *      changed or removed without notice.
+     *  @since New in %Cantera 3.2.
+     */
+    vector<double> adjointSensitivities(const vector<double>& dgdy);
+
     //! Evaluate the Jacobian matrix for the reactor network.
     /*!
      *  @param[in] t Time/distance at which to evaluate the Jacobian
@@ -219,6 +268,16 @@ public:
     void evalDae(double t, double* y, double* ydot, double* p,
                  double* residual) override;
 
+    //! Right-hand side of the adjoint equations, using the Jacobian assembled by
+    //! updateAdjointJacobian(), which is reused while the forward state does not
+    //! change.
+    void evalAdjoint(double t, double* y, double* lambda, double* lambdaDot) override;
+
+    void evalAdjointQuadrature(double t, double* y, double* lambda,
+                               double* qDot) override;
+
+    void evalAdjointJacobian(double t, double* y, double* jacB) override;
+
     void getState(double* y) override;
     void getStateDae(double* y, double* ydot) override;
 
@@ -305,6 +364,13 @@ protected:
 
     void updatePreconditioner(double gamma) override;
 
+    //! Update #m_adjointJac for the state *y* at time *t* if either has changed
+    //! since the last evaluation.
+    //!
+    //! The Jacobians of the individual reactors are used if they are all exact.
+    //! Otherwise, the Jacobian of the network is evaluated by finite differences.
+    void updateAdjointJacobian(double t, double* y);
+
     //! Create reproducible names for reactors and walls/connectors.
     void updateNames(Reactor& r);
 
@@ -331,6 +397,11 @@ protected:
 
     bool m_init = false;
     bool m_integrator_init = false; //!< True if integrator initialization is current
+
+    //! True if the adjoint equations were integrated since the forward problem was
+    //! last initialized, which requires a restart before the forward integration
+    //! can continue
+    bool m_adjointReinit = false;
     size_t m_nv = 0;
 
     //! m_start[n] is the starting point in the state vector for reactor n
@@ -341,6 +412,25 @@ protected:
     double m_rtolsens = 1.0e-4;
     double m_atols = 1.0e-15;
     double m_atolsens = 1.0e-6;
+
+    //! Method used for computing sensitivities; either "forward" or "adjoint"
+    string m_sensitivityMethod = "forward";
+
+    //! Number of integration steps between checkpoints stored for the adjoint
+    //! sensitivity analysis
+    int m_adjointCheckpointSteps = 100;
+
+    //! Cached Jacobian used for the adjoint equations, evaluated at #m_adjointTime
+    //! and #m_adjointState
+    Eigen::SparseMatrix<double> m_adjointJac;
+    //! Work array for the finite difference Jacobian of the adjoint equations
+    unique_ptr<Array2D> m_adjointFDJac;
+    //! True if the adjoint equations use the Jacobians of the individual reactors
+    //! rather than a finite difference Jacobian
+    bool m_adjointExactJac = false;
+    double m_adjointTime = NAN;
+    vector<double> m_adjointState;
+    vector<double> m_adjointYdot;
     shared_ptr<SystemJacobian> m_precon;
     string m_linearSolverType;
 
@@ -595,7 +595,8 @@ struct convert<Cantera::AnyValue> {
 namespace Cantera {
 
 std::unordered_map<string,
-                   pair<AnyMap, std::filesystem::file_time_type>> AnyMap::s_cache;
+    pair<std::shared_future<shared_ptr<const AnyMap>>,
+         std::filesystem::file_time_type>> AnyMap::s_cache;
 
 std::unordered_map<string, vector<string>> AnyMap::s_headFields;
 std::unordered_map<string, vector<string>> AnyMap::s_tailFields;
@@ -1816,9 +1817,8 @@ bool AnyMap::addOrderingRules(const string& objectType,
 void AnyMap::clearCachedFile(const string& filename)
 {
     string fullName = findInputFile(filename);
-    if (s_cache.count(fullName)) {
-        s_cache.erase(fullName);
-    }
+    std::unique_lock<std::mutex> lock(yaml_cache_mutex);
+    s_cache.erase(fullName);
 }
 
 AnyMap AnyMap::fromYamlString(const string& yaml) {
@@ -1839,6 +1839,13 @@ AnyMap AnyMap::fromYamlString(const string& yaml) {
 }
 
 AnyMap AnyMap::fromYamlFile(const string& name, const string& parent_name)
+{
+    // Return a copy of the cached AnyMap
+    return *sharedYamlFile(name, parent_name);
+}
+
+shared_ptr<const AnyMap> AnyMap::sharedYamlFile(const string& name,
+                                                const string& parent_name)
 {
     string fullName;
     // See if a file with this name exists in a path relative to the parent file
@@ -1854,47 +1861,63 @@ AnyMap AnyMap::fromYamlFile(const string& name, const string& parent_name)
         fullName = findInputFile(name);
     }
 
-    // Check for an already-parsed YAML file with the same last-modified time,
-    // and return that if possible
+    // Check for an already-parsed (or currently being parsed) YAML file with the
+    // same last-modified time, and return that if possible. Otherwise, register
+    // this thread as the one responsible for parsing the file. The lock is only
+    // held while accessing the cache, so different files can be parsed
+    // concurrently.
     auto mtime = std::filesystem::last_write_time(fullName);
-    std::unique_lock<std::mutex> lock(yaml_cache_mutex);
-    auto iter = s_cache.find(fullName);
-    if (iter != s_cache.end() && iter->second.second == mtime) {
-        return iter->second.first;
-    }
-
-    if (!std::ifstream(fullName).good()) {
-        throw CanteraError("AnyMap::fromYamlFile", "Input file '{}' not found "
-            "on the Cantera search path.", name);
+    std::promise<shared_ptr<const AnyMap>> promise;
+    {
+        std::unique_lock<std::mutex> lock(yaml_cache_mutex);
+        auto iter = s_cache.find(fullName);
+        if (iter != s_cache.end() && iter->second.second == mtime) {
+            auto pending = iter->second.first;
+            lock.unlock();
+            // Rethrows any exception raised while parsing the file
+            return pending.get();
+        }
+        s_cache[fullName] = {promise.get_future().share(), mtime};
     }
 
-    // Generate an AnyMap from the YAML file and store it in the cache
-    auto& [cache_item, cache_time] = s_cache[fullName];
-    cache_time = mtime;
+    // Generate an AnyMap from the YAML file and make it available to any other
+    // threads waiting for it
+    auto item = make_shared<AnyMap>();
     try {
-        YAML::Node node = YAML::LoadFile(fullName);
-        cache_item = node.as<AnyMap>();
-        cache_item.setMetadata("filename", AnyValue(fullName));
-        cache_item.applyUnits();
-    } catch (YAML::Exception& err) {
-        s_cache.erase(fullName);
-        AnyMap fake;
-        fake.setLoc(err.mark.line, err.mark.column);
-        fake.setMetadata("filename", AnyValue(fullName));
-        throw InputFileError("AnyMap::fromYamlFile", fake, err.msg);
-    } catch (CanteraError&) {
-        s_cache.erase(fullName);
+        if (!std::ifstream(fullName).good()) {
+            throw CanteraError("AnyMap::fromYamlFile", "Input file '{}' not found "
+                "on the Cantera search path.", name);
+        }
+        try {
+            YAML::Node node = YAML::LoadFile(fullName);
+            *item = node.as<AnyMap>();
+            item->setMetadata("filename", AnyValue(fullName));
+            item->applyUnits();
+        } catch (YAML::Exception& err) {
+            AnyMap fake;
+            fake.setLoc(err.mark.line, err.mark.column);
+            fake.setMetadata("filename", AnyValue(fullName));
+            throw InputFileError("AnyMap::fromYamlFile", fake, err.msg);
+        }
+        (*item)["__file__"] = fullName;
+        item->setLoc(0, 0);
+    } catch (...) {
+        {
+            std::unique_lock<std::mutex> lock(yaml_cache_mutex);
+            auto iter = s_cache.find(fullName);
+            if (iter != s_cache.end() && iter->second.second == mtime) {
+                s_cache.erase(iter);
+            }
+        }
+        promise.set_exception(std::current_exception());
         throw;
     }
-    cache_item["__file__"] = fullName;
-    cache_item.setLoc(0, 0);
+    promise.set_value(item);
 
-    if (cache_item.hasKey("deprecated")) {
-        warn_deprecated(fullName, cache_item["deprecated"].asString());
+    if (item->hasKey("deprecated")) {
+        warn_deprecated(fullName, item->at("deprecated").asString());
     }
-
-    // Return a copy of the AnyMap
-    return cache_item;
+    return item;
 }
 
 string AnyMap::toYamlString() const
@@ -0,0 +1,840 @@
+//! @file BinaryMechanism.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/BinaryMechanism.h"
+#include "cantera/base/AnyMap.h"
+#include "cantera/base/Array.h"
+#include "cantera/base/Interface.h"
+#include "cantera/base/Solution.h"
+#include "cantera/base/global.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/thermo/VPStandardStateTP.h"
+#include "cantera/thermo/Species.h"
+#include "cantera/thermo/SpeciesThermoFactory.h"
+#include "cantera/thermo/SpeciesThermoInterpType.h"
+#include "cantera/thermo/speciesThermoTypes.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/KineticsFactory.h"
+#include "cantera/kinetics/Reaction.h"
+#include "cantera/kinetics/Arrhenius.h"
+#include "cantera/kinetics/Falloff.h"
+#include "cantera/kinetics/PlogRate.h"
+#include "cantera/kinetics/ChebyshevRate.h"
+#include "cantera/transport/TransportData.h"
+
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+#ifdef _WIN32
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Cantera
+{
+
+namespace {
+
+//! Identifies binary mechanism files
+const char binaryMagic[8] = {'C', 'T', 'M', 'E', 'C', 'H', '\0', '\0'};
+
+//! Version of the binary mechanism format. Must be incremented whenever the
+//! layout of the file changes.
+const uint32_t binaryVersion = 1;
+
+//! Used to detect files written on machines with a different byte order
+const uint32_t byteOrderMark = 0x01020304;
+
+//! Storage of a species or reaction in the binary file
+enum BinaryItem : int32_t {
+    yamlItem = 0, //!< Stored as embedded YAML
+    flatSpecies = 1, //!< Species stored in flat arrays
+    arrheniusReaction = 2, //!< Reaction with ArrheniusRate
+    falloffReaction = 3, //!< Reaction with a FalloffRate
+    plogReaction = 4, //!< Reaction with PlogRate
+    chebyshevReaction = 5, //!< Reaction with ChebyshevRate
+};
+
+//! Bit flags for reaction properties
+enum ReactionFlag : int32_t {
+    duplicateFlag = 1,
+    negativeOrdersFlag = 2,
+    nonreactantOrdersFlag = 4,
+    negativeAFlag = 8,
+    chemicallyActivatedFlag = 16,
+};
+
+const vector<string> falloffModels = {"Lindemann", "Troe", "SRI", "Tsang"};
+const vector<string> geometries = {"atom", "linear", "nonlinear"};
+
+//! Number of parameters stored for each GasTransportData object
+const size_t nTransportParams = 8;
+
+//! Input keys of species which can be represented exactly using flat storage
+const set<string> flatSpeciesKeys = {
+    "name", "composition", "thermo", "transport", "charge", "size", "sites"};
+
+//! Input keys of species thermo models which can be represented exactly using
+//! flat storage
+const set<string> flatThermoKeys = {
+    "model", "temperature-ranges", "data", "reference-pressure", "T0", "h0", "s0",
+    "cp0", "T-min", "T-max"};
+
+//! Input keys of gas transport data which can be represented exactly using flat
+//! storage
+const set<string> flatTransportKeys = {
+    "model", "geometry", "diameter", "well-depth", "dipole", "polarizability",
+    "rotational-relaxation", "acentric-factor", "dispersion-coefficient",
+    "quadrupole-polarizability"};
+
+//! Input keys of reactions which can be represented exactly using flat storage
+const set<string> flatReactionKeys = {
+    "equation", "type", "id", "duplicate", "orders", "negative-orders",
+    "nonreactant-orders", "negative-A", "efficiencies", "default-efficiency",
+    "rate-constant", "low-P-rate-constant", "high-P-rate-constant", "Troe", "SRI",
+    "Tsang", "rate-constants", "temperature-range", "pressure-range", "data"};
+
+//! Buffer used to assemble the contents of a binary mechanism file. All values
+//! and arrays are stored at offsets which are multiples of 8 bytes, so arrays
+//! can be accessed in place from a memory-mapped view of the file.
+class BinaryWriter
+{
+public:
+    void raw(const void* data, size_t n) {
+        const char* begin = static_cast<const char*>(data);
+        m_data.insert(m_data.end(), begin, begin + n);
+        m_data.resize((m_data.size() + 7) / 8 * 8, '\0');
+    }
+
+    template <class T>
+    void value(T x) {
+        static_assert(std::is_trivially_copyable<T>::value && sizeof(T) <= 8);
+        raw(&x, sizeof(T));
+    }
+
+    template <class T>
+    void array(const vector<T>& x) {
+        static_assert(std::is_trivially_copyable<T>::value);
+        value<uint64_t>(x.size());
+        raw(x.data(), x.size() * sizeof(T));
+    }
+
+    void string(const std::string& x) {
+        value<uint64_t>(x.size());
+        raw(x.data(), x.size());
+    }
+
+    //! Write a table of strings as an array of offsets followed by the
+    //! concatenated characters
+    void strings(const vector<std::string>& items) {
+        vector<uint64_t> offsets(1, 0);
+        std::string chars;
+        for (const auto& item : items) {
+            chars += item;
+            offsets.push_back(chars.size());
+        }
+        array(offsets);
+        string(chars);
+    }
+
+    void toFile(const std::string& filename) const {
+        std::ofstream out(filename, std::ios::binary);
+        out.write(m_data.data(), m_data.size());
+        if (!out) {
+            throw CanteraError("writeBinaryMechanism",
+                               "Error writing to file '{}'.", filename);
+        }
+    }
+
+private:
+    vector<char> m_data;
+};
+
+//! Read-only view of the contents of a file. On POSIX systems, the file is
+//! memory-mapped; otherwise, its contents are read into a buffer.
+class MappedFile
+{
+public:
+    explicit MappedFile(const string& filename) {
+#ifdef _WIN32
+        std::ifstream in(filename, std::ios::binary);
+        if (!in) {
+            throw CanteraError("MappedFile::MappedFile",
+                               "Unable to open file '{}'.", filename);
+        }
+        m_buffer.assign(std::istreambuf_iterator<char>(in),
+                        std::istreambuf_iterator<char>());
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+#else
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw CanteraError("MappedFile::MappedFile",
+                               "Unable to open file '{}'.", filename);
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0) {
+            close(fd);
+            throw CanteraError("MappedFile::MappedFile",
+                               "Unable to determine size of file '{}'.", filename);
+        }
+        m_size = static_cast<size_t>(info.st_size);
+        if (m_size) {
+            void* mapped = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped == MAP_FAILED) {
+                close(fd);
+                throw CanteraError("MappedFile::MappedFile",
+                                   "Unable to map file '{}'.", filename);
+            }
+            m_data = static_cast<const char*>(mapped);
+        }
+        close(fd);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {
+#ifndef _WIN32
+        if (m_data) {
+            munmap(const_cast<char*>(m_data), m_size);
+        }
+#endif
+    }
+
+    const char* data() const {
+        return m_data;
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+
+private:
+#ifdef _WIN32
+    vector<char> m_buffer;
+#endif
+    const char* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+//! Table of strings stored in a binary mechanism file
+struct StringTable
+{
+    std::string operator[](size_t i) const {
+        return std::string(chars + offsets[i], offsets[i+1] - offsets[i]);
+    }
+
+    size_t size() const {
+        return n;
+    }
+
+    const uint64_t* offsets;
+    const char* chars;
+    size_t n;
+};
+
+//! Sequential reader for the contents of a binary mechanism file. Arrays are
+//! returned as pointers into the underlying data, without copying.
+class BinaryReader
+{
+public:
+    BinaryReader(const char* data, size_t size, const std::string& filename)
+        : m_data(data), m_size(size), m_filename(filename) {}
+
+    template <class T>
+    T value() {
+        require(sizeof(T));
+        T x;
+        std::memcpy(&x, m_data + m_pos, sizeof(T));
+        m_pos += 8;
+        return x;
+    }
+
+    //! Read an array with *n* entries
+    template <class T>
+    const T* array(size_t n) {
+        uint64_t count = value<uint64_t>();
+        if (count != n) {
+            throw CanteraError("BinaryReader::array", "Inconsistent array size in "
+                "binary mechanism file '{}': expected {}, found {}.",
+                m_filename, n, count);
+        }
+        if (n > (m_size - m_pos) / sizeof(T)) {
+            require(m_size - m_pos + 1);
+        }
+        const T* x = reinterpret_cast<const T*>(m_data + m_pos);
+        m_pos += (n * sizeof(T) + 7) / 8 * 8;
+        return x;
+    }
+
+    std::string string() {
+        uint64_t n = value<uint64_t>();
+        const char* chars = array_unchecked(n);
+        return std::string(chars, n);
+    }
+
+    StringTable strings(size_t n) {
+        StringTable table;
+        table.n = n;
+        table.offsets = array<uint64_t>(n + 1);
+        uint64_t nchars = value<uint64_t>();
+        if (table.offsets[n] != nchars) {
+            throw CanteraError("BinaryReader::strings", "Inconsistent string "
+                "table in binary mechanism file '{}'.", m_filename);
+        }
+        table.chars = array_unchecked(nchars);
+        return table;
+    }
+
+private:
+    const char* array_unchecked(size_t nbytes) {
+        require(nbytes);
+        const char* x = m_data + m_pos;
+        m_pos += (nbytes + 7) / 8 * 8;
+        return x;
+    }
+
+    void require(size_t nbytes) const {
+        if (nbytes > m_size - m_pos) {
+            throw CanteraError("BinaryReader::require",
+                "Unexpected end of binary mechanism file '{}'.", m_filename);
+        }
+    }
+
+    const char* m_data;
+    size_t m_size;
+    size_t m_pos = 0;
+    std::string m_filename;
+};
+
+//! Get the flat representation of the rate parameters of a reaction. Returns
+//! `yamlItem` if no flat representation is available.
+BinaryItem flatRate(Reaction& rxn, vector<double>& params, int32_t& flags)
+{
+    auto rate = rxn.rate();
+    string type = rate->type();
+    params.clear();
+    if (type == "Arrhenius") {
+        auto arr = std::dynamic_pointer_cast<ArrheniusRate>(rate);
+        if (!arr) {
+            return yamlItem;
+        }
+        params = {arr->preExponentialFactor(), arr->temperatureExponent(),
+                  arr->activationEnergy()};
+        if (arr->allowNegativePreExponentialFactor()) {
+            flags |= negativeAFlag;
+        }
+        return arrheniusReaction;
+    } else if (type == "falloff" || type == "chemically-activated") {
+        auto falloff = std::dynamic_pointer_cast<FalloffRate>(rate);
+        if (!falloff) {
+            return yamlItem;
+        }
+        auto model = std::find(falloffModels.begin(), falloffModels.end(),
+                               falloff->subType());
+        if (model == falloffModels.end()) {
+            return yamlItem;
+        }
+        params.push_back(model - falloffModels.begin());
+        for (auto* arr : {&falloff->lowRate(), &falloff->highRate()}) {
+            params.push_back(arr->preExponentialFactor());
+            params.push_back(arr->temperatureExponent());
+            params.push_back(arr->activationEnergy());
+        }
+        vector<double> c;
+        falloff->getFalloffCoeffs(c);
+        params.insert(params.end(), c.begin(), c.end());
+        if (falloff->allowNegativePreExponentialFactor()) {
+            flags |= negativeAFlag;
+        }
+        if (falloff->chemicallyActivated()) {
+            flags |= chemicallyActivatedFlag;
+        }
+        return falloffReaction;
+    } else if (type == "pressure-dependent-Arrhenius") {
+        auto plog = std::dynamic_pointer_cast<PlogRate>(rate);
+        if (!plog) {
+            return yamlItem;
+        }
+        for (const auto& [P, arr] : plog->getRates()) {
+            params.push_back(P);
+            params.push_back(arr.preExponentialFactor());
+            params.push_back(arr.temperatureExponent());
+            params.push_back(arr.activationEnergy());
+        }
+        return plogReaction;
+    } else if (type == "Chebyshev") {
+        auto cheb = std::dynamic_pointer_cast<ChebyshevRate>(rate);
+        if (!cheb) {
+            return yamlItem;
+        }
+        const auto& coeffs = cheb->data();
+        params = {cheb->Tmin(), cheb->Tmax(), cheb->Pmin(), cheb->Pmax(),
+                  static_cast<double>(coeffs.nRows()),
+                  static_cast<double>(coeffs.nColumns())};
+        params.insert(params.end(), coeffs.data().begin(), coeffs.data().end());
+        return chebyshevReaction;
+    }
+    return yamlItem;
+}
+
+//! Create the rate object for a reaction from its flat representation
+shared_ptr<ReactionRate> newFlatRate(BinaryItem item, const double* p, size_t n,
+                                     int32_t flags)
+{
+    if (item == arrheniusReaction) {
+        auto rate = make_shared<ArrheniusRate>(p[0], p[1], p[2]);
+        rate->setAllowNegativePreExponentialFactor(flags & negativeAFlag);
+        return rate;
+    } else if (item == falloffReaction) {
+        ArrheniusRate low(p[1], p[2], p[3]);
+        ArrheniusRate high(p[4], p[5], p[6]);
+        vector<double> c(p + 7, p + n);
+        shared_ptr<FalloffRate> rate;
+        switch (static_cast<size_t>(p[0])) {
+        case 0:
+            rate = make_shared<LindemannRate>(low, high, c);
+            break;
+        case 1:
+            rate = make_shared<TroeRate>(low, high, c);
+            break;
+        case 2:
+            rate = make_shared<SriRate>(low, high, c);
+            break;
+        default:
+            rate = make_shared<TsangRate>(low, high, c);
+        }
+        rate->setAllowNegativePreExponentialFactor(flags & negativeAFlag);
+        rate->setChemicallyActivated(flags & chemicallyActivatedFlag);
+        return rate;
+    } else if (item == plogReaction) {
+        std::multimap<double, ArrheniusRate> rates;
+        for (size_t i = 0; i + 3 < n; i += 4) {
+            rates.emplace(p[i], ArrheniusRate(p[i+1], p[i+2], p[i+3]));
+        }
+        return make_shared<PlogRate>(rates);
+    } else {
+        Array2D coeffs(static_cast<size_t>(p[4]), static_cast<size_t>(p[5]), p + 6);
+        return make_shared<ChebyshevRate>(p[0], p[1], p[2], p[3], coeffs);
+    }
+}
+
+//! Check that all keys of an input map are contained in a set of allowed keys
+bool hasOnlyKeys(const AnyMap& input, const set<string>& keys)
+{
+    for (const auto& [key, value] : input) {
+        if (!keys.count(key)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//! Check whether a reaction is recreated identically from its equation and rate,
+//! as is done when the flat representation is loaded, and has no input fields
+//! besides those given by the flat representation
+bool checkFlatReaction(Reaction& rxn)
+{
+    if (!hasOnlyKeys(rxn.input, flatReactionKeys)) {
+        return false;
+    }
+    try {
+        Reaction test(rxn.equation(), rxn.rate());
+        if (test.reactants != rxn.reactants || test.products != rxn.products
+            || test.usesThirdBody() != rxn.usesThirdBody())
+        {
+            return false;
+        }
+        if (rxn.usesThirdBody()) {
+            auto tb1 = rxn.thirdBody();
+            auto tb2 = test.thirdBody();
+            return tb1->name() == tb2->name() && tb1->mass_action == tb2->mass_action;
+        }
+        return true;
+    } catch (CanteraError&) {
+        return false;
+    }
+}
+
+void writeSpecies(BinaryWriter& out, ThermoPhase& thermo)
+{
+    size_t nsp = thermo.nSpecies();
+    bool vpss = dynamic_cast<VPStandardStateTP*>(&thermo) != nullptr;
+    vector<int32_t> items(nsp, yamlItem);
+    vector<uint64_t> compStart(1, 0), coeffStart(1, 0);
+    vector<int32_t> compElement, thermoType(nsp, 0), geometry(nsp, -1);
+    vector<double> compValue, charge(nsp, 0.0), size(nsp, 1.0), Tmin(nsp, 0.0),
+        Tmax(nsp, 0.0), Pref(nsp, 0.0), coeffs, transport(nTransportParams * nsp, 0.0);
+    vector<AnyMap> yamlSpecies;
+
+    for (size_t k = 0; k < nsp; k++) {
+        auto sp = thermo.species(k);
+        bool flat = !vpss && sp->thermo;
+        if (flat) {
+            int type = sp->thermo->reportType();
+            flat = (type == NASA2 || type == CONSTANT_CP);
+        }
+        auto gasTransport = std::dynamic_pointer_cast<GasTransportData>(sp->transport);
+        if (sp->transport && !gasTransport) {
+            flat = false;
+        }
+        // Input fields which are not part of the flat representation, such as
+        // notes, require the species to be stored using YAML
+        flat = flat && hasOnlyKeys(sp->input, flatSpeciesKeys)
+            && hasOnlyKeys(sp->thermo->input(), flatThermoKeys)
+            && (!gasTransport || hasOnlyKeys(gasTransport->input, flatTransportKeys));
+
+        if (flat) {
+            items[k] = flatSpecies;
+            for (const auto& [elem, amount] : sp->composition) {
+                compElement.push_back(static_cast<int32_t>(thermo.elementIndex(elem)));
+                compValue.push_back(amount);
+            }
+            charge[k] = sp->charge;
+            size[k] = sp->size;
+            vector<double> c(sp->thermo->nCoeffs());
+            size_t index;
+            int type;
+            sp->thermo->reportParameters(index, type, Tmin[k], Tmax[k], Pref[k],
+                                         c.data());
+            thermoType[k] = type;
+            coeffs.insert(coeffs.end(), c.begin(), c.end());
+            if (gasTransport) {
+                auto geom = std::find(geometries.begin(), geometries.end(),
+                                      gasTransport->geometry);
+                geometry[k] = static_cast<int32_t>(geom - geometries.begin());
+                double* tr = &transport[nTransportParams * k];
+                tr[0] = gasTransport->diameter;
+                tr[1] = gasTransport->well_depth;
+                tr[2] = gasTransport->dipole;
+                tr[3] = gasTransport->polarizability;
+                tr[4] = gasTransport->rotational_relaxation;
+                tr[5] = gasTransport->acentric_factor;
+                tr[6] = gasTransport->dispersion_coefficient;
+                tr[7] = gasTransport->quadrupole_polarizability;
+            }
+        } else {
+            yamlSpecies.push_back(sp->parameters(&thermo));
+        }
+        compStart.push_back(compElement.size());
+        coeffStart.push_back(coeffs.size());
+    }
+
+    out.value<uint64_t>(nsp);
+    out.array(items);
+    out.strings(thermo.speciesNames());
+    out.array(compStart);
+    out.array(compElement);
+    out.array(compValue);
+    out.array(charge);
+    out.array(size);
+    out.array(thermoType);
+    out.array(Tmin);
+    out.array(Tmax);
+    out.array(Pref);
+    out.array(coeffStart);
+    out.array(coeffs);
+    out.array(geometry);
+    out.array(transport);
+    AnyMap yaml;
+    yaml["species"] = std::move(yamlSpecies);
+    out.string(yaml.toYamlString());
+}
+
+void writeReactions(BinaryWriter& out, Kinetics* kin)
+{
+    size_t nr = kin ? kin->nReactions() : 0;
+    // Flat storage is only used for reactions in a single bulk phase
+    bool flatAllowed = kin && kin->nPhases() == 1 && kin->thermo(0).nDim() == 3;
+    vector<int32_t> items(nr, yamlItem), flags(nr, 0);
+    vector<std::string> equations(nr), ids(nr);
+    vector<uint64_t> orderStart(1, 0), effStart(1, 0), rateStart(1, 0);
+    vector<int32_t> orderSpecies, effSpecies;
+    vector<double> orderValue, effValue, defaultEff(nr, NAN), rateParams, params;
+    vector<AnyMap> yamlReactions;
+
+    for (size_t i = 0; i < nr; i++) {
+        auto rxn = kin->reaction(i);
+        BinaryItem item = yamlItem;
+        if (flatAllowed && checkFlatReaction(*rxn)) {
+            item = flatRate(*rxn, params, flags[i]);
+        }
+        items[i] = item;
+        if (item != yamlItem) {
+            equations[i] = rxn->equation();
+            ids[i] = rxn->id;
+            if (rxn->duplicate) {
+                flags[i] |= duplicateFlag;
+            }
+            if (rxn->allow_negative_orders) {
+                flags[i] |= negativeOrdersFlag;
+            }
+            if (rxn->allow_nonreactant_orders) {
+                flags[i] |= nonreactantOrdersFlag;
+            }
+            for (const auto& [name, order] : rxn->orders) {
+                orderSpecies.push_back(
+                    static_cast<int32_t>(kin->kineticsSpeciesIndex(name)));
+                orderValue.push_back(order);
+            }
+            if (rxn->usesThirdBody()) {
+                auto tbody = rxn->thirdBody();
+                defaultEff[i] = tbody->default_efficiency;
+                for (const auto& [name, eff] : tbody->efficiencies) {
+                    // Efficiencies of undeclared species are not used
+                    size_t k = kin->kineticsSpeciesIndex(name);
+                    if (k != npos) {
+                        effSpecies.push_back(static_cast<int32_t>(k));
+                        effValue.push_back(eff);
+                    }
+                }
+            }
+            rateParams.insert(rateParams.end(), params.begin(), params.end());
+        } else {
+            yamlReactions.push_back(rxn->parameters());
+        }
+        orderStart.push_back(orderSpecies.size());
+        effStart.push_back(effSpecies.size());
+        rateStart.push_back(rateParams.size());
+    }
+
+    out.value<uint64_t>(nr);
+    out.array(items);
+    out.array(flags);
+    out.strings(equations);
+    out.strings(ids);
+    out.array(orderStart);
+    out.array(orderSpecies);
+    out.array(orderValue);
+    out.array(effStart);
+    out.array(effSpecies);
+    out.array(effValue);
+    out.array(defaultEff);
+    out.array(rateStart);
+    out.array(rateParams);
+    AnyMap yaml;
+    yaml["reactions"] = std::move(yamlReactions);
+    out.string(yaml.toYamlString());
+}
+
+void readSpecies(BinaryReader& in, ThermoPhase& thermo)
+{
+    size_t nsp = in.value<uint64_t>();
+    auto items = in.array<int32_t>(nsp);
+    auto names = in.strings(nsp);
+    auto compStart = in.array<uint64_t>(nsp + 1);
+    auto compElement = in.array<int32_t>(compStart[nsp]);
+    auto compValue = in.array<double>(compStart[nsp]);
+    auto charge = in.array<double>(nsp);
+    auto size = in.array<double>(nsp);
+    auto thermoType = in.array<int32_t>(nsp);
+    auto Tmin = in.array<double>(nsp);
+    auto Tmax = in.array<double>(nsp);
+    auto Pref = in.array<double>(nsp);
+    auto coeffStart = in.array<uint64_t>(nsp + 1);
+    auto coeffs = in.array<double>(coeffStart[nsp]);
+    auto geometry = in.array<int32_t>(nsp);
+    auto transport = in.array<double>(nTransportParams * nsp);
+    AnyMap yaml = AnyMap::fromYamlString(in.string());
+    auto& yamlSpecies = yaml["species"].asVector<AnyMap>();
+
+    size_t nYaml = 0;
+    for (size_t k = 0; k < nsp; k++) {
+        if (items[k] == yamlItem) {
+            thermo.addSpecies(newSpecies(yamlSpecies.at(nYaml++)));
+            continue;
+        }
+        Composition comp;
+        for (size_t j = compStart[k]; j < compStart[k+1]; j++) {
+            comp[thermo.elementName(compElement[j])] = compValue[j];
+        }
+        auto sp = make_shared<Species>(names[k], comp, charge[k], size[k]);
+        sp->thermo.reset(newSpeciesThermoInterpType(
+            thermoType[k], Tmin[k], Tmax[k], Pref[k], coeffs + coeffStart[k]));
+        if (geometry[k] >= 0) {
+            const double* tr = transport + nTransportParams * k;
+            sp->transport = make_shared<GasTransportData>(
+                geometries.at(geometry[k]), tr[0], tr[1], tr[2], tr[3], tr[4],
+                tr[5], tr[6], tr[7]);
+        }
+        thermo.addSpecies(sp);
+    }
+}
+
+void readReactions(BinaryReader& in, Kinetics& kin)
+{
+    size_t nr = in.value<uint64_t>();
+    auto items = in.array<int32_t>(nr);
+    auto flags = in.array<int32_t>(nr);
+    auto equations = in.strings(nr);
+    auto ids = in.strings(nr);
+    auto orderStart = in.array<uint64_t>(nr + 1);
+    auto orderSpecies = in.array<int32_t>(orderStart[nr]);
+    auto orderValue = in.array<double>(orderStart[nr]);
+    auto effStart = in.array<uint64_t>(nr + 1);
+    auto effSpecies = in.array<int32_t>(effStart[nr]);
+    auto effValue = in.array<double>(effStart[nr]);
+    auto defaultEff = in.array<double>(nr);
+    auto rateStart = in.array<uint64_t>(nr + 1);
+    auto rateParams = in.array<double>(rateStart[nr]);
+    AnyMap yaml = AnyMap::fromYamlString(in.string());
+    auto& yamlReactions = yaml["reactions"].asVector<AnyMap>();
+
+    size_t nYaml = 0;
+    for (size_t i = 0; i < nr; i++) {
+        auto item = static_cast<BinaryItem>(items[i]);
+        if (item == yamlItem) {
+            kin.addReaction(newReaction(yamlReactions.at(nYaml++), kin), false);
+            continue;
+        }
+        auto rate = newFlatRate(item, rateParams + rateStart[i],
+                                rateStart[i+1] - rateStart[i], flags[i]);
+        auto rxn = make_shared<Reaction>(equations[i], rate);
+        rxn->id = ids[i];
+        rxn->duplicate = flags[i] & duplicateFlag;
+        rxn->allow_negative_orders = flags[i] & negativeOrdersFlag;
+        rxn->allow_nonreactant_orders = flags[i] & nonreactantOrdersFlag;
+        for (size_t j = orderStart[i]; j < orderStart[i+1]; j++) {
+            rxn->orders[kin.kineticsSpeciesName(orderSpecies[j])] = orderValue[j];
+        }
+        if (rxn->usesThirdBody()) {
+            auto tbody = rxn->thirdBody();
+            tbody->default_efficiency = defaultEff[i];
+            tbody->efficiencies.clear();
+            for (size_t j = effStart[i]; j < effStart[i+1]; j++) {
+                tbody->efficiencies[kin.kineticsSpeciesName(effSpecies[j])] =
+                    effValue[j];
+            }
+        }
+        kin.addReaction(rxn, false);
+    }
+    kin.resizeReactions();
+}
+
+} // end anonymous namespace
+
+void writeBinaryMechanism(shared_ptr<Solution> soln, const string& filename)
+{
+    if (soln->nAdjacent()) {
+        throw NotImplementedError("writeBinaryMechanism",
+            "Phases with adjacent phases are not supported.");
+    }
+    auto thermo = soln->thermo();
+    BinaryWriter out;
+    out.raw(binaryMagic, sizeof(binaryMagic));
+    out.value(binaryVersion);
+    out.value(byteOrderMark);
+    out.string(CANTERA_VERSION);
+
+    // Phase model parameters, excluding the definitions stored separately
+    AnyMap phase = soln->parameters(true);
+    phase.erase("elements");
+    phase.erase("species");
+    phase.erase("reactions");
+    out.string(soln->header().toYamlString());
+    out.string(phase.toYamlString());
+
+    // Elements
+    size_t nel = thermo->nElements();
+    vector<double> weight(nel), entropy(nel);
+    vector<int32_t> number(nel), type(nel);
+    for (size_t m = 0; m < nel; m++) {
+        weight[m] = thermo->atomicWeight(m);
+        number[m] = thermo->atomicNumber(m);
+        entropy[m] = thermo->entropyElement298(m);
+        type[m] = thermo->elementType(m);
+    }
+    out.value<uint64_t>(nel);
+    out.strings(thermo->elementNames());
+    out.array(weight);
+    out.array(number);
+    out.array(entropy);
+    out.array(type);
+
+    writeSpecies(out, *thermo);
+    writeReactions(out, soln->kinetics().get());
+    out.toFile(filename);
+}
+
+shared_ptr<Solution> newSolutionFromBinary(const string& filename,
+                                           const string& transport)
+{
+    string path = findInputFile(filename);
+    MappedFile file(path);
+    BinaryReader in(file.data(), file.size(), path);
+
+    char magic[sizeof(binaryMagic)];
+    for (size_t i = 0; i < sizeof(binaryMagic); i += 8) {
+        uint64_t chunk = in.value<uint64_t>();
+        std::memcpy(magic + i, &chunk, 8);
+    }
+    if (std::memcmp(magic, binaryMagic, sizeof(binaryMagic)) != 0) {
+        throw CanteraError("newSolutionFromBinary",
+            "File '{}' is not a binary mechanism file.", path);
+    }
+    uint32_t version = in.value<uint32_t>();
+    if (version != binaryVersion) {
+        throw CanteraError("newSolutionFromBinary", "Binary mechanism file '{}' "
+            "uses format version {}; version {} is required.",
+            path, version, binaryVersion);
+    }
+    if (in.value<uint32_t>() != byteOrderMark) {
+        throw CanteraError("newSolutionFromBinary", "Binary mechanism file '{}' "
+            "was created on a machine with a different byte order.", path);
+    }
+    string version_str = in.string();
+    if (version_str != CANTERA_VERSION) {
+        throw CanteraError("newSolutionFromBinary", "Binary mechanism file '{}' "
+            "was created by Cantera {} and cannot be used with Cantera {}.",
+            path, version_str, CANTERA_VERSION);
+    }
+
+    AnyMap rootNode = AnyMap::fromYamlString(in.string());
+    AnyMap phaseNode = AnyMap::fromYamlString(in.string());
+
+    // Create the phase, adding the elements and species directly, and the
+    // remaining parameters from the phase definition
+    auto thermo = newThermoModel(phaseNode["thermo"].asString());
+    size_t nel = in.value<uint64_t>();
+    auto elemNames = in.strings(nel);
+    auto weight = in.array<double>(nel);
+    auto number = in.array<int32_t>(nel);
+    auto entropy = in.array<double>(nel);
+    auto type = in.array<int32_t>(nel);
+    for (size_t m = 0; m < nel; m++) {
+        thermo->addElement(elemNames[m], weight[m], number[m], entropy[m], type[m]);
+    }
+    readSpecies(in, *thermo);
+    setupPhase(*thermo, phaseNode, rootNode);
+
+    shared_ptr<Solution> sol;
+    if (thermo->nDim() == 2) {
+        sol = Interface::create();
+    } else {
+        sol = Solution::create();
+    }
+    sol->setSource(path);
+    sol->setThermo(thermo);
+
+    // Reactions are added directly after the Kinetics object is created
+    AnyMap kinNode = phaseNode;
+    kinNode["reactions"] = "none";
+    auto kin = newKinetics({thermo}, kinNode, rootNode, sol);
+    readReactions(in, *kin);
+
+    sol->setTransportModel(transport);
+    sol->header() = rootNode;
+    return sol;
+}
+
+}
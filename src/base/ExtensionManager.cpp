@@ -60,4 +60,9 @@ string ExtensionManager::getSolutionWrapperType(const string& userType)
     }
 }
 
+bool ExtensionManager::hasUserRateTypes()
+{
+    return !s_userTypeToWrapperType.empty();
+}
+
 }
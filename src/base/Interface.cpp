@@ -49,9 +49,9 @@ shared_ptr<Interface> newInterface(const string& infile,
 shared_ptr<Interface> newInterface(const string& infile,
     const string& name, const vector<shared_ptr<Solution>>& adjacent)
 {
-    auto rootNode = AnyMap::fromYamlFile(infile);
-    AnyMap& phaseNode = rootNode["phases"].getMapWhere("name", name);
-    return newInterface(phaseNode, rootNode, adjacent);
+    auto rootNode = AnyMap::sharedYamlFile(infile);
+    AnyMap phaseNode = rootNode->at("phases").getMapWhere("name", name);
+    return newInterface(phaseNode, *rootNode, adjacent);
 }
 
 shared_ptr<Interface> newInterface(AnyMap& phaseNode, const AnyMap& rootNode,
@@ -0,0 +1,191 @@
+/**
+ * @file PerfCounters.cpp
+ *    Definitions for performance counters (see @ref Cantera::ScopedTimer).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/PerfCounters.h"
+#include "cantera/base/AnyMap.h"
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+namespace Cantera
+{
+
+//! Counter for one instrumented region, in the context of the regions enclosing it
+struct PerfNode
+{
+    explicit PerfNode(const char* name_) : name(name_) {}
+
+    //! Find or create the counter for a region within this region
+    PerfNode* child(const char* childName) {
+        for (auto& node : children) {
+            // Names are usually string literals, so compare pointers first
+            if (node->name == childName || std::strcmp(node->name, childName) == 0) {
+                return node.get();
+            }
+        }
+        children.push_back(make_unique<PerfNode>(childName));
+        return children.back().get();
+    }
+
+    void reset() {
+        calls = 0;
+        time = 0.0;
+        for (auto& node : children) {
+            node->reset();
+        }
+    }
+
+    const char* name;
+    long int calls = 0; //!< Number of completed calls
+    double time = 0.0; //!< Total elapsed time [s]
+    vector<unique_ptr<PerfNode>> children;
+};
+
+namespace {
+
+//! Performance counters of a single thread. When the thread exits, its counters
+//! are added to exitedCounters().
+struct ThreadCounters
+{
+    ThreadCounters();
+    ~ThreadCounters();
+    PerfNode root{""};
+    PerfNode* current = &root;
+};
+
+std::mutex registryMutex;
+
+//! Counters of all running threads
+vector<ThreadCounters*>& registry()
+{
+    static vector<ThreadCounters*> threads;
+    return threads;
+}
+
+//! Combined counters of all threads that have exited
+PerfNode& exitedCounters()
+{
+    static PerfNode root{""};
+    return root;
+}
+
+//! Add the counters of `source` and its children to `target`
+void mergeCounters(PerfNode& target, const PerfNode& source)
+{
+    target.calls += source.calls;
+    target.time += source.time;
+    for (const auto& child : source.children) {
+        mergeCounters(*target.child(child->name), *child);
+    }
+}
+
+ThreadCounters::ThreadCounters()
+{
+    std::unique_lock<std::mutex> lock(registryMutex);
+    registry().push_back(this);
+}
+
+ThreadCounters::~ThreadCounters()
+{
+    std::unique_lock<std::mutex> lock(registryMutex);
+    mergeCounters(exitedCounters(), root);
+    auto& threads = registry();
+    threads.erase(std::find(threads.begin(), threads.end(), this));
+}
+
+ThreadCounters& threadCounters()
+{
+    thread_local ThreadCounters counters;
+    return counters;
+}
+
+//! Add the counters for the children of `node` to `out`, merging with existing
+//! entries of the same name. Returns `true` if any counter was used.
+bool addToReport(AnyMap& out, const PerfNode& node)
+{
+    bool used = false;
+    for (const auto& child : node.children) {
+        AnyMap grandchildren;
+        bool childUsed = addToReport(grandchildren, *child);
+        if (child->calls == 0 && !childUsed) {
+            continue;
+        }
+        used = true;
+        if (!out.hasKey(child->name)) {
+            AnyMap entry;
+            entry["calls"] = 0L;
+            entry["time"] = 0.0;
+            out[child->name] = std::move(entry);
+        }
+        auto& entry = out[child->name].as<AnyMap>();
+        entry["calls"] = entry["calls"].asInt() + child->calls;
+        entry["time"] = entry["time"].asDouble() + child->time;
+        if (grandchildren.size()) {
+            if (!entry.hasKey("children")) {
+                entry["children"] = std::move(grandchildren);
+            } else {
+                // Merge with the children recorded by another thread
+                addToReport(entry["children"].as<AnyMap>(), *child);
+            }
+        }
+    }
+    return used;
+}
+
+} // end unnamed namespace
+
+ScopedTimer::ScopedTimer(const char* name)
+{
+    auto& counters = threadCounters();
+    m_current = &counters.current;
+    m_parent = counters.current;
+    m_node = m_parent->child(name);
+    counters.current = m_node;
+    m_start = std::chrono::steady_clock::now();
+}
+
+ScopedTimer::~ScopedTimer()
+{
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_start;
+    m_node->calls++;
+    m_node->time += elapsed.count();
+    *m_current = m_parent;
+}
+
+AnyMap perfCounterReport()
+{
+    AnyMap report;
+    std::unique_lock<std::mutex> lock(registryMutex);
+    addToReport(report, exitedCounters());
+    for (const auto* counters : registry()) {
+        addToReport(report, counters->root);
+    }
+    return report;
+}
+
+void resetPerfCounters()
+{
+    std::unique_lock<std::mutex> lock(registryMutex);
+    exitedCounters().reset();
+    for (auto* counters : registry()) {
+        // Counters are zeroed rather than removed, since active timers may still
+        // refer to them
+        counters->root.reset();
+    }
+}
+
+bool perfCountersEnabled()
+{
+#ifdef CT_PERF_COUNTERS
+    return true;
+#else
+    return false;
+#endif
+}
+
+}
@@ -7,6 +7,7 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/base/Solution.h"
+#include "cantera/base/BinaryMechanism.h"
 #include "cantera/base/Interface.h"
 #include "cantera/base/ExtensionManager.h"
 #include "cantera/thermo/ThermoPhase.h"
@@ -205,10 +206,23 @@ shared_ptr<Solution> newSolution(const string &infile,
                            "The CTI and XML formats are no longer supported.");
     }
 
-    // load YAML file
-    auto rootNode = AnyMap::fromYamlFile(infile);
-    const AnyMap& phaseNode = rootNode.at("phases").getMapWhere("name", name);
-    auto sol = newSolution(phaseNode, rootNode, transport, adjacent);
+    if (extension == "ctb") {
+        if (!adjacent.empty()) {
+            throw NotImplementedError("newSolution",
+                "Adjacent phases are not supported for binary mechanism files.");
+        }
+        auto sol = newSolutionFromBinary(infile, transport);
+        if (!name.empty() && name != sol->name()) {
+            throw CanteraError("newSolution", "Binary mechanism file '{}' does "
+                "not contain a phase named '{}'.", infile, name);
+        }
+        return sol;
+    }
+
+    // load YAML file, reading from the shared copy held in the input file cache
+    auto rootNode = AnyMap::sharedYamlFile(infile);
+    AnyMap phaseNode = rootNode->at("phases").getMapWhere("name", name);
+    auto sol = newSolution(phaseNode, *rootNode, transport, adjacent);
     sol->setSource(infile);
     return sol;
 }
@@ -216,16 +230,16 @@ shared_ptr<Solution> newSolution(const string &infile,
 shared_ptr<Solution> newSolution(const string& infile, const string& name,
     const string& transport, const vector<string>& adjacent)
 {
-    auto rootNode = AnyMap::fromYamlFile(infile);
-    const AnyMap& phaseNode = rootNode.at("phases").getMapWhere("name", name);
+    auto rootNode = AnyMap::sharedYamlFile(infile);
+    AnyMap phaseNode = rootNode->at("phases").getMapWhere("name", name);
 
     vector<shared_ptr<Solution>> adjPhases;
     // Create explicitly-specified adjacent bulk phases
     for (auto& name : adjacent) {
-        const auto& adjNode = rootNode.at("phases").getMapWhere("name", name);
-        adjPhases.push_back(newSolution(adjNode, rootNode));
+        AnyMap adjNode = rootNode->at("phases").getMapWhere("name", name);
+        adjPhases.push_back(newSolution(adjNode, *rootNode));
     }
-    return newSolution(phaseNode, rootNode, transport, adjPhases);
+    return newSolution(phaseNode, *rootNode, transport, adjPhases);
 }
 
 shared_ptr<Solution> newSolution(const AnyMap& phaseNode,
@@ -268,8 +282,8 @@ shared_ptr<Solution> newSolution(const AnyMap& phaseNode,
         {
             if (!all_related.count(name)) {
                 // Create a new phase only if there isn't already one with the same name
-                auto adj = newSolution(phases.getMapWhere("name", name), root,
-                                       "default", {}, all_related);
+                AnyMap adjNode = phases.getMapWhere("name", name);
+                auto adj = newSolution(adjNode, root, "default", {}, all_related);
                 all_related[name] = adj;
                 for (size_t i = 0; i < adj->nAdjacent(); i++) {
                     all_related[adj->adjacent(i)->name()] = adj->adjacent(i);
@@ -296,10 +310,10 @@ shared_ptr<Solution> newSolution(const AnyMap& phaseNode,
                     // source is a different input file
                     string fileName(source.begin(), slash.begin());
                     string node(slash.end(), source.end());
-                    AnyMap phaseSource = AnyMap::fromYamlFile(fileName,
+                    auto phaseSource = AnyMap::sharedYamlFile(fileName,
                         rootNode.getString("__file__", ""));
                     for (auto& phase : names) {
-                        addPhase(phaseSource[node], phaseSource, phase);
+                        addPhase(phaseSource->at(node), *phaseSource, phase);
                     }
                 } else if (rootNode.hasKey(source)) {
                     // source is in the current file
@@ -18,6 +18,12 @@
 #include <fstream>
 #include <sstream>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 
 namespace ba = boost::algorithm;
 
@@ -38,6 +44,144 @@ const std::map<std::string, std::string> aliasMap = {
 namespace Cantera
 {
 
+//! Buffer holding state data of SolutionArray objects.
+//!
+//! Data are either held in memory or in a file that is mapped into memory (POSIX
+//! systems only), where the operating system pages data in and out as needed.
+class StateBuffer
+{
+public:
+    StateBuffer(size_t size, double value=0.) : m_vector(size, value) {}
+
+    StateBuffer(const StateBuffer&) = delete;
+    StateBuffer& operator=(const StateBuffer&) = delete;
+
+    ~StateBuffer() {
+#ifndef _WIN32
+        if (m_mapped) {
+            munmap(m_mapped, m_capacity * sizeof(double));
+        }
+        if (m_fd >= 0) {
+            close(m_fd);
+            unlink(m_fname.c_str());
+        }
+#endif
+    }
+
+    double* data() {
+        return m_mapped ? m_mapped : m_vector.data();
+    }
+
+    size_t size() const {
+        return m_mapped ? m_size : m_vector.size();
+    }
+
+    double& operator[](size_t i) {
+        return data()[i];
+    }
+
+    //! Name of backing file; empty if data are held in memory
+    const string& fileName() const {
+        return m_fname;
+    }
+
+    void resize(size_t size, double value=0.) {
+        if (!m_mapped) {
+            m_vector.resize(size, value);
+            return;
+        }
+        if (size > m_capacity) {
+            // grow geometrically to avoid remapping for every appended entry
+            remap(std::max(size, 2 * m_capacity));
+        }
+        if (size > m_size) {
+            std::fill(m_mapped + m_size, m_mapped + size, value);
+        }
+        m_size = size;
+    }
+
+    //! Move data to file *fname*, which is mapped into memory
+    void mapFile(const string& fname) {
+#ifdef _WIN32
+        throw NotImplementedError("SolutionArray::setBackingFile",
+            "Memory-mapped state data are only supported on POSIX systems.");
+#else
+        if (m_fd >= 0) {
+            throw CanteraError("SolutionArray::setBackingFile",
+                "State data are already backed by file '{}'.", m_fname);
+        }
+        m_fd = open(fname.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+        if (m_fd < 0) {
+            throw CanteraError("SolutionArray::setBackingFile",
+                "Unable to open file '{}'.", fname);
+        }
+        m_fname = fname;
+        m_size = m_vector.size();
+        remap(m_size);
+        std::copy(m_vector.begin(), m_vector.end(), m_mapped);
+        vector<double>().swap(m_vector);
+#endif
+    }
+
+    //! Notify buffer of sequential access at position *offset*, which triggers
+    //! read-ahead of subsequent data for memory-mapped files
+    void prefetch(size_t offset) {
+#ifndef _WIN32
+        if (!m_mapped || offset + s_prefetchSize / 2 < m_prefetched) {
+            return;
+        }
+        size_t start = std::max(offset, m_prefetched);
+        size_t end = std::min(offset + s_prefetchSize, m_size);
+        if (end <= start) {
+            return;
+        }
+        // madvise requires page-aligned addresses
+        size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        size_t first = start * sizeof(double) / page * page;
+        madvise(reinterpret_cast<char*>(m_mapped) + first,
+                end * sizeof(double) - first, MADV_WILLNEED);
+        m_prefetched = end;
+#endif
+    }
+
+private:
+    //! Resize backing file to hold *capacity* values and map it into memory
+    void remap(size_t capacity) {
+#ifndef _WIN32
+        // map at least one page, as empty mappings are invalid
+        capacity = std::max<size_t>(capacity, 512);
+        if (m_mapped) {
+            munmap(m_mapped, m_capacity * sizeof(double));
+            m_mapped = nullptr;
+        }
+        size_t bytes = capacity * sizeof(double);
+        if (ftruncate(m_fd, static_cast<off_t>(bytes)) != 0) {
+            throw CanteraError("SolutionArray::setBackingFile",
+                "Unable to resize file '{}' to {} bytes.", m_fname, bytes);
+        }
+        void* mapped = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+        if (mapped == MAP_FAILED) {
+            throw CanteraError("SolutionArray::setBackingFile",
+                "Unable to map file '{}'.", m_fname);
+        }
+        m_mapped = static_cast<double*>(mapped);
+        m_capacity = capacity;
+        m_prefetched = 0;
+#endif
+    }
+
+    //! Number of values read ahead during sequential access (4 MiB)
+    static const size_t s_prefetchSize = 1 << 19;
+
+    vector<double> m_vector; //!< Data held in memory
+    double* m_mapped = nullptr; //!< Data held in memory-mapped file
+    size_t m_size = 0; //!< Number of values held in memory-mapped file
+    size_t m_capacity = 0; //!< Number of values that fit into memory-mapped file
+    size_t m_prefetched = 0; //!< End of range read ahead during sequential access
+    int m_fd = -1; //!< File descriptor of backing file
+    string m_fname; //!< Name of backing file
+};
+
 SolutionArray::SolutionArray(const shared_ptr<Solution>& sol,
                              int size, const AnyMap& meta)
     : m_sol(sol)
@@ -51,7 +195,7 @@ SolutionArray::SolutionArray(const shared_ptr<Solution>& sol,
     }
     m_stride = m_sol->thermo()->stateSize();
     m_sol->thermo()->addSpeciesLock();
-    m_data = make_shared<vector<double>>(m_dataSize * m_stride, 0.);
+    m_data = make_shared<StateBuffer>(m_dataSize * m_stride, 0.);
     m_extra = make_shared<map<string, AnyValue>>();
     m_order = make_shared<map<int, string>>();
     for (size_t i = 0; i < m_dataSize; ++i) {
@@ -68,6 +212,8 @@ SolutionArray::SolutionArray(const SolutionArray& other,
     , m_size(selected.size())
     , m_dataSize(other.m_data->size())
     , m_stride(other.m_stride)
+    , m_compStride(other.m_compStride)
+    , m_columnMajor(other.m_columnMajor)
     , m_data(other.m_data)
     , m_extra(other.m_extra)
     , m_order(other.m_order)
@@ -140,11 +286,8 @@ void setScalar(AnyValue& extra, const AnyValue& data, const vector<int>& slice);
 
 void SolutionArray::reset()
 {
-    size_t nState = m_sol->thermo()->stateSize();
-    vector<double> state(nState);
-    m_sol->thermo()->saveState(state); // thermo contains current state
     for (size_t k = 0; k < m_size; ++k) {
-        std::copy(state.begin(), state.end(), m_data->data() + m_active[k] * m_stride);
+        _saveState(m_active[k]); // thermo contains current state
     }
     for (auto& [key, extra] : *m_extra) {
         if (extra.is<void>()) {
@@ -207,9 +350,32 @@ void SolutionArray::setApiShape(const vector<long int>& shape)
 
 void SolutionArray::_resize(size_t size)
 {
+    if (m_columnMajor) {
+        // values of each state component are contiguous and are relocated in place
+        size_t nState = m_sol->thermo()->stateSize();
+        if (size > m_dataSize) {
+            m_data->resize(size * nState, 0.);
+            double* data = m_data->data();
+            for (size_t j = nState; j-- > 0;) {
+                std::copy_backward(data + j * m_compStride,
+                                   data + j * m_compStride + m_dataSize,
+                                   data + j * size + m_dataSize);
+                std::fill(data + j * size + m_dataSize, data + (j + 1) * size, 0.);
+            }
+        } else {
+            double* data = m_data->data();
+            for (size_t j = 1; j < nState; j++) {
+                std::copy(data + j * m_compStride, data + j * m_compStride + size,
+                          data + j * size);
+            }
+            m_data->resize(size * nState);
+        }
+        m_compStride = size;
+    } else {
+        m_data->resize(size * m_stride, 0.);
+    }
     m_size = size;
     m_dataSize = size;
-    m_data->resize(m_dataSize * m_stride, 0.);
     for (auto& [key, data] : *m_extra) {
         _resizeExtra(key);
     }
@@ -709,14 +875,7 @@ AnyValue SolutionArray::getComponent(const string& name) const
 
     // component is part of state information
     vector<double> data(m_size);
-    size_t ix = m_sol->thermo()->speciesIndex(name);
-    if (ix == npos) {
-        // state other than species
-        ix = m_sol->thermo()->nativeState()[name];
-    } else {
-        // species information
-        ix += m_stride - m_sol->thermo()->nSpecies();
-    }
+    size_t ix = _stateIndex(name) * m_compStride;
     for (size_t k = 0; k < m_size; ++k) {
         data[k] = (*m_data)[m_active[k] * m_stride + ix];
     }
@@ -755,17 +914,177 @@ void SolutionArray::setComponent(const string& name, const AnyValue& data)
     }
 
     auto& vec = data.asVector<double>();
-    size_t ix = m_sol->thermo()->speciesIndex(name);
+    size_t ix = _stateIndex(name) * m_compStride;
+    for (size_t k = 0; k < m_size; ++k) {
+        (*m_data)[m_active[k] * m_stride + ix] = vec[k];
+    }
+}
+
+namespace { // restrict scope of helper functions to local translation unit
+
+//! Spacing of active entries; zero if entries are not evenly spaced
+int activeStep(const vector<int>& active)
+{
+    if (active.size() < 2) {
+        return 1;
+    }
+    int step = active[1] - active[0];
+    for (size_t k = 2; k < active.size(); k++) {
+        if (active[k] - active[k - 1] != step) {
+            return 0;
+        }
+    }
+    return std::max(step, 0);
+}
+
+} // end unnamed namespace
+
+StridedVector SolutionArray::componentView(const string& name)
+{
+    if (!hasComponent(name)) {
+        throw CanteraError("SolutionArray::componentView",
+            "Unknown component '{}'.", name);
+    }
+    int step = activeStep(m_active);
+    if (!step) {
+        throw CanteraError("SolutionArray::componentView",
+            "Unable to create view of component '{}' as selected entries are not "
+            "evenly spaced.", name);
+    }
+    size_t first = m_size ? m_active[0] : 0;
+    if (m_extra->count(name)) {
+        auto& extra = (*m_extra)[name];
+        if (!extra.isVector<double>()) {
+            throw CanteraError("SolutionArray::componentView",
+                "Unable to create view of component '{}' with type '{}'.",
+                name, extra.type_str());
+        }
+        return StridedVector(extra.asVector<double>().data() + first, m_size,
+                             Eigen::InnerStride<>(step));
+    }
+    size_t ix = _stateIndex(name);
     if (ix == npos) {
-        ix = m_sol->thermo()->nativeState()[name];
+        throw CanteraError("SolutionArray::componentView",
+            "Component '{}' is not part of the native state.", name);
+    }
+    return StridedVector(m_data->data() + first * m_stride + ix * m_compStride,
+                         m_size, Eigen::InnerStride<>(step * m_stride));
+}
+
+StridedMatrix SolutionArray::speciesView()
+{
+    auto phase = m_sol->thermo();
+    auto nativeState = phase->nativeState();
+    size_t offset;
+    if (nativeState.count("X")) {
+        offset = nativeState["X"];
+    } else if (nativeState.count("Y")) {
+        offset = nativeState["Y"];
     } else {
-        ix += m_stride - m_sol->thermo()->nSpecies();
+        throw CanteraError("SolutionArray::speciesView",
+            "Native state of phase '{}' does not include species data.",
+            phase->name());
+    }
+    int step = activeStep(m_active);
+    if (!step) {
+        throw CanteraError("SolutionArray::speciesView",
+            "Unable to create view as selected entries are not evenly spaced.");
+    }
+    size_t first = m_size ? m_active[0] : 0;
+    return StridedMatrix(m_data->data() + first * m_stride + offset * m_compStride,
+                         m_size, phase->nSpecies(),
+                         Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>(
+                             m_compStride, step * m_stride));
+}
+
+void SolutionArray::setColumnMajor(bool columnMajor)
+{
+    if (columnMajor == m_columnMajor) {
+        return;
     }
-    for (size_t k = 0; k < m_size; ++k) {
-        (*m_data)[m_active[k] * m_stride + ix] = vec[k];
+    if (m_data.use_count() > 1) {
+        throw CanteraError("SolutionArray::setColumnMajor",
+            "Unable to change storage order as data are shared by multiple objects.");
+    }
+    if (backingFile() != "") {
+        throw NotImplementedError("SolutionArray::setColumnMajor",
+            "Unable to change storage order of data backed by file '{}'.",
+            backingFile());
+    }
+    size_t nState = m_sol->thermo()->stateSize();
+    size_t stride = columnMajor ? 1 : nState;
+    size_t compStride = columnMajor ? m_dataSize : 1;
+    auto data = make_shared<StateBuffer>(m_dataSize * nState);
+    for (size_t i = 0; i < m_dataSize; i++) {
+        for (size_t j = 0; j < nState; j++) {
+            (*data)[i * stride + j * compStride] =
+                (*m_data)[i * m_stride + j * m_compStride];
+        }
+    }
+    m_data = data;
+    m_stride = stride;
+    m_compStride = compStride;
+    m_columnMajor = columnMajor;
+}
+
+void SolutionArray::setBackingFile(const string& fname)
+{
+    if (m_data.use_count() > 1) {
+        throw CanteraError("SolutionArray::setBackingFile",
+            "Unable to move data as they are shared by multiple objects.");
+    }
+    m_data->mapFile(fname);
+}
+
+string SolutionArray::backingFile() const
+{
+    return m_data->fileName();
+}
+
+size_t SolutionArray::_stateIndex(const string& name) const
+{
+    auto phase = m_sol->thermo();
+    size_t ix = phase->speciesIndex(name);
+    if (ix != npos) {
+        // species information
+        return ix + phase->stateSize() - phase->nSpecies();
+    }
+    // state other than species
+    auto nativeState = phase->nativeState();
+    if (!nativeState.count(name)) {
+        return npos;
+    }
+    return nativeState[name];
+}
+
+void SolutionArray::_saveState(size_t loc)
+{
+    size_t nState = m_sol->thermo()->stateSize();
+    if (!m_columnMajor) {
+        m_sol->thermo()->saveState(nState, m_data->data() + loc * m_stride);
+        return;
+    }
+    m_work.resize(nState);
+    m_sol->thermo()->saveState(nState, m_work.data());
+    for (size_t j = 0; j < nState; j++) {
+        (*m_data)[loc + j * m_compStride] = m_work[j];
     }
 }
 
+void SolutionArray::_restoreState(size_t loc)
+{
+    size_t nState = m_sol->thermo()->stateSize();
+    if (!m_columnMajor) {
+        m_sol->thermo()->restoreState(nState, m_data->data() + loc * m_stride);
+        return;
+    }
+    m_work.resize(nState);
+    for (size_t j = 0; j < nState; j++) {
+        m_work[j] = (*m_data)[loc + j * m_compStride];
+    }
+    m_sol->thermo()->restoreState(nState, m_work.data());
+}
+
 void SolutionArray::setLoc(int loc, bool restore)
 {
     size_t loc_ = static_cast<size_t>(loc);
@@ -783,18 +1102,20 @@ void SolutionArray::setLoc(int loc, bool restore)
     } else if (loc_ >= m_size) {
         throw IndexError("SolutionArray::setLoc", "indices", loc_, m_size);
     }
+    size_t previous = m_loc;
     m_loc = static_cast<size_t>(m_active[loc_]);
+    if (m_loc == previous + 1 && !m_columnMajor) {
+        m_data->prefetch(m_loc * m_stride);
+    }
     if (restore) {
-        size_t nState = m_sol->thermo()->stateSize();
-        m_sol->thermo()->restoreState(nState, m_data->data() + m_loc * m_stride);
+        _restoreState(m_loc);
     }
 }
 
 void SolutionArray::updateState(int loc)
 {
     setLoc(loc, false);
-    size_t nState = m_sol->thermo()->stateSize();
-    m_sol->thermo()->saveState(nState, m_data->data() + m_loc * m_stride);
+    _saveState(m_loc);
 }
 
 vector<double> SolutionArray::getState(int loc)
@@ -816,7 +1137,7 @@ void SolutionArray::setState(int loc, const vector<double>& state)
     }
     setLoc(loc, false);
     m_sol->thermo()->restoreState(state);
-    m_sol->thermo()->saveState(nState, m_data->data() + m_loc * m_stride);
+    _saveState(m_loc);
 }
 
 void SolutionArray::normalize() {
@@ -826,12 +1147,20 @@ void SolutionArray::normalize() {
         return;
     }
     size_t nState = phase->stateSize();
+    size_t nSpecies = phase->nSpecies();
     vector<double> out(nState);
+    vector<double> comp(nSpecies);
+    auto getComposition = [&](size_t offset) {
+        for (size_t k = 0; k < nSpecies; k++) {
+            comp[k] = (*m_data)[m_loc * m_stride + (offset + k) * m_compStride];
+        }
+        return comp.data();
+    };
     if (nativeState.count("Y")) {
         size_t offset = nativeState["Y"];
         for (int loc = 0; loc < static_cast<int>(m_size); loc++) {
             setLoc(loc, true); // set location and restore state
-            phase->setMassFractions(m_data->data() + m_loc * m_stride + offset);
+            phase->setMassFractions(getComposition(offset));
             m_sol->thermo()->saveState(out);
             setState(loc, out);
         }
@@ -839,7 +1168,7 @@ void SolutionArray::normalize() {
         size_t offset = nativeState["X"];
         for (int loc = 0; loc < static_cast<int>(m_size); loc++) {
             setLoc(loc, true); // set location and restore state
-            phase->setMoleFractions(m_data->data() + m_loc * m_stride + offset);
+            phase->setMoleFractions(getComposition(offset));
             m_sol->thermo()->saveState(out);
             setState(loc, out);
         }
@@ -1072,25 +1401,67 @@ void SolutionArray::writeEntry(const string& fname, bool overwrite, const string
         std::remove(fname.c_str());
     }
     std::ofstream output(fname);
-    output << to_string(header) << std::endl;
-
-    size_t maxLen = npos;
-    vector<double> buf(speciesNames.size(), 0.);
-    for (int row = 0; row < static_cast<int>(m_size); row++) {
-        fmt::memory_buffer line;
-        if (maxLen != npos) {
-            line.reserve(maxLen);
-        }
-        setLoc(row);
-        if (mole) {
-            m_sol->thermo()->getMoleFractions(buf.data());
-        } else {
-            m_sol->thermo()->getMassFractions(buf.data());
+    output << to_string(header) << "\n";
+
+    // Species data are derived from the native state for all rows without updating
+    // the ThermoPhase object, mirroring Phase::restoreState and the composition getters
+    auto phase = m_sol->thermo();
+    const auto& nativeState = phase->nativeState();
+    size_t nSpecies = phase->nSpecies();
+    bool nativeMole = nativeState.count("X") > 0;
+    size_t spOffset = npos;
+    if (nativeMole) {
+        spOffset = nativeState.at("X");
+    } else if (nativeState.count("Y")) {
+        spOffset = nativeState.at("Y");
+    }
+    const auto& mw = phase->molecularWeights();
+    const auto& rmw = phase->inverseMolecularWeights();
+    // If the composition is not part of the native state (for example, for pure
+    // fluids), it is the same for all rows and is taken from the phase
+    vector<double> fixedComp(nSpecies);
+    if (spOffset == npos && mole) {
+        phase->getMoleFractions(fixedComp.data());
+    } else if (spOffset == npos) {
+        phase->getMassFractions(fixedComp.data());
+    }
+    auto getSpecies = [&](size_t row, double* out) {
+        if (spOffset == npos) {
+            std::copy(fixedComp.begin(), fixedComp.end(), out);
+            return;
         }
+        const double* comp = m_data->data() + m_active[row] * m_stride
+            + spOffset * m_compStride;
+        for (size_t k = 0; k < nSpecies; k++) {
+            out[k] = comp[k * m_compStride];
+        }
+        if (mole != nativeMole && mole) {
+            // mole fractions from mass fractions
+            double sum = 0.0;
+            for (size_t k = 0; k < nSpecies; k++) {
+                out[k] *= rmw[k];
+                sum += out[k];
+            }
+            for (size_t k = 0; k < nSpecies; k++) {
+                out[k] /= sum;
+            }
+        } else if (mole != nativeMole) {
+            // mass fractions from mole fractions
+            double mmw = 0.0;
+            for (size_t k = 0; k < nSpecies; k++) {
+                mmw += out[k] * mw[k];
+            }
+            for (size_t k = 0; k < nSpecies; k++) {
+                out[k] = out[k] / mmw * mw[k];
+            }
+        }
+    };
 
+    auto formatRow = [&](size_t row, double* buf, fmt::memory_buffer& line) {
+        getSpecies(row, buf);
         size_t idx = 0;
         for (size_t col = 0; col < components.size(); col++) {
-            string sep = (col == last) ? "" : ",";
+            string sep = (col == last) ? "\n" : ",";
             if (isSpecies[col]) {
                 fmt_append(line, "{:.9g}{}", buf[idx++], sep);
             } else {
@@ -1103,7 +1474,7 @@ void SolutionArray::writeEntry(const string& fname, bool overwrite, const string
                     fmt_append(line, "{}{}",
                                static_cast<bool>(data.asVector<bool>()[row]), sep);
                 } else {
-                    auto value = data.asVector<string>()[row];
+                    auto& value = data.asVector<string>()[row];
                     if (value.find("\"") != string::npos ||
                         value.find("\n") != string::npos)
                     {
@@ -1119,8 +1490,29 @@ void SolutionArray::writeEntry(const string& fname, bool overwrite, const string
                 }
             }
         }
-        output << to_string(line) << std::endl;
-        maxLen = std::max(maxLen, line.size());
+    };
+
+    // Rows are formatted concurrently in blocks; a limited number of blocks is held in
+    // memory before being written to file in order
+    const size_t blockSize = 4096;
+    const size_t batchSize = 64;
+    size_t nBlocks = (m_size + blockSize - 1) / blockSize;
+    vector<fmt::memory_buffer> blocks(std::min(batchSize, nBlocks));
+    for (size_t first = 0; first < nBlocks; first += batchSize) {
+        size_t nBatch = std::min(batchSize, nBlocks - first);
+        parallelFor(nBatch, [&](size_t i) {
+            size_t start = (first + i) * blockSize;
+            size_t end = std::min(start + blockSize, m_size);
+            auto& block = blocks[i];
+            block.clear();
+            vector<double> buf(nSpecies, 0.);
+            for (size_t row = start; row < end; row++) {
+                formatRow(row, buf.data(), block);
+            }
+        });
+        for (size_t i = 0; i < nBatch; i++) {
+            output.write(blocks[i].data(), blocks[i].size());
+        }
     }
 }
 
@@ -1168,29 +1560,101 @@ void SolutionArray::writeEntry(const string& fname, const string& name,
     if (!m_dataSize) {
         return;
     }
+    _writeColumns(file, path, false);
+}
+
+size_t SolutionArray::appendEntry(const string& fname, const string& name,
+                                  const string& sub, int compression, size_t chunkSize)
+{
+    if (name == "") {
+        throw CanteraError("SolutionArray::appendEntry",
+            "Group name specifying root location must not be empty.");
+    }
+    if (m_size < m_dataSize) {
+        throw NotImplementedError("SolutionArray::appendEntry",
+            "Unable to save sliced data.");
+    }
+    if (apiNdim() != 1) {
+        throw CanteraError("SolutionArray::appendEntry",
+            "Appending data requires a one-dimensional SolutionArray.");
+    }
+    Storage file(fname, true);
+    if (compression) {
+        file.setCompressionLevel(compression);
+    }
+    file.setChunkSize(chunkSize);
+    string path = name;
+    if (sub != "") {
+        path += "/" + sub;
+    } else {
+        path += "/data";
+    }
+    if (!file.checkGroup(name, true)) {
+        file.writeAttributes(name, preamble(""));
+    }
+    size_t size = 0;
+    if (file.checkGroup(path, true)) {
+        AnyMap attrs = file.readAttributes(path, false);
+        if (!attrs.hasKey("size") || !attrs.hasKey("components")) {
+            throw CanteraError("SolutionArray::appendEntry",
+                "Group '{}' does not hold a one-dimensional SolutionArray.", path);
+        }
+        if (attrs["components"].asVector<string>() != componentNames()) {
+            throw CanteraError("SolutionArray::appendEntry",
+                "Components of group '{}' do not match SolutionArray components.",
+                path);
+        }
+        size = attrs["size"].asInt();
+    } else {
+        file.writeAttributes(path, m_meta);
+        AnyMap more;
+        if (!m_meta.hasKey("transport-model") && m_sol->transport()) {
+            more["transport-model"] = m_sol->transportModel();
+        }
+        more["components"] = componentNames();
+        file.writeAttributes(path, more);
+    }
+    if (m_dataSize) {
+        _writeColumns(file, path, true);
+        size += m_dataSize;
+    }
+    AnyMap more;
+    more["size"] = int(size);
+    file.writeAttributes(path, more, true);
+    return size;
+}
 
+void SolutionArray::_writeColumns(Storage& file, const string& path, bool append)
+{
+    auto write = [&file, &path, append](const string& key, const AnyValue& data) {
+        if (append) {
+            file.appendData(path, key, data);
+        } else {
+            file.writeData(path, key, data);
+        }
+    };
     const auto& nativeState = m_sol->thermo()->nativeState();
     size_t nSpecies = m_sol->thermo()->nSpecies();
     for (auto& [key, offset] : nativeState) {
         if (key == "X" || key == "Y") {
-            vector<vector<double>> prop;
+            vector<vector<double>> prop(m_size, vector<double>(nSpecies));
             for (size_t i = 0; i < m_size; i++) {
-                size_t first = offset + i * m_stride;
-                prop.emplace_back(m_data->begin() + first,
-                                  m_data->begin() + first + nSpecies);
+                for (size_t k = 0; k < nSpecies; k++) {
+                    prop[i][k] = (*m_data)[i * m_stride + (offset + k) * m_compStride];
+                }
             }
             AnyValue data;
             data = prop;
-            file.writeData(path, key, data);
+            write(key, data);
         } else {
             auto data = getComponent(key);
-            file.writeData(path, key, data);
+            write(key, data);
         }
     }
 
     for (const auto& [key, value] : *m_extra) {
         if (isSimpleVector(value)) {
-            file.writeData(path, key, value);
+            write(key, value);
         } else if (value.is<void>()) {
             // skip unintialized component
         } else {
@@ -1406,9 +1870,12 @@ AnyMap SolutionArray::restore(const string& fname,
     string extension = (dot != npos) ? toLowerCopy(fname.substr(dot + 1)) : "";
     AnyMap header;
     if (extension == "csv") {
-        throw NotImplementedError("SolutionArray::restore",
-            "CSV import not implemented; if using Python, data can be imported via "
-            "'read_csv' instead.");
+        if (name != "") {
+            warn_user("SolutionArray::restore",
+                      "Parameter 'name' not used for CSV input.");
+        }
+        readEntry(fname);
+        return header;
     }
     if (extension == "h5" || extension == "hdf"  || extension == "hdf5") {
         readEntry(fname, name, sub);
@@ -1420,7 +1887,7 @@ AnyMap SolutionArray::restore(const string& fname,
     } else {
         throw CanteraError("SolutionArray::restore",
             "Unknown file extension '{}'; supported extensions include "
-            "'h5'/'hdf'/'hdf5' and 'yml'/'yaml'.", extension);
+            "'h5'/'hdf'/'hdf5', 'yml'/'yaml' and 'csv'.", extension);
     }
     return header;
 }
@@ -1656,6 +2123,313 @@ string getName(const set<string>& names, const string& name)
     return name; // let exception be thrown elsewhere
 }
 
+//! Split a line of CSV data into fields; fields may be enclosed in double quotes,
+//! which are removed
+void splitCsvLine(const char* begin, const char* end, vector<std::string_view>& fields)
+{
+    fields.clear();
+    if (end > begin && *(end - 1) == '\r') {
+        end--;
+    }
+    const char* pos = begin;
+    while (true) {
+        if (pos < end && *pos == '"') {
+            const char* close = std::find(pos + 1, end, '"');
+            fields.emplace_back(pos + 1, close - pos - 1);
+            pos = std::find(close, end, ',');
+        } else {
+            const char* sep = std::find(pos, end, ',');
+            fields.emplace_back(pos, sep - pos);
+            pos = sep;
+        }
+        if (pos == end) {
+            return;
+        }
+        pos++;
+    }
+}
+
+//! Convert a CSV field to a floating point number; returns false if the field does
+//! not hold a valid number
+bool parseCsvValue(std::string_view field, double& value)
+{
+    // Fields are views into a null-terminated buffer, where conversion stops at the
+    // next separator
+    if (field.empty()) {
+        return false;
+    }
+    char* end;
+    value = std::strtod(field.data(), &end);
+    return end == field.data() + field.size();
+}
+
+//! Convert a CSV field to an integer; returns false if the field does not hold a
+//! valid integer
+bool parseCsvValue(std::string_view field, long int& value)
+{
+    if (field.empty()) {
+        return false;
+    }
+    char* end;
+    value = std::strtol(field.data(), &end, 10);
+    return end == field.data() + field.size();
+}
+
+//! Convert column of CSV fields to integers, floating point numbers or strings,
+//! whichever type holds all entries
+template<class T>
+bool convertCsvColumn(const vector<string>& fields, AnyValue& out)
+{
+    vector<T> values(fields.size());
+    for (size_t i = 0; i < fields.size(); i++) {
+        if (!parseCsvValue(fields[i], values[i])) {
+            return false;
+        }
+    }
+    out = std::move(values);
+    return true;
+}
+
+void SolutionArray::readEntry(const string& fname)
+{
+    if (apiNdim() != 1) {
+        throw CanteraError("SolutionArray::readEntry",
+            "Tabular input of CSV data only works for 1D SolutionArray objects.");
+    }
+    std::ifstream input(fname, std::ios::binary);
+    if (!input.good()) {
+        throw CanteraError("SolutionArray::readEntry",
+            "Unable to open CSV file '{}'.", fname);
+    }
+    string text;
+    input.seekg(0, std::ios::end);
+    text.resize(input.tellg());
+    input.seekg(0, std::ios::beg);
+    input.read(text.data(), text.size());
+
+    // Locate non-empty lines
+    vector<size_t> lines;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t eol = std::min(text.find('\n', pos), text.size());
+        if (eol > pos && !(eol == pos + 1 && text[pos] == '\r')) {
+            lines.push_back(pos);
+        }
+        pos = eol + 1;
+    }
+    if (lines.empty()) {
+        throw CanteraError("SolutionArray::readEntry",
+            "CSV file '{}' does not contain a header.", fname);
+    }
+    auto lineEnd = [&text](size_t start) {
+        return text.data() + std::min(text.find('\n', start), text.size());
+    };
+
+    // Classify columns based on header
+    auto phase = m_sol->thermo();
+    size_t nSpecies = phase->nSpecies();
+    vector<std::string_view> fields;
+    splitCsvLine(text.data() + lines[0], lineEnd(lines[0]), fields);
+    size_t nCols = fields.size();
+    vector<string> labels;
+    vector<size_t> speciesCol(nCols, npos); // species index of species columns
+    set<string> names;
+    string basis = "";
+    size_t nSpeciesCols = 0;
+    for (size_t col = 0; col < nCols; col++) {
+        labels.emplace_back(fields[col]);
+        const string& label = labels.back();
+        if (label.size() > 2 && (label[0] == 'X' || label[0] == 'Y') && label[1] == '_')
+        {
+            size_t k = phase->speciesIndex(label.substr(2));
+            if (k != npos) {
+                if (basis != "" && basis[0] != label[0]) {
+                    throw CanteraError("SolutionArray::readEntry",
+                        "Species columns of CSV file '{}' mix mole and mass "
+                        "fractions.", fname);
+                }
+                basis = label.substr(0, 1);
+                speciesCol[col] = k;
+                nSpeciesCols++;
+                continue;
+            }
+        }
+        names.insert(label);
+    }
+    if (nSpeciesCols && nSpeciesCols != nSpecies) {
+        throw CanteraError("SolutionArray::readEntry",
+            "CSV file '{}' holds {} species columns; expected {}.",
+            fname, nSpeciesCols, nSpecies);
+    }
+    if (basis != "") {
+        names.insert(basis);
+    }
+
+    // Determine storage mode of state data; if the composition basis is the only
+    // difference to the native state, it is converted without using the ThermoPhase
+    string mode = _detectMode(names);
+    string convert = "";
+    if (mode != "native" && basis != "") {
+        set<string> swapped = names;
+        swapped.erase(basis);
+        swapped.insert(basis == "X" ? "Y" : "X");
+        if (_detectMode(swapped) == "native") {
+            convert = basis;
+            mode = "native";
+        }
+    }
+    set<string> states = _stateProperties(mode);
+    if (states.count("C")) {
+        states.erase("C");
+        states.insert(basis);
+        mode = mode.substr(0, 2) + basis;
+    }
+    if (mode == "") {
+        throw CanteraError("SolutionArray::readEntry",
+            "Data are not consistent with full state modes.");
+    } else if (mode != "native" && mode != "TPX" && mode != "TDX" && mode != "TPY") {
+        throw NotImplementedError("SolutionArray::readEntry",
+            "Import of '{}' data is not supported.", mode);
+    }
+    map<string, size_t> stateCol;
+    for (const auto& name : states) {
+        if (name != "X" && name != "Y") {
+            string label = getName(names, name);
+            stateCol[name] = std::find(labels.begin(), labels.end(), label) -
+                labels.begin();
+        }
+    }
+    vector<bool> isState(nCols, false);
+    for (const auto& [name, col] : stateCol) {
+        isState[col] = true;
+    }
+
+    m_extra->clear();
+    m_order->clear();
+    size_t nRows = lines.size() - 1;
+    resize(static_cast<int>(nRows));
+    if (m_size == 0) {
+        return;
+    }
+
+    // Parse rows concurrently in blocks
+    vector<vector<double>> stateData(nCols);
+    vector<vector<string>> extraData(nCols);
+    for (size_t col = 0; col < nCols; col++) {
+        if (isState[col]) {
+            stateData[col].resize(nRows);
+        } else if (speciesCol[col] == npos) {
+            extraData[col].resize(nRows);
+        }
+    }
+    vector<double> comp(nRows * nSpecies);
+    const size_t blockSize = 4096;
+    parallelFor((nRows + blockSize - 1) / blockSize, [&](size_t block) {
+        vector<std::string_view> fields;
+        size_t end = std::min((block + 1) * blockSize, nRows);
+        for (size_t i = block * blockSize; i < end; i++) {
+            size_t start = lines[i + 1];
+            splitCsvLine(text.data() + start, lineEnd(start), fields);
+            if (fields.size() != nCols) {
+                throw CanteraError("SolutionArray::readEntry",
+                    "Row {} of CSV file '{}' holds {} entries; expected {}.",
+                    i + 1, fname, fields.size(), nCols);
+            }
+            for (size_t col = 0; col < nCols; col++) {
+                bool valid = true;
+                if (speciesCol[col] != npos) {
+                    valid = parseCsvValue(fields[col],
+                                          comp[i * nSpecies + speciesCol[col]]);
+                } else if (isState[col]) {
+                    valid = parseCsvValue(fields[col], stateData[col][i]);
+                } else {
+                    extraData[col][i] = fields[col];
+                }
+                if (!valid) {
+                    throw CanteraError("SolutionArray::readEntry",
+                        "Invalid value '{}' in row {} of column '{}'.",
+                        fields[col], i + 1, labels[col]);
+                }
+            }
+        }
+    });
+
+    // Restore state data
+    if (mode == "native") {
+        const auto& nativeState = phase->nativeState();
+        const auto& mw = phase->molecularWeights();
+        const auto& rmw = phase->inverseMolecularWeights();
+        parallelFor(nRows, [&](size_t i) {
+            double* state = m_data->data() + i * m_stride;
+            double* x = comp.data() + i * nSpecies;
+            for (const auto& [name, offset] : nativeState) {
+                if (name != "X" && name != "Y") {
+                    state[offset * m_compStride] = stateData[stateCol.at(name)][i];
+                } else if (convert == "X") {
+                    // mass fractions from mole fractions
+                    double mmw = 0.0;
+                    for (size_t k = 0; k < nSpecies; k++) {
+                        mmw += x[k] * mw[k];
+                    }
+                    for (size_t k = 0; k < nSpecies; k++) {
+                        state[(offset + k) * m_compStride] = x[k] / mmw * mw[k];
+                    }
+                } else if (convert == "Y") {
+                    // mole fractions from mass fractions
+                    double sum = 0.0;
+                    for (size_t k = 0; k < nSpecies; k++) {
+                        sum += x[k] * rmw[k];
+                    }
+                    for (size_t k = 0; k < nSpecies; k++) {
+                        state[(offset + k) * m_compStride] = x[k] * rmw[k] / sum;
+                    }
+                } else {
+                    for (size_t k = 0; k < nSpecies; k++) {
+                        state[(offset + k) * m_compStride] = x[k];
+                    }
+                }
+            }
+        }, blockSize);
+    } else {
+        const auto& T = stateData[stateCol.at("T")];
+        for (size_t i = 0; i < nRows; i++) {
+            if (mode == "TPY") {
+                phase->setMassFractions_NoNorm(comp.data() + i * nSpecies);
+            } else {
+                phase->setMoleFractions_NoNorm(comp.data() + i * nSpecies);
+            }
+            if (mode == "TDX") {
+                phase->setState_TD(T[i], stateData[stateCol.at("D")][i]);
+            } else {
+                phase->setState_TP(T[i], stateData[stateCol.at("P")][i]);
+            }
+            _saveState(i);
+        }
+    }
+
+    // Restore remaining data, using the narrowest type that holds all entries
+    vector<AnyValue> extras(nCols);
+    parallelFor(nCols, [&](size_t col) {
+        if (isState[col] || speciesCol[col] != npos) {
+            return;
+        }
+        if (!convertCsvColumn<long int>(extraData[col], extras[col]) &&
+            !convertCsvColumn<double>(extraData[col], extras[col]))
+        {
+            extras[col] = std::move(extraData[col]);
+        }
+    });
+    bool back = false;
+    for (size_t col = 0; col < nCols; col++) {
+        if (isState[col] || speciesCol[col] != npos) {
+            back = true;
+        } else {
+            addExtra(labels[col], back);
+            setComponent(labels[col], extras[col]);
+        }
+    }
+}
+
 void SolutionArray::readEntry(const string& fname, const string& name,
                               const string& sub)
 {
@@ -1712,7 +2486,6 @@ void SolutionArray::readEntry(const string& fname, const string& name,
 
     // restore state data
     size_t nSpecies = m_sol->thermo()->nSpecies();
-    size_t nState = m_sol->thermo()->stateSize();
     const auto& nativeStates = m_sol->thermo()->nativeState();
     if (mode == "native") {
         // native state can be written directly into data storage
@@ -1722,8 +2495,10 @@ void SolutionArray::readEntry(const string& fname, const string& name,
                 data = file.readData(path, name, m_size, nSpecies);
                 auto prop = data.asVector<vector<double>>();
                 for (size_t i = 0; i < m_dataSize; i++) {
-                    std::copy(prop[i].begin(), prop[i].end(),
-                              m_data->data() + offset + i * m_stride);
+                    for (size_t k = 0; k < nSpecies; k++) {
+                        (*m_data)[i * m_stride + (offset + k) * m_compStride] =
+                            prop[i][k];
+                    }
                 }
             } else {
                 AnyValue data;
@@ -1742,7 +2517,7 @@ void SolutionArray::readEntry(const string& fname, const string& name,
         for (size_t i = 0; i < m_dataSize; i++) {
             m_sol->thermo()->setMoleFractions_NoNorm(X[i].data());
             m_sol->thermo()->setState_TP(T[i], P[i]);
-            m_sol->thermo()->saveState(nState, m_data->data() + i * m_stride);
+            _saveState(i);
         }
     } else if (mode == "TDX") {
         AnyValue data;
@@ -1755,7 +2530,7 @@ void SolutionArray::readEntry(const string& fname, const string& name,
         for (size_t i = 0; i < m_dataSize; i++) {
             m_sol->thermo()->setMoleFractions_NoNorm(X[i].data());
             m_sol->thermo()->setState_TD(T[i], D[i]);
-            m_sol->thermo()->saveState(nState, m_data->data() + i * m_stride);
+            _saveState(i);
         }
     } else if (mode == "TPY") {
         AnyValue data;
@@ -1768,7 +2543,7 @@ void SolutionArray::readEntry(const string& fname, const string& name,
         for (size_t i = 0; i < m_dataSize; i++) {
             m_sol->thermo()->setMassFractions_NoNorm(Y[i].data());
             m_sol->thermo()->setState_TP(T[i], P[i]);
-            m_sol->thermo()->saveState(nState, m_data->data() + i * m_stride);
+            _saveState(i);
         }
     } else if (mode == "legacySurf") {
         // erroneous TDX mode (should be TPX or TPY) - Sim1D (Cantera 2.5)
@@ -1780,7 +2555,7 @@ void SolutionArray::readEntry(const string& fname, const string& name,
         for (size_t i = 0; i < m_dataSize; i++) {
             m_sol->thermo()->setMoleFractions_NoNorm(X[i].data());
             m_sol->thermo()->setTemperature(T[i]);
-            m_sol->thermo()->saveState(nState, m_data->data() + i * m_stride);
+            _saveState(i);
         }
         warn_user("SolutionArray::readEntry",
             "Detected legacy HDF format with incomplete state information\nfor name "
@@ -1864,7 +2639,6 @@ void SolutionArray::readEntry(const AnyMap& root, const string& name, const stri
     // restore data
     set<string> exclude = {"size", "api-shape", "points", "X", "Y"};
     set<string> names = path.keys();
-    size_t nState = m_sol->thermo()->stateSize();
     if (m_dataSize == 0) {
         // no data points
     } else if (m_dataSize == 1) {
@@ -1898,7 +2672,7 @@ void SolutionArray::readEntry(const AnyMap& root, const string& name, const stri
             throw NotImplementedError("SolutionArray::readEntry",
                 "Import of '{}' data is not supported.", mode);
         }
-        m_sol->thermo()->saveState(nState, m_data->data());
+        _saveState(0);
         auto props = _stateProperties(mode, true);
         exclude.insert(props.begin(), props.end());
     } else {
@@ -1950,11 +2724,16 @@ void SolutionArray::readEntry(const AnyMap& root, const string& name, const stri
             const size_t offset_T = nativeState.find("T")->second;
             const size_t offset_D = nativeState.find("D")->second;
             const size_t offset_Y = nativeState.find("Y")->second;
+            size_t nSpecies = m_sol->thermo()->nSpecies();
+            vector<double> Y(nSpecies);
             for (size_t i = 0; i < m_dataSize; i++) {
-                double T = (*m_data)[offset_T + i * m_stride];
-                m_sol->thermo()->setState_TPY(
-                    T, P, m_data->data() + offset_Y + i * m_stride);
-                (*m_data)[offset_D + i * m_stride] = m_sol->thermo()->density();
+                double T = (*m_data)[offset_T * m_compStride + i * m_stride];
+                for (size_t k = 0; k < nSpecies; k++) {
+                    Y[k] = (*m_data)[(offset_Y + k) * m_compStride + i * m_stride];
+                }
+                m_sol->thermo()->setState_TPY(T, P, Y.data());
+                (*m_data)[offset_D * m_compStride + i * m_stride] =
+                    m_sol->thermo()->density();
             }
         } else if (missingProps.size()) {
             throw CanteraError("SolutionArray::readEntry",
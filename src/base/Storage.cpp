@@ -77,6 +77,36 @@ void Storage::setCompressionLevel(int level)
     m_compressionLevel = level;
 }
 
+void Storage::setChunkSize(size_t rows)
+{
+    m_chunkSize = rows;
+}
+
+void Storage::setShuffle(bool shuffle)
+{
+    m_shuffle = shuffle;
+}
+
+//! Add chunking to properties of a data set with shape *dims*, where chunks span
+//! *chunkRows* rows; compression is applied if *level* is non-zero. For matrices,
+//! the number of columns must be non-zero.
+void setChunking(h5::DataSetCreateProps& props, const vector<size_t>& dims,
+                 size_t chunkRows, int level, bool shuffle)
+{
+    vector<hsize_t> chunk;
+    chunk.push_back(std::max<size_t>(chunkRows, 1));
+    if (dims.size() == 2) {
+        chunk.push_back(dims[1]);
+    }
+    props.add(h5::Chunking(chunk));
+    if (shuffle && level) {
+        props.add(h5::Shuffle());
+    }
+    if (level) {
+        props.add(h5::Deflate(level));
+    }
+}
+
 bool Storage::hasGroup(const string& id) const
 {
     if (!m_file->exist(id)) {
@@ -297,12 +327,15 @@ AnyMap Storage::readAttributes(const string& id, bool recursive) const
     }
 }
 
-void writeH5Attributes(h5::Group sub, const AnyMap& meta)
+void writeH5Attributes(h5::Group sub, const AnyMap& meta, bool overwrite)
 {
     for (auto& [name, item] : meta) {
         if (sub.hasAttribute(name)) {
-            throw NotImplementedError("writeH5Attributes",
-                "Unable to overwrite existing Attribute '{}'", name);
+            if (!overwrite) {
+                throw NotImplementedError("writeH5Attributes",
+                    "Unable to overwrite existing Attribute '{}'", name);
+            }
+            sub.deleteAttribute(name);
         }
         if (item.is<long int>()) {
             int value = item.asInt();
@@ -354,8 +387,15 @@ void writeH5Attributes(h5::Group sub, const AnyMap& meta)
         } else if (item.is<AnyMap>()) {
             // step into recursion
             auto value = item.as<AnyMap>();
-            auto grp = sub.createGroup(name);
-            writeH5Attributes(grp, value);
+            if (sub.exist(name)) {
+                if (!overwrite) {
+                    throw NotImplementedError("writeH5Attributes",
+                        "Unable to overwrite existing Attribute group '{}'", name);
+                }
+                writeH5Attributes(sub.getGroup(name), value, overwrite);
+            } else {
+                writeH5Attributes(sub.createGroup(name), value, overwrite);
+            }
         } else {
             throw NotImplementedError("writeH5Attributes",
                 "Unable to write attribute '{}' with type '{}'",
@@ -364,12 +404,12 @@ void writeH5Attributes(h5::Group sub, const AnyMap& meta)
     }
 }
 
-void Storage::writeAttributes(const string& id, const AnyMap& meta)
+void Storage::writeAttributes(const string& id, const AnyMap& meta, bool overwrite)
 {
     try {
         checkGroupWrite(id, false);
         h5::Group sub = m_file->getGroup(id);
-        writeH5Attributes(sub, meta);
+        writeH5Attributes(sub, meta, overwrite);
     } catch (const Cantera::NotImplementedError& err) {
         throw NotImplementedError("Storage::writeAttribute",
             "{} in group '{}'.", err.getMessage(), id);
@@ -505,69 +545,159 @@ void Storage::writeData(const string& id, const string& name, const AnyValue& da
             "Cannot write DataSet '{}' in group '{}' as input data with type\n"
             "'{}'\nis neither a vector nor a matrix.", name, id, data.type_str());
     }
-    vector<size_t> dims{data.vectorSize()};
+    vector<size_t> dims;
+    if (size != npos) {
+        dims.push_back(size);
+    } else if (cols != npos) {
+        dims.push_back(rows);
+        dims.push_back(cols);
+    } else {
+        throw NotImplementedError("Storage::writeData",
+            "Cannot write DataSet '{}' in group '{}' as input data with type\n"
+            "'{}'\nis not supported.", name, id, data.type_str());
+    }
+    h5::DataSpace space(dims);
+    h5::DataSetCreateProps props;
+    if (m_compressionLevel && dims[0] && (dims.size() == 1 || dims[1])) {
+        // By default, use a single chunk and apply compression level; for caveats, see
+        // https://stackoverflow.com/questions/32994766/compressed-files-bigger-in-h5py
+        size_t chunkRows = m_chunkSize ? std::min(m_chunkSize, dims[0]) : dims[0];
+        setChunking(props, dims, chunkRows, m_compressionLevel, m_shuffle);
+    }
     if (data.isVector<long int>()) {
-        h5::DataSet dataset = sub.createDataSet<long int>(name, h5::DataSpace(dims));
+        h5::DataSet dataset = sub.createDataSet<long int>(name, space, props);
         dataset.write(data.asVector<long int>());
-        return;
-    }
-    if (data.isVector<double>()) {
-        h5::DataSet dataset = sub.createDataSet<double>(name, h5::DataSpace(dims));
+    } else if (data.isVector<double>()) {
+        h5::DataSet dataset = sub.createDataSet<double>(name, space, props);
         dataset.write(data.asVector<double>());
-        return;
-    }
-    if (data.isVector<string>()) {
-        h5::DataSet dataset = sub.createDataSet<string>(name, h5::DataSpace(dims));
+    } else if (data.isVector<string>()) {
+        h5::DataSet dataset = sub.createDataSet<string>(name, space, props);
         dataset.write(data.asVector<string>());
-        return;
-    }
-    if (cols != npos) {
-        dims.clear();
-        dims.push_back(rows);
-        dims.push_back(cols);
+    } else if (data.isVector<vector<long int>>()) {
+        h5::DataSet dataset = sub.createDataSet<long int>(name, space, props);
+        dataset.write(data.asVector<vector<long int>>());
+    } else if (data.isVector<vector<double>>()) {
+        h5::DataSet dataset = sub.createDataSet<double>(name, space, props);
+        dataset.write(data.asVector<vector<double>>());
+    } else if (data.isVector<vector<string>>()) {
+        h5::DataSet dataset = sub.createDataSet<string>(name, space, props);
+        dataset.write(data.asVector<vector<string>>());
     } else {
         throw NotImplementedError("Storage::writeData",
             "Cannot write DataSet '{}' in group '{}' as input data with type\n"
             "'{}'\nis not supported.", name, id, data.type_str());
     }
-    if (m_compressionLevel) {
-        // Set chunk size to single chunk and apply compression level; for caveats, see
-        // https://stackoverflow.com/questions/32994766/compressed-files-bigger-in-h5py
-        h5::DataSpace space(dims, dims); //{h5::DataSpace::UNLIMITED, dims[1]});
-        h5::DataSetCreateProps props;
-        props.add(h5::Chunking(vector<hsize_t>{dims[0], dims[1]}));
-        props.add(h5::Deflate(m_compressionLevel));
-        if (data.isVector<vector<long int>>()) {
-            h5::DataSet dataset = sub.createDataSet<long int>(name, space, props);
-            dataset.write(data.asVector<vector<long int>>());
-        } else if (data.isVector<vector<double>>()) {
-            h5::DataSet dataset = sub.createDataSet<double>(name, space, props);
-            dataset.write(data.asVector<vector<double>>());
-        } else if (data.isVector<vector<string>>()) {
-            h5::DataSet dataset = sub.createDataSet<string>(name, space, props);
-            dataset.write(data.asVector<vector<string>>());
-        } else {
-            throw NotImplementedError("Storage::writeData",
-                "Cannot write DataSet '{}' in group '{}' as input data with type\n"
-                "'{}'\nis not supported.", name, id, data.type_str());
-        }
+}
+
+template<class T, class V>
+size_t appendH5Data(h5::Group& sub, const string& name, const V& values,
+                    const vector<size_t>& count, const h5::DataSetCreateProps& props)
+{
+    if (!sub.exist(name)) {
+        // create empty data set that is unlimited along the first dimension
+        vector<size_t> dims = count;
+        vector<size_t> maxDims = count;
+        dims[0] = 0;
+        maxDims[0] = h5::DataSpace::UNLIMITED;
+        sub.createDataSet<T>(name, h5::DataSpace(dims, maxDims), props);
+    }
+    h5::DataSet dataset = sub.getDataSet(name);
+    h5::DataSpace space = dataset.getSpace();
+    if (space.getMaxDimensions()[0] != h5::DataSpace::UNLIMITED) {
+        throw CanteraError("Storage::appendData",
+            "DataSet '{}' is not extendible", name);
+    }
+    if (dataset.getDataType().getClass() != h5::create_datatype<T>().getClass()) {
+        throw CanteraError("Storage::appendData",
+            "Data type of DataSet '{}' does not match data to be appended", name);
+    }
+    vector<size_t> dims = space.getDimensions();
+    if (dims.size() != count.size() || (dims.size() == 2 && dims[1] != count[1])) {
+        throw CanteraError("Storage::appendData",
+            "Shape of DataSet '{}' is inconsistent with data to be appended", name);
+    }
+    if (!count[0]) {
+        return dims[0];
+    }
+    vector<size_t> offset(dims.size(), 0);
+    offset[0] = dims[0];
+    dims[0] += count[0];
+    dataset.resize(dims);
+    dataset.select(offset, count).write(values);
+    return dims[0];
+}
+
+size_t Storage::appendData(const string& id, const string& name, const AnyValue& data)
+{
+    try {
+        checkGroupWrite(id, false);
+    } catch (const CanteraError& err) {
+        // rethrow with public method attribution
+        throw CanteraError("Storage::appendData", "{}", err.getMessage());
+    } catch (const std::exception& err) {
+        // convert HighFive exception
+        throw CanteraError("Storage::appendData",
+            "Encountered exception for group '{}':\n{}", id, err.what());
+    }
+    h5::Group sub = m_file->getGroup(id);
+    size_t size = data.vectorSize();
+    auto [rows, cols] = data.matrixShape();
+    vector<size_t> count;
+    if (size != npos) {
+        count.push_back(size);
+    } else if (rows != npos && cols != npos) {
+        count.push_back(rows);
+        count.push_back(cols);
     } else {
-        h5::DataSpace space(dims);
-        if (data.isVector<vector<long int>>()) {
-            h5::DataSet dataset = sub.createDataSet<long int>(name, space);
-            dataset.write(data.asVector<vector<long int>>());
+        throw CanteraError("Storage::appendData",
+            "Cannot append to DataSet '{}' in group '{}' as input data with type\n"
+            "'{}'\nis neither a vector nor a matrix.", name, id, data.type_str());
+    }
+    if (count.size() == 2 && !count[1]) {
+        // chunk dimensions must be nonzero and may not exceed fixed dimensions
+        throw CanteraError("Storage::appendData",
+            "Cannot append to DataSet '{}' in group '{}' as extendible data sets "
+            "require a nonzero number of columns.", name, id);
+    }
+    size_t chunkRows = m_chunkSize;
+    if (!chunkRows) {
+        size_t rowSize = sizeof(double) * (count.size() == 2 ? count[1] : 1);
+        chunkRows = 65536 / std::max<size_t>(rowSize, 1);
+    }
+    h5::DataSetCreateProps props;
+    setChunking(props, count, chunkRows, m_compressionLevel, m_shuffle);
+    try {
+        if (data.isVector<long int>()) {
+            return appendH5Data<long int>(sub, name, data.asVector<long int>(),
+                                          count, props);
+        } else if (data.isVector<double>()) {
+            return appendH5Data<double>(sub, name, data.asVector<double>(),
+                                        count, props);
+        } else if (data.isVector<string>()) {
+            return appendH5Data<string>(sub, name, data.asVector<string>(),
+                                        count, props);
+        } else if (data.isVector<vector<long int>>()) {
+            return appendH5Data<long int>(sub, name, data.asVector<vector<long int>>(),
+                                          count, props);
         } else if (data.isVector<vector<double>>()) {
-            h5::DataSet dataset = sub.createDataSet<double>(name, space);
-            dataset.write(data.asVector<vector<double>>());
+            return appendH5Data<double>(sub, name, data.asVector<vector<double>>(),
+                                        count, props);
         } else if (data.isVector<vector<string>>()) {
-            h5::DataSet dataset = sub.createDataSet<string>(name, space);
-            dataset.write(data.asVector<vector<string>>());
-        } else {
-            throw NotImplementedError("Storage::writeData",
-                "Cannot write DataSet '{}' in group '{}' as input data with type\n"
-                "'{}'\nis not supported.", name, id, data.type_str());
+            return appendH5Data<string>(sub, name, data.asVector<vector<string>>(),
+                                        count, props);
         }
+    } catch (const CanteraError& err) {
+        throw CanteraError("Storage::appendData", "{} in group '{}'.",
+                           err.getMessage(), id);
+    } catch (const std::exception& err) {
+        // convert HighFive exception
+        throw CanteraError("Storage::appendData",
+            "Encountered HighFive exception for DataSet '{}' in group '{}':\n{}",
+            name, id, err.what());
     }
+    throw NotImplementedError("Storage::appendData",
+        "Cannot append to DataSet '{}' in group '{}' as input data with type\n"
+        "'{}'\nis not supported.", name, id, data.type_str());
 }
 
 #else
@@ -588,6 +718,18 @@ void Storage::setCompressionLevel(int level)
                        "Saving to HDF requires HighFive installation.");
 }
 
+void Storage::setChunkSize(size_t rows)
+{
+    throw CanteraError("Storage::setChunkSize",
+                       "Saving to HDF requires HighFive installation.");
+}
+
+void Storage::setShuffle(bool shuffle)
+{
+    throw CanteraError("Storage::setShuffle",
+                       "Saving to HDF requires HighFive installation.");
+}
+
 bool Storage::hasGroup(const string& id) const
 {
     throw CanteraError("Storage::hasGroup",
@@ -624,7 +766,7 @@ AnyMap Storage::readAttributes(const string& id, bool recursive) const
                        "Saving to HDF requires HighFive installation.");
 }
 
-void Storage::writeAttributes(const string& id, const AnyMap& meta)
+void Storage::writeAttributes(const string& id, const AnyMap& meta, bool overwrite)
 {
     throw CanteraError("Storage::writeAttributes",
                        "Saving to HDF requires HighFive installation.");
@@ -644,6 +786,13 @@ void Storage::writeData(const string& id,
                        "Saving to HDF requires HighFive installation.");
 }
 
+size_t Storage::appendData(const string& id,
+                           const string& name, const AnyValue& data)
+{
+    throw CanteraError("Storage::appendData",
+                       "Saving to HDF requires HighFive installation.");
+}
+
 #endif
 
 }
@@ -10,6 +10,8 @@
 #include "cantera/base/AnyMap.h"
 #include "cantera/base/utilities.h"
 #include <regex>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace {
 using namespace Cantera;
@@ -128,8 +130,10 @@ Units::Units(double factor, double mass, double length, double time,
     }
 }
 
-Units::Units(const string& name, bool force_unity)
+//! Parse a unit string such as `kg/m^3` or `0.001 m^3/kmol` into a Units object
+static Units parseUnits(const string& name)
 {
+    Units out(1.0);
     size_t start = 0;
 
     // Determine factor
@@ -139,7 +143,7 @@ Units::Units(const string& name, bool force_unity)
     if (matched.size()) {
         string factor = *matched.begin();
         if (name.find(factor) == 0) {
-            m_factor = fpValueCheck(factor);
+            out = Units(fpValueCheck(factor));
             start = factor.size();
         }
     }
@@ -166,16 +170,16 @@ Units::Units(const string& name, bool force_unity)
 
         if (knownUnits.find(unit) != knownUnits.end()) {
             // Incorporate the unit defined by the current group
-            *this *= knownUnits.at(unit).pow(exponent);
+            out *= knownUnits.at(unit).pow(exponent);
         } else {
             // See if the unit looks like a prefix + base unit
             string prefix = unit.substr(0, 1);
             string suffix = unit.substr(1);
             if (prefixes.find(prefix) != prefixes.end() &&
                 knownUnits.find(suffix) != knownUnits.end()) {
-                Units u = knownUnits.at(suffix);
-                u.scale(prefixes.at(prefix));
-                *this *= u.pow(exponent);
+                Units u(prefixes.at(prefix));
+                u *= knownUnits.at(suffix);
+                out *= u.pow(exponent);
             } else {
                 throw CanteraError("Units::Units(string)",
                     "Unknown unit '{}' in unit string '{}'", unit, name);
@@ -187,7 +191,41 @@ Units::Units(const string& name, bool force_unity)
             break;
         }
     }
+    return out;
+}
 
+//! Look up the parsed form of a unit string, parsing and caching it on first use.
+//!
+//! Input files typically use a handful of distinct unit strings which are each
+//! converted many times while species and reactions are created, possibly from
+//! several threads at once. Caching the parsed form avoids repeating the regular
+//! expression match and tokenization for every converted quantity. Strings that
+//! fail to parse are not cached, so errors are reported on every use.
+static Units cachedUnits(const string& name)
+{
+    // Upper bound on the number of cached strings, which guards against unbounded
+    // growth if an application generates many distinct unit strings
+    const size_t maxCacheSize = 4096;
+    static std::shared_mutex mutex;
+    static std::unordered_map<string, Units> cache;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto iter = cache.find(name);
+        if (iter != cache.end()) {
+            return iter->second;
+        }
+    }
+    Units parsed = parseUnits(name);
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    if (cache.size() < maxCacheSize) {
+        cache.emplace(name, parsed);
+    }
+    return parsed;
+}
+
+Units::Units(const string& name, bool force_unity)
+{
+    *this = cachedUnits(name);
     if (force_unity && (std::abs(m_factor - 1.) > SmallNumber)) {
         throw CanteraError("Units::Units(string)",
             "Detected non-unity conversion factor:\n"
@@ -381,7 +419,11 @@ Units UnitStack::product() const
     }
     Units out = Units(1.);
     for (auto& [units, exponent] : stack) {
-        if (exponent == 1) {
+        if (exponent == 0) {
+            // Typical for the standard units of reactions where all reactants are
+            // in the same phase; skip the unnecessary power evaluation
+            continue;
+        } else if (exponent == 1) {
             out *= units;
         } else {
             out *= units.pow(exponent);
@@ -522,7 +564,7 @@ void UnitSystem::setDefaultActivationEnergy(const string& e_units)
 {
     Units u(e_units);
     m_defaults["activation-energy"] = e_units;
-    if (u.convertible(Units("J/kmol"))) {
+    if (u.convertible(knownUnits.at("J/kmol"))) {
         m_activation_energy_factor = u.factor();
     } else if (u.convertible(knownUnits.at("K"))) {
         m_activation_energy_factor = GasConstant;
@@ -675,11 +717,11 @@ double UnitSystem::convertActivationEnergy(double value, const string& src,
 {
     // Convert to J/kmol
     Units usrc(src);
-    if (usrc.convertible(Units("J/kmol"))) {
+    if (usrc.convertible(knownUnits.at("J/kmol"))) {
         value *= usrc.factor();
-    } else if (usrc.convertible(Units("K"))) {
+    } else if (usrc.convertible(knownUnits.at("K"))) {
         value *= GasConstant * usrc.factor();
-    } else if (usrc.convertible(Units("eV"))) {
+    } else if (usrc.convertible(knownUnits.at("eV"))) {
         value *= Avogadro * usrc.factor();
     } else {
         throw CanteraError("UnitSystem::convertActivationEnergy",
@@ -688,11 +730,11 @@ double UnitSystem::convertActivationEnergy(double value, const string& src,
 
     // Convert from J/kmol
     Units udest(dest);
-    if (udest.convertible(Units("J/kmol"))) {
+    if (udest.convertible(knownUnits.at("J/kmol"))) {
         value /= udest.factor();
-    } else if (udest.convertible(Units("K"))) {
+    } else if (udest.convertible(knownUnits.at("K"))) {
         value /= GasConstant * udest.factor();
-    } else if (udest.convertible(Units("eV"))) {
+    } else if (udest.convertible(knownUnits.at("eV"))) {
         value /= Avogadro * udest.factor();
     } else {
         throw CanteraError("UnitSystem::convertActivationEnergy",
@@ -710,7 +752,7 @@ double UnitSystem::convertActivationEnergyTo(double value, const string& dest) c
 double UnitSystem::convertActivationEnergyTo(double value,
                                              const Units& dest) const
 {
-    if (dest.convertible(Units("J/kmol"))) {
+    if (dest.convertible(knownUnits.at("J/kmol"))) {
         return value * m_activation_energy_factor / dest.factor();
     } else if (dest.convertible(knownUnits.at("K"))) {
         return value * m_activation_energy_factor / GasConstant;
@@ -725,7 +767,7 @@ double UnitSystem::convertActivationEnergyTo(double value,
 double UnitSystem::convertActivationEnergyFrom(double value, const string& src) const
 {
     Units usrc(src);
-    if (usrc.convertible(Units("J/kmol"))) {
+    if (usrc.convertible(knownUnits.at("J/kmol"))) {
         return value * usrc.factor() / m_activation_energy_factor;
     } else if (usrc.convertible(knownUnits.at("K"))) {
         return value * GasConstant / m_activation_energy_factor;
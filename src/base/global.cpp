@@ -12,6 +12,8 @@
 #include <boost/core/demangle.hpp>
 
 #include <signal.h>
+#include <thread>
+#include <condition_variable>
 
 namespace Cantera
 {
@@ -129,10 +131,208 @@ void printStackTraceOnSegfault()
     ::signal(SIGABRT, &stacktraceWriter);
 }
 
+// **************** Parallel Execution ****************
+
+namespace {
+
+//! True for threads which are executing work for parallelFor()
+thread_local bool t_inParallelFor = false;
+
+//! Logger used by worker threads while running tasks for parallelFor(). Messages
+//! are stored and then written by the calling thread after all tasks are complete,
+//! so they reach the logger installed for that thread, which may not be safe to
+//! use from other threads.
+class DeferredLogger : public Logger
+{
+public:
+    //! A stored message, with the Logger method used to write it
+    struct Message
+    {
+        enum { Write, EndLine, Warning } method;
+        string warning;
+        string text;
+    };
+
+    explicit DeferredLogger(vector<Message>& messages) : m_messages(messages) {}
+
+    void write(const string& msg) override {
+        m_messages.push_back({Message::Write, "", msg});
+    }
+
+    void writeendl() override {
+        m_messages.push_back({Message::EndLine, "", ""});
+    }
+
+    void warn(const string& warning, const string& msg) override {
+        m_messages.push_back({Message::Warning, warning, msg});
+    }
+
+    //! Write stored messages using the logger of the calling thread
+    static void replay(const vector<Message>& messages) {
+        for (const auto& msg : messages) {
+            if (msg.method == Message::Write) {
+                app()->writelog(msg.text);
+            } else if (msg.method == Message::EndLine) {
+                app()->writelogendl();
+            } else {
+                app()->warnlog(msg.warning, msg.text);
+            }
+        }
+    }
+
+private:
+    vector<Message>& m_messages;
+};
+
+//! Persistent set of worker threads used by parallelFor()
+class ThreadPool
+{
+public:
+    explicit ThreadPool(size_t nWorkers) {
+        for (size_t i = 0; i < nWorkers; i++) {
+            m_threads.emplace_back([this]() { workerLoop(); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_start.notify_all();
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    size_t nWorkers() const {
+        return m_threads.size();
+    }
+
+    //! Call `task(t)` for each `t` in [1, `nTasks`) using the worker threads, and
+    //! `task(0)` from the calling thread. Returns once all tasks are complete.
+    //! `task` must not throw exceptions.
+    void run(size_t nTasks, const function<void(size_t)>& task) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_task = &task;
+            m_nTasks = nTasks;
+            m_next = 1;
+            m_pending = nTasks - 1;
+        }
+        m_start.notify_all();
+        task(0);
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this]() { return m_pending == 0; });
+        m_task = nullptr;
+    }
+
+private:
+    void workerLoop() {
+        t_inParallelFor = true;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_start.wait(lock, [this]() {
+                return m_stop || (m_task && m_next < m_nTasks);
+            });
+            if (m_stop) {
+                break;
+            }
+            size_t t = m_next++;
+            const function<void(size_t)>* task = m_task;
+            lock.unlock();
+            (*task)(t);
+            lock.lock();
+            if (--m_pending == 0) {
+                m_done.notify_all();
+            }
+        }
+        lock.unlock();
+        thread_complete();
+    }
+
+    vector<std::thread> m_threads;
+    std::mutex m_mutex;
+    std::condition_variable m_start; //!< Signals new tasks or shutdown to workers
+    std::condition_variable m_done; //!< Signals completion of all tasks
+    const function<void(size_t)>* m_task = nullptr;
+    size_t m_nTasks = 0; //!< Number of tasks in the current job
+    size_t m_next = 0; //!< Index of the next task to be started
+    size_t m_pending = 0; //!< Number of tasks not yet completed by the workers
+    bool m_stop = false;
+};
+
+//! Mutex held while the thread pool is in use or being created / destroyed
+std::mutex pool_mutex;
+
+//! Thread pool used by parallelFor(). The pool is deleted by appdelete() but is
+//! otherwise intentionally leaked, since joining the worker threads during static
+//! destruction may access the already destroyed Application (through
+//! thread_complete()) or deadlock while unloading a shared library on Windows.
+ThreadPool* s_pool = nullptr;
+
+} // end unnamed namespace
+
+void parallelFor(size_t n, const function<void(size_t)>& func, size_t grain)
+{
+    size_t nThreads = std::min<size_t>(std::thread::hardware_concurrency(),
+                                       n / std::max<size_t>(grain, 1));
+    std::unique_lock<std::mutex> poolLock(pool_mutex, std::defer_lock);
+    // Nested calls, and calls made while another thread is using the pool, run
+    // serially on the calling thread
+    if (nThreads < 2 || t_inParallelFor || !poolLock.try_lock()) {
+        for (size_t i = 0; i < n; i++) {
+            func(i);
+        }
+        return;
+    }
+    if (!s_pool) {
+        s_pool = new ThreadPool(std::thread::hardware_concurrency() - 1);
+    }
+    nThreads = std::min(nThreads, s_pool->nWorkers() + 1);
+    vector<std::exception_ptr> errors(nThreads);
+    vector<vector<DeferredLogger::Message>> messages(nThreads);
+    auto task = [&](size_t t) {
+        size_t start = t * n / nThreads;
+        size_t stop = (t + 1) * n / nThreads;
+        if (t > 0) {
+            // running on a worker thread
+            app()->setLogger(new DeferredLogger(messages[t]));
+        }
+        try {
+            for (size_t i = start; i < stop; i++) {
+                func(i);
+            }
+        } catch (...) {
+            errors[t] = std::current_exception();
+        }
+        if (t > 0) {
+            app()->setLogger(new Logger());
+        }
+    };
+    t_inParallelFor = true;
+    s_pool->run(nThreads, task);
+    t_inParallelFor = false;
+    poolLock.unlock();
+    for (const auto& taskMessages : messages) {
+        DeferredLogger::replay(taskMessages);
+    }
+    for (auto& err : errors) {
+        if (err) {
+            std::rethrow_exception(err);
+        }
+    }
+}
+
 // **************** Global Data ****************
 
 void appdelete()
 {
+    {
+        std::unique_lock<std::mutex> poolLock(pool_mutex);
+        delete s_pool;
+        s_pool = nullptr;
+    }
     Application::ApplicationDestroy();
     FactoryBase::deleteFactories();
 }
@@ -53,6 +53,7 @@ void ChemEquil::initialize(ThermoPhase& s)
     m_kk = s.nSpecies();
     m_mm = s.nElements();
     m_nComponents = m_mm;
+    m_lastSoln.clear();
 
     // allocate space in internal work arrays within the ChemEquil object
     m_molefractions.resize(m_kk);
@@ -292,7 +293,9 @@ int ChemEquil::estimateElementPotentials(ThermoPhase& s, vector<double>& lambda_
 
 int ChemEquil::equilibrate(ThermoPhase& s, const char* XY, int loglevel)
 {
-    initialize(s);
+    if (m_phase != &s || m_kk != s.nSpecies() || m_mm != s.nElements()) {
+        initialize(s);
+    }
     update(s);
     vector<double> elMolesGoal = m_elementmolefracs;
     return equilibrate(s, XY, elMolesGoal, loglevel-1);
@@ -301,11 +304,9 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XY, int loglevel)
 int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
                            vector<double>& elMolesGoal, int loglevel)
 {
-    int fail = 0;
     bool tempFixed = true;
     int XY = _equilflag(XYstr);
-    vector<double> state;
-    s.saveState(state);
+    s.saveState(m_state);
     m_loglevel = loglevel;
 
     // Check Compatibility
@@ -314,8 +315,6 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
                            "Input ThermoPhase is incompatible with initialization");
     }
 
-    initialize(s);
-    update(s);
     switch (XY) {
     case TP:
     case PT:
@@ -371,11 +370,35 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
     double xval = m_p1(s);
     double yval = m_p2(s);
 
-    size_t mm = m_mm;
-    size_t nvar = mm + 1;
-    DenseMatrix jac(nvar, nvar); // Jacobian
-    vector<double> x(nvar, -102.0); // solution vector
-    vector<double> res_trial(nvar, 0.0); // residual
+    // If continuing from a previous solution, start the Newton iteration
+    // directly from the last converged element potentials and temperature. For
+    // nearby states, this converges in a few iterations and avoids the cost of
+    // estimating the initial composition and element potentials.
+    if (options.contin && m_lastSoln.size() == m_mm + 1) {
+        update(s);
+        m_x = m_lastSoln;
+        if (tempFixed) {
+            m_x[m_mm] = log(s.temperature());
+        }
+        try {
+            return solveNewton(s, m_x, elMolesGoal, xval, yval,
+                std::min(options.maxContinuationIterations, options.maxIterations),
+                loglevel);
+        } catch (CanteraError&) {
+            s.restoreState(m_state);
+            if (m_loglevel > 0) {
+                writelog("ChemEquil::equilibrate: continuation from previous "
+                         "solution failed; restarting from initial estimate.\n");
+            }
+        }
+    }
+
+    initialize(s);
+    update(s);
+
+    size_t nvar = m_mm + 1;
+    vector<double>& x = m_x; // solution vector
+    x.assign(nvar, -102.0);
 
     // Replace one of the element abundance fraction equations with the
     // specified property calculation.
@@ -504,11 +527,29 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
     // Install the log(temp) into the last solution unknown slot.
     x[m_mm] = log(s.temperature());
 
+    return solveNewton(s, x, elMolesGoal, xval, yval, options.maxIterations,
+                       loglevel);
+}
+
+int ChemEquil::solveNewton(ThermoPhase& s, vector<double>& x,
+                           vector<double>& elMolesGoal, double xval, double yval,
+                           int maxIter, int loglevel)
+{
+    int fail = 0;
+    size_t mm = m_mm;
+    size_t nvar = mm + 1;
+    DenseMatrix& jac = m_jac; // Jacobian
+    jac.resize(nvar, nvar);
+    vector<double>& res_trial = m_resid; // residual
+    res_trial.assign(nvar, 0.0);
+
     // Setting the max and min values for x[]. Also, if element abundance vector
     // is zero, setting x[] to -1000. This effectively zeroes out all species
     // containing that element.
-    vector<double> above(nvar);
-    vector<double> below(nvar);
+    vector<double>& above = m_above;
+    vector<double>& below = m_below;
+    above.resize(nvar);
+    below.resize(nvar);
     for (size_t m = 0; m < mm; m++) {
         above[m] = 200.0;
         below[m] = -2000.0;
@@ -522,11 +563,12 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
     above[mm] = log(s.maxTemp() + 25.0);
     below[mm] = log(s.minTemp() - 25.0);
 
-    vector<double> grad(nvar, 0.0); // gradient of f = F*F/2
-    vector<double> oldx(nvar, 0.0); // old solution
-    vector<double> oldresid(nvar, 0.0);
+    vector<double>& grad = m_grad; // gradient of f = F*F/2
+    vector<double>& oldx = m_oldx; // old solution
+    grad.assign(nvar, 0.0);
+    oldx.assign(nvar, 0.0);
 
-    for (int iter = 0; iter < options.maxIterations; iter++) {
+    for (int iter = 0; iter < maxIter; iter++) {
         // check for convergence.
         equilResidual(s, x, elMolesGoal, res_trial, xval, yval);
         double f = 0.5*dot(res_trial.begin(), res_trial.end(), res_trial.begin());
@@ -574,6 +616,7 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
                     "Temperature ({} K) outside valid range of {} K "
                     "to {} K", s.temperature(), s.minTemp(), s.maxTemp());
             }
+            m_lastSoln = x;
             return 0;
         }
         // compute the residual and the Jacobian using the current
@@ -611,9 +654,9 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
 
         // Solve the system
         try {
-            info = solve(jac, res_trial.data());
+            solve(jac, res_trial.data());
         } catch (CanteraError& err) {
-            s.restoreState(state);
+            s.restoreState(m_state);
             throw CanteraError("ChemEquil::equilibrate",
                                "Jacobian is singular. \nTry adding more species, "
                                "changing the elemental composition slightly, \nor removing "
@@ -655,7 +698,7 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
                       x, f, elMolesGoal , xval, yval)) {
             fail++;
             if (fail > 3) {
-                s.restoreState(state);
+                s.restoreState(m_state);
                 throw CanteraError("ChemEquil::equilibrate",
                                    "Cannot find an acceptable Newton damping coefficient.");
             }
@@ -665,9 +708,9 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
     }
 
     // no convergence
-    s.restoreState(state);
+    s.restoreState(m_state);
     throw CanteraError("ChemEquil::equilibrate",
-                       "no convergence in {} iterations.", options.maxIterations);
+                       "no convergence in {} iterations.", maxIter);
 }
 
 
@@ -0,0 +1,283 @@
+/**
+ *  @file EquilibriumTable.cpp
+ *  Implementation file for class EquilibriumTable.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/equil/EquilibriumTable.h"
+#include "cantera/base/Solution.h"
+#include "cantera/base/SolutionArray.h"
+#include "cantera/base/YamlWriter.h"
+#include "cantera/base/global.h"
+#include "cantera/base/utilities.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+namespace Cantera
+{
+
+EquilibriumTable::EquilibriumTable(shared_ptr<Solution> sol, const string& fuel,
+                                   const string& oxidizer, double Tfuel,
+                                   double Toxidizer)
+    : m_sol(sol)
+    , m_fuel(fuel)
+    , m_oxidizer(oxidizer)
+    , m_Tfuel(Tfuel)
+    , m_Tox(Toxidizer)
+{
+    if (!sol || !sol->thermo()) {
+        throw CanteraError("EquilibriumTable::EquilibriumTable",
+                           "Solution object does not define a phase.");
+    }
+    m_nsp = sol->thermo()->nSpecies();
+    m_nv = m_nsp + 2;
+}
+
+void EquilibriumTable::setGrid(const vector<double>& mixFrac,
+                               const vector<double>& enthalpyDefect,
+                               const vector<double>& pressure)
+{
+    const vector<double>* grids[3] = {&mixFrac, &enthalpyDefect, &pressure};
+    const char* names[3] = {"mixture fraction", "enthalpy defect", "pressure"};
+    for (size_t n = 0; n < 3; n++) {
+        const vector<double>& grid = *grids[n];
+        if (grid.empty()) {
+            throw CanteraError("EquilibriumTable::setGrid",
+                               "The {} grid is empty.", names[n]);
+        }
+        for (size_t i = 1; i < grid.size(); i++) {
+            if (grid[i] <= grid[i-1]) {
+                throw CanteraError("EquilibriumTable::setGrid",
+                                   "The {} grid must be strictly increasing.",
+                                   names[n]);
+            }
+        }
+    }
+    if (mixFrac.front() < 0.0 || mixFrac.back() > 1.0) {
+        throw CanteraError("EquilibriumTable::setGrid",
+                           "Mixture fraction values must be between 0 and 1.");
+    }
+    if (pressure.front() <= 0.0) {
+        throw CanteraError("EquilibriumTable::setGrid",
+                           "Pressure values must be positive.");
+    }
+    m_grid[0] = mixFrac;
+    m_grid[1] = enthalpyDefect;
+    m_grid[2] = pressure;
+    m_data.clear();
+}
+
+void EquilibriumTable::build(int nThreads, int loglevel)
+{
+    if (m_grid[0].empty()) {
+        throw CanteraError("EquilibriumTable::build", "Grid has not been set.");
+    }
+    size_t nLines = m_grid[1].size() * m_grid[2].size();
+    m_data.assign(nLines * m_grid[0].size() * m_nv, 0.0);
+    size_t nt = std::min(static_cast<size_t>(std::max(nThreads, 1)), nLines);
+
+    auto phase = m_sol->thermo();
+    if (nt == 1) {
+        vector<double> state;
+        phase->saveState(state);
+        try {
+            buildLines(*phase, 0, nLines, loglevel);
+        } catch (...) {
+            phase->restoreState(state);
+            m_data.clear();
+            throw;
+        }
+        phase->restoreState(state);
+        return;
+    }
+
+    // Create an independent copy of the phase for each thread, since ThermoPhase
+    // objects cannot be shared between threads
+    YamlWriter writer;
+    writer.addPhase(phase);
+    AnyMap root = AnyMap::fromYamlString(writer.toYamlString());
+    AnyMap& phaseNode = root["phases"].getMapWhere("name", phase->name());
+    vector<shared_ptr<ThermoPhase>> phases;
+    for (size_t t = 0; t < nt; t++) {
+        phases.push_back(newThermo(phaseNode, root));
+    }
+
+    try {
+        parallelFor(nt, [&](size_t t) {
+            buildLines(*phases[t], t * nLines / nt, (t + 1) * nLines / nt, loglevel);
+        });
+    } catch (...) {
+        m_data.clear();
+        throw;
+    }
+}
+
+void EquilibriumTable::buildLines(ThermoPhase& phase, size_t start, size_t stop,
+                                  int loglevel)
+{
+    size_t nZ = m_grid[0].size();
+    size_t nH = m_grid[1].size();
+    for (size_t line = start; line < stop; line++) {
+        size_t iH = line % nH;
+        size_t iP = line / nH;
+        double P = m_grid[2][iP];
+
+        // Enthalpies of the unmixed fuel and oxidizer streams
+        phase.setState_TPX(m_Tfuel, P, m_fuel);
+        double hFuel = phase.enthalpy_mass();
+        phase.setState_TPX(m_Tox, P, m_oxidizer);
+        double hOx = phase.enthalpy_mass();
+
+        // Alternate the direction along the mixture fraction axis, so each
+        // equilibrium calculation is continued from the solution at a
+        // neighboring grid point
+        bool reverse = (line - start) % 2;
+        for (size_t j = 0; j < nZ; j++) {
+            size_t iZ = reverse ? nZ - 1 - j : j;
+            double Z = m_grid[0][iZ];
+            double h = Z * hFuel + (1.0 - Z) * hOx + m_grid[1][iH];
+            phase.setMixtureFraction(Z, m_fuel, m_oxidizer);
+            phase.setState_HP(h, P);
+            phase.equilibrate("HP");
+
+            double* v = &m_data[offset(iZ, iH, iP)];
+            v[0] = phase.temperature();
+            v[1] = phase.density();
+            phase.getMoleFractions(v + 2);
+            if (loglevel > 0) {
+                writelog("EquilibriumTable: Z = {:.4g}, dh = {:.4g}, P = {:.4g}, "
+                         "T = {:.6g}\n", Z, m_grid[1][iH], P, v[0]);
+            }
+        }
+    }
+}
+
+void EquilibriumTable::locate(size_t axis, double x, size_t& i, double& w) const
+{
+    const vector<double>& grid = m_grid[axis];
+    if (grid.size() == 1) {
+        i = 0;
+        w = 0.0;
+        return;
+    }
+    x = clip(x, grid.front(), grid.back());
+    i = std::upper_bound(grid.begin(), grid.end() - 1, x) - grid.begin() - 1;
+    w = (x - grid[i]) / (grid[i+1] - grid[i]);
+}
+
+void EquilibriumTable::interpolateRange(double Z, double dh, double P, size_t first,
+                                        size_t last, double* out) const
+{
+    if (m_data.empty()) {
+        throw CanteraError("EquilibriumTable::interpolateRange",
+                           "Table has not been built.");
+    }
+    size_t i[3];
+    double w[3];
+    locate(0, Z, i[0], w[0]);
+    locate(1, dh, i[1], w[1]);
+    locate(2, P, i[2], w[2]);
+
+    std::fill(out, out + last - first, 0.0);
+    // Sum contributions from the 8 corners of the enclosing cell
+    for (int c = 0; c < 8; c++) {
+        double wc = 1.0;
+        size_t idx[3];
+        for (size_t d = 0; d < 3; d++) {
+            size_t up = (c >> d) & 1;
+            idx[d] = i[d] + up;
+            wc *= up ? w[d] : 1.0 - w[d];
+        }
+        if (wc == 0.0) {
+            continue;
+        }
+        const double* v = &m_data[offset(idx[0], idx[1], idx[2])];
+        for (size_t n = first; n < last; n++) {
+            out[n - first] += wc * v[n];
+        }
+    }
+}
+
+void EquilibriumTable::interpolate(double Z, double dh, double P,
+                                   double* values) const
+{
+    interpolateRange(Z, dh, P, 0, m_nv, values);
+}
+
+void EquilibriumTable::getMoleFractions(double Z, double dh, double P,
+                                        double* X) const
+{
+    interpolateRange(Z, dh, P, 2, m_nv, X);
+}
+
+void EquilibriumTable::save(const string& fname, const string& name,
+                            const string& desc, bool overwrite)
+{
+    if (m_data.empty()) {
+        throw CanteraError("EquilibriumTable::save", "Table has not been built.");
+    }
+    size_t nZ = m_grid[0].size();
+    size_t nH = m_grid[1].size();
+    size_t nP = m_grid[2].size();
+    size_t nPoints = nZ * nH * nP;
+    auto arr = SolutionArray::create(m_sol, static_cast<int>(nPoints));
+    auto phase = m_sol->thermo();
+    vector<double> state;
+    phase->saveState(state);
+    for (size_t loc = 0; loc < nPoints; loc++) {
+        const double* v = &m_data[loc * m_nv];
+        phase->setMoleFractions(v + 2);
+        phase->setState_TD(v[0], v[1]);
+        arr->updateState(static_cast<int>(loc));
+    }
+    phase->restoreState(state);
+    arr->setApiShape({static_cast<long int>(nP), static_cast<long int>(nH),
+                      static_cast<long int>(nZ)});
+
+    AnyMap& meta = arr->meta();
+    meta["fuel"] = m_fuel;
+    meta["oxidizer"] = m_oxidizer;
+    meta["fuel-temperature"] = m_Tfuel;
+    meta["oxidizer-temperature"] = m_Tox;
+    meta["mixture-fraction"] = m_grid[0];
+    meta["enthalpy-defect"] = m_grid[1];
+    meta["pressure"] = m_grid[2];
+    arr->save(fname, name, "", desc, overwrite);
+}
+
+void EquilibriumTable::restore(const string& fname, const string& name)
+{
+    auto arr = SolutionArray::create(m_sol);
+    arr->restore(fname, name);
+    AnyMap& meta = arr->meta();
+    m_fuel = meta["fuel"].asString();
+    m_oxidizer = meta["oxidizer"].asString();
+    m_Tfuel = meta["fuel-temperature"].asDouble();
+    m_Tox = meta["oxidizer-temperature"].asDouble();
+    setGrid(meta["mixture-fraction"].asVector<double>(),
+            meta["enthalpy-defect"].asVector<double>(),
+            meta["pressure"].asVector<double>());
+
+    size_t nPoints = m_grid[0].size() * m_grid[1].size() * m_grid[2].size();
+    if (static_cast<size_t>(arr->size()) != nPoints) {
+        throw CanteraError("EquilibriumTable::restore",
+                           "Size of stored data ({}) does not match the grid "
+                           "size ({}).", arr->size(), nPoints);
+    }
+    auto phase = m_sol->thermo();
+    vector<double> state;
+    phase->saveState(state);
+    m_data.resize(nPoints * m_nv);
+    for (size_t loc = 0; loc < nPoints; loc++) {
+        arr->setLoc(static_cast<int>(loc));
+        double* v = &m_data[loc * m_nv];
+        v[0] = phase->temperature();
+        v[1] = phase->density();
+        phase->getMoleFractions(v + 2);
+    }
+    phase->restoreState(state);
+}
+
+}
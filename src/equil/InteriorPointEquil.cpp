@@ -0,0 +1,386 @@
+/**
+ * @file InteriorPointEquil.cpp
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/equil/InteriorPointEquil.h"
+#include "cantera/numerics/eigen_dense.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/base/global.h"
+
+namespace Cantera
+{
+
+InteriorPointEquil::InteriorPointEquil(MultiPhase* mix) : m_mix(mix)
+{
+    size_t nel_mix = mix->nElements();
+    size_t nsp_mix = mix->nSpecies();
+
+    // Elements which are not present in the mixture are excluded, along with
+    // all species containing them. Electrons are a special case, since a
+    // species can have a negative number of 'atoms' of electrons (positive
+    // ions), and the total number of electrons is usually zero.
+    vector<int> inclSpecies(nsp_mix, 1);
+    vector<int> inclElement(nel_mix, 1);
+    for (size_t m = 0; m < nel_mix; m++) {
+        string enm = mix->elementName(m);
+        if (mix->elementMoles(m) <= 0.0 && enm != "E" && enm != "e") {
+            inclElement[m] = 0;
+            for (size_t k = 0; k < nsp_mix; k++) {
+                if (mix->nAtoms(k, m) != 0.0) {
+                    inclSpecies[k] = 0;
+                }
+            }
+        }
+    }
+    for (size_t k = 0; k < nsp_mix; k++) {
+        if (inclSpecies[k]) {
+            m_species.push_back(k);
+        }
+    }
+    for (size_t m = 0; m < nel_mix; m++) {
+        // Skip elements which do not occur in any of the included species
+        bool used = false;
+        for (size_t k : m_species) {
+            used = used || (mix->nAtoms(k, m) != 0.0);
+        }
+        if (inclElement[m] && used) {
+            m_element.push_back(m);
+        }
+    }
+    m_nsp = m_species.size();
+    m_nel = m_element.size();
+    if (m_nsp == 0) {
+        throw CanteraError("InteriorPointEquil::InteriorPointEquil",
+                           "No species can be included in the calculation.");
+    }
+
+    m_phaseSpecies.resize(mix->nPhases());
+    for (size_t i = 0; i < m_nsp; i++) {
+        m_phaseSpecies[mix->speciesPhaseIndex(m_species[i])].push_back(i);
+    }
+
+    m_A.resize(m_nel, m_nsp);
+    m_b.resize(m_nel);
+    for (size_t m = 0; m < m_nel; m++) {
+        for (size_t k = 0; k < m_nsp; k++) {
+            m_A(m, k) = mix->nAtoms(m_species[k], m_element[m]);
+        }
+        m_b[m] = mix->elementMoles(m_element[m]);
+    }
+
+    // Scale the problem so the total number of moles is of order one
+    m_scale = 0.0;
+    for (size_t k : m_species) {
+        m_scale += mix->speciesMoles(k);
+    }
+    if (m_scale <= 0.0) {
+        for (size_t m = 0; m < m_nel; m++) {
+            m_scale += std::abs(m_b[m]);
+        }
+    }
+    if (m_scale <= 0.0) {
+        throw CanteraError("InteriorPointEquil::InteriorPointEquil",
+                           "Mixture does not contain any moles.");
+    }
+    for (size_t m = 0; m < m_nel; m++) {
+        m_b[m] /= m_scale;
+    }
+
+    m_n.resize(m_nsp);
+    m_z.resize(m_nsp);
+    m_mu.resize(m_nsp);
+    m_rd.resize(m_nsp);
+    m_dn.resize(m_nsp);
+    m_dz.resize(m_nsp);
+    m_lambda.resize(m_nel);
+    m_rp.resize(m_nel);
+    m_dlambda.resize(m_nel);
+    m_work.resize(nsp_mix);
+    m_muMix.resize(nsp_mix);
+
+    // Determine the (fixed) sparsity pattern of the KKT matrix. The Hessian
+    // blocks are dense within each phase.
+    size_t nblock = 0;
+    size_t maxPhaseSpecies = 0;
+    for (size_t p = 0; p < mix->nPhases(); p++) {
+        nblock += m_phaseSpecies[p].size() * m_phaseSpecies[p].size();
+        maxPhaseSpecies = std::max(maxPhaseSpecies, mix->phase(p).nSpecies());
+    }
+    m_triplets.reserve(nblock + 2 * m_nel * m_nsp + m_nel);
+    m_dlnActCoeff.resize(maxPhaseSpecies * maxPhaseSpecies);
+    m_kkt.resize(m_nsp + m_nel, m_nsp + m_nel);
+}
+
+double InteriorPointEquil::equilibrate(int XY, double err, int maxsteps, int loglevel)
+{
+    if (XY != TP) {
+        throw CanteraError("InteriorPointEquil::equilibrate",
+            "Only equilibrium at constant T and P is supported. Other property "
+            "pairs are handled by MultiPhase::equilibrate.");
+    }
+
+    // Initial point: the current composition, shifted away from the bounds
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_n[k] = 0.9 * m_mix->speciesMoles(m_species[k]) / m_scale + 0.1 / m_nsp;
+    }
+    updateMixture(m_n);
+
+    // Least-squares estimate of the element potentials, and bound multipliers
+    // which are consistent with them
+    if (m_nel) {
+        ConstMappedMatrix A(m_A.ptrColumn(0), m_nel, m_nsp);
+        Eigen::Map<Eigen::VectorXd> mu(m_mu.data(), m_nsp);
+        Eigen::MatrixXd AAt = A * A.transpose();
+        AAt.diagonal().array() += 1.0e-10;
+        Eigen::VectorXd lambda = AAt.ldlt().solve(A * mu);
+        Eigen::VectorXd::Map(m_lambda.data(), m_nel) = lambda;
+    }
+    for (size_t k = 0; k < m_nsp; k++) {
+        double s = m_mu[k];
+        for (size_t m = 0; m < m_nel; m++) {
+            s -= m_A(m, k) * m_lambda[m];
+        }
+        m_z[k] = std::max(s, 0.0) + 1.0;
+    }
+
+    vector<double> corr(m_nsp);
+    vector<double> empty;
+    double error = 0.0;
+    for (m_iter = 0; m_iter < maxsteps; m_iter++) {
+        // Residuals of the optimality conditions
+        double errDual = 0.0;
+        double tau = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            m_rd[k] = m_mu[k] - m_z[k];
+            for (size_t m = 0; m < m_nel; m++) {
+                m_rd[k] -= m_A(m, k) * m_lambda[m];
+            }
+            errDual = std::max(errDual, std::abs(m_rd[k]));
+            tau += m_n[k] * m_z[k];
+        }
+        tau /= m_nsp;
+        double errPrimal = 0.0;
+        for (size_t m = 0; m < m_nel; m++) {
+            m_rp[m] = -m_b[m];
+            for (size_t k = 0; k < m_nsp; k++) {
+                m_rp[m] += m_A(m, k) * m_n[k];
+            }
+            errPrimal = std::max(errPrimal, std::abs(m_rp[m]));
+        }
+        error = std::max(errDual, errPrimal);
+        // The complementarity conditions are satisfied when each species is
+        // either present in equilibrium (with a negligible bound multiplier) or
+        // is reduced to a trace amount
+        bool complementary = true;
+        for (size_t k = 0; k < m_nsp; k++) {
+            if (m_z[k] >= err && m_n[k] >= 1.0e-16) {
+                complementary = false;
+                break;
+            }
+        }
+        if (loglevel > 0) {
+            writelog("InteriorPointEquil: iter = {:3d}, dual = {:10.3e}, "
+                     "primal = {:10.3e}, tau = {:10.3e}\n",
+                     m_iter, errDual, errPrimal, tau);
+        }
+        if (error < err && complementary) {
+            break;
+        }
+
+        assembleKKT();
+
+        // Predictor (affine scaling) step
+        computeStep(0.0, empty);
+        double alphaP = maxStep(m_n, m_dn, 1.0);
+        double alphaD = maxStep(m_z, m_dz, 1.0);
+        double tauAff = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            tauAff += (m_n[k] + alphaP * m_dn[k]) * (m_z[k] + alphaD * m_dz[k]);
+        }
+        tauAff /= m_nsp;
+        double sigma = pow(tauAff / tau, 3);
+
+        // Corrector step, aiming for a reduced value of the barrier parameter
+        for (size_t k = 0; k < m_nsp; k++) {
+            corr[k] = m_dn[k] * m_dz[k];
+        }
+        computeStep(sigma * tau, corr);
+        alphaP = maxStep(m_n, m_dn, 0.995);
+        alphaD = maxStep(m_z, m_dz, 0.995);
+        for (size_t k = 0; k < m_nsp; k++) {
+            m_n[k] += alphaP * m_dn[k];
+            m_z[k] += alphaD * m_dz[k];
+        }
+        for (size_t m = 0; m < m_nel; m++) {
+            m_lambda[m] += alphaD * m_dlambda[m];
+        }
+        updateMixture(m_n);
+    }
+    if (m_iter >= maxsteps) {
+        throw CanteraError("InteriorPointEquil::equilibrate",
+                           "no convergence in {} iterations. Error = {}",
+                           maxsteps, error);
+    }
+    return error;
+}
+
+void InteriorPointEquil::getElementPotentials(double* lambda) const
+{
+    std::fill(lambda, lambda + m_mix->nElements(), 0.0);
+    for (size_t m = 0; m < m_nel; m++) {
+        lambda[m_element[m]] = m_lambda[m];
+    }
+}
+
+void InteriorPointEquil::updateMixture(const vector<double>& n)
+{
+    std::fill(m_work.begin(), m_work.end(), 0.0);
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_work[m_species[k]] = n[k] * m_scale;
+    }
+    m_mix->setMoles(m_work.data());
+    m_mix->getChemPotentials(m_muMix.data());
+    double RT = GasConstant * m_mix->temperature();
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_mu[k] = m_muMix[m_species[k]] / RT;
+        if (!std::isfinite(m_mu[k])) {
+            throw CanteraError("InteriorPointEquil::updateMixture",
+                "Chemical potential of species '{}' is not finite.",
+                m_mix->speciesName(m_species[k]));
+        }
+    }
+}
+
+void InteriorPointEquil::assembleKKT()
+{
+    m_triplets.clear();
+    for (size_t p = 0; p < m_phaseSpecies.size(); p++) {
+        const vector<size_t>& sp = m_phaseSpecies[p];
+        if (sp.empty()) {
+            continue;
+        }
+        ThermoPhase& phase = m_mix->phase(p);
+        size_t nph = phase.nSpecies();
+        size_t kstart = m_mix->speciesIndex(0, p);
+        // Ideal mixing contribution: d(mu_i/RT)/dn_j = delta_ij / n_i - 1 / N
+        double Nphase = 0.0;
+        for (size_t i : sp) {
+            Nphase += m_n[i];
+        }
+        // Activity coefficient contribution; dlnActCoeff[nph*j + i] is the
+        // derivative of ln(gamma_i) with respect to ln(n_j)
+        bool single = (sp.size() == 1);
+        if (!single) {
+            phase.getdlnActCoeffdlnN(nph, m_dlnActCoeff.data());
+        }
+        for (size_t i : sp) {
+            size_t ki = m_species[i] - kstart;
+            for (size_t j : sp) {
+                size_t kj = m_species[j] - kstart;
+                double h = -1.0 / Nphase;
+                if (i == j) {
+                    h += 1.0 / m_n[i] + m_z[i] / m_n[i] + m_deltaPrimal;
+                }
+                if (!single) {
+                    h += 0.5 * (m_dlnActCoeff[nph * kj + ki] / m_n[j]
+                                + m_dlnActCoeff[nph * ki + kj] / m_n[i]);
+                }
+                m_triplets.emplace_back(static_cast<int>(i),
+                                        static_cast<int>(j), h);
+            }
+        }
+    }
+    for (size_t m = 0; m < m_nel; m++) {
+        int row = static_cast<int>(m_nsp + m);
+        for (size_t k = 0; k < m_nsp; k++) {
+            if (m_A(m, k) != 0.0) {
+                m_triplets.emplace_back(row, static_cast<int>(k), m_A(m, k));
+                m_triplets.emplace_back(static_cast<int>(k), row, m_A(m, k));
+            }
+        }
+        m_triplets.emplace_back(row, row, -m_deltaDual);
+    }
+    m_kkt.setFromTriplets(m_triplets.begin(), m_triplets.end());
+    if (!m_analyzed) {
+        m_solver.analyzePattern(m_kkt);
+        m_analyzed = true;
+    }
+
+    // The reduced Hessian must be positive definite for the step to be a
+    // descent direction. This is checked using the inertia of the KKT matrix,
+    // which should have m_nsp positive and m_nel negative eigenvalues. If
+    // necessary (for example, for non-ideal phases with a miscibility gap),
+    // the diagonal of the Hessian is shifted until this holds.
+    double shift = 0.0;
+    for (int attempt = 0; attempt < 20; attempt++) {
+        m_solver.factorize(m_kkt);
+        if (m_solver.info() == Eigen::Success) {
+            auto nPositive = (m_solver.vectorD().array() > 0.0).count();
+            if (static_cast<size_t>(nPositive) == m_nsp) {
+                return;
+            }
+        }
+        double newShift = (shift == 0.0) ? 1.0e-8 : 10.0 * shift;
+        for (size_t k = 0; k < m_nsp; k++) {
+            m_kkt.coeffRef(k, k) += newShift - shift;
+        }
+        shift = newShift;
+    }
+    throw CanteraError("InteriorPointEquil::assembleKKT",
+                       "Unable to factorize the KKT matrix.");
+}
+
+void InteriorPointEquil::solveKKT(Eigen::VectorXd& rhs)
+{
+    rhs = m_solver.solve(rhs);
+    if (m_solver.info() != Eigen::Success || !rhs.allFinite()) {
+        throw CanteraError("InteriorPointEquil::solveKKT",
+                           "Solution of the KKT system failed.");
+    }
+}
+
+void InteriorPointEquil::computeStep(double tau, const vector<double>& corr)
+{
+    // Linearized optimality conditions:
+    //     H dn - A^T dlambda - dz = -rd
+    //     A dn = -rp
+    //     Z dn + N dz = -rc,  rc = N Z e - tau e (+ corrector terms)
+    // Eliminating dz gives the symmetric KKT system for (dn, -dlambda)
+    Eigen::VectorXd rhs(m_nsp + m_nel);
+    vector<double> rc(m_nsp);
+    for (size_t k = 0; k < m_nsp; k++) {
+        rc[k] = m_n[k] * m_z[k] - tau;
+        if (!corr.empty()) {
+            rc[k] += corr[k];
+        }
+        rhs[k] = -m_rd[k] - rc[k] / m_n[k];
+    }
+    for (size_t m = 0; m < m_nel; m++) {
+        rhs[m_nsp + m] = -m_rp[m];
+    }
+    solveKKT(rhs);
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_dn[k] = rhs[k];
+        m_dz[k] = (-rc[k] - m_z[k] * m_dn[k]) / m_n[k];
+    }
+    for (size_t m = 0; m < m_nel; m++) {
+        m_dlambda[m] = -rhs[m_nsp + m];
+    }
+}
+
+double InteriorPointEquil::maxStep(const vector<double>& x,
+                                   const vector<double>& dx, double frac)
+{
+    double alpha = 1.0;
+    for (size_t k = 0; k < x.size(); k++) {
+        if (dx[k] < 0.0) {
+            alpha = std::min(alpha, -frac * x[k] / dx[k]);
+        }
+    }
+    return alpha;
+}
+
+}
@@ -10,6 +10,7 @@
 #include "cantera/equil/ChemEquil.h"
 #include "cantera/equil/MultiPhase.h"
 #include "cantera/equil/MultiPhaseEquil.h"
+#include "cantera/equil/InteriorPointEquil.h"
 #include "cantera/equil/vcs_MultiPhaseEquil.h"
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/base/stringUtils.h"
@@ -485,7 +486,8 @@ double MultiPhase::volume() const
 }
 
 double MultiPhase::equilibrate_MultiPhaseEquil(int XY, double err, int maxsteps,
-                                               int maxiter, int loglevel)
+                                               int maxiter, int loglevel,
+                                               bool interiorPoint)
 {
     bool strt = false;
     double dta = 0.0;
@@ -493,24 +495,30 @@ double MultiPhase::equilibrate_MultiPhaseEquil(int XY, double err, int maxsteps,
         init();
     }
 
+    // Equilibrate at the current temperature and pressure. If 'start' is false,
+    // the current composition is used as the starting estimate for the
+    // MultiPhaseEquil solver; otherwise it will be estimated.
+    auto equilibrate_TP = [&](bool start) {
+        if (interiorPoint) {
+            InteriorPointEquil e(this);
+            return e.equilibrate(TP, err, maxsteps, loglevel);
+        }
+        MultiPhaseEquil e(this, start);
+        return e.equilibrate(TP, err, maxsteps, loglevel);
+    };
+
     if (XY == TP) {
-        // create an equilibrium manager
-        MultiPhaseEquil e(this);
-        return e.equilibrate(XY, err, maxsteps, loglevel);
+        return equilibrate_TP(true);
     } else if (XY == HP) {
         double h0 = enthalpy();
         double Tlow = 0.5*m_Tmin; // lower bound on T
         double Thigh = 2.0*m_Tmax; // upper bound on T
         double Hlow = Undef, Hhigh = Undef;
         for (int n = 0; n < maxiter; n++) {
-            // if 'strt' is false, the current composition will be used as
-            // the starting estimate; otherwise it will be estimated
-            MultiPhaseEquil e(this, strt);
-            // start with a loose error tolerance, but tighten it as we get
-            // close to the final temperature
-
             try {
-                e.equilibrate(TP, err, maxsteps, loglevel);
+                // if 'strt' is false, the current composition will be used as
+                // the starting estimate; otherwise it will be estimated
+                equilibrate_TP(strt);
                 double hnow = enthalpy();
                 // the equilibrium enthalpy monotonically increases with T;
                 // if the current value is below the target, the we know the
@@ -578,10 +586,8 @@ double MultiPhase::equilibrate_MultiPhaseEquil(int XY, double err, int maxsteps,
         double Tlow = 1.0; // lower bound on T
         double Thigh = 1.0e6; // upper bound on T
         for (int n = 0; n < maxiter; n++) {
-            MultiPhaseEquil e(this, strt);
-
             try {
-                e.equilibrate(TP, err, maxsteps, loglevel);
+                equilibrate_TP(strt);
                 double snow = entropy();
                 if (snow < s0) {
                     Tlow = std::max(Tlow, m_temp);
@@ -622,10 +628,8 @@ double MultiPhase::equilibrate_MultiPhaseEquil(int XY, double err, int maxsteps,
         bool start = true;
         for (int n = 0; n < maxiter; n++) {
             double pnow = pressure();
-            MultiPhaseEquil e(this, start);
+            equilibrate_TP(start);
             start = false;
-
-            e.equilibrate(TP, err, maxsteps, loglevel);
             double vnow = volume();
             double verr = fabs((v0 - vnow)/v0);
 
@@ -682,6 +686,25 @@ void MultiPhase::equilibrate(const string& XY, const string& solver,
         }
     }
 
+    if (solver == "interior_point") {
+        try {
+            debuglog("Trying InteriorPointEquil equilibrium solver\n", log_level);
+            equilibrate_MultiPhaseEquil(ixy, rtol, max_steps, max_iter,
+                                        log_level-1, true);
+            debuglog("InteriorPointEquil solver succeeded\n", log_level);
+            return;
+        } catch (std::exception& err) {
+            debuglog("InteriorPointEquil solver failed.\n", log_level);
+            debuglog(err.what(), log_level);
+            m_moleFractions = initial_moleFractions;
+            m_moles = initial_moles;
+            m_temp = initial_T;
+            m_press = initial_P;
+            updatePhases();
+            throw;
+        }
+    }
+
     if (solver == "auto" || solver == "gibbs") {
         try {
             debuglog("Trying MultiPhaseEquil (Gibbs) equilibrium solver\n",
@@ -8,6 +8,7 @@
 
 #include "cantera/equil/vcs_solve.h"
 #include "cantera/base/ctexceptions.h"
+#include "cantera/base/global.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/equil/vcs_VolPhase.h"
 #include "cantera/equil/vcs_species_thermo.h"
@@ -74,6 +75,7 @@ VCS_SOLVE::VCS_SOLVE(MultiPhase* mphase, int printLvl) :
      * filled with meaningful information.
      */
     m_scSize.resize(m_nsp, 0.0);
+    m_stoichNonzeroComp.resize(m_nsp);
     m_spSize.resize(m_nsp, 1.0);
     m_SSfeSpecies.resize(m_nsp, 0.0);
     m_feSpecies_new.resize(m_nsp, 0.0);
@@ -86,6 +88,8 @@ VCS_SOLVE::VCS_SOLVE(MultiPhase* mphase, int printLvl) :
     m_deltaGRxn_new.resize(m_nsp, 0.0);
     m_deltaGRxn_old.resize(m_nsp, 0.0);
     m_deltaGRxn_Deficient.resize(m_nsp, 0.0);
+    m_phaseStabilityKey.resize(m_numPhases);
+    m_phaseStabilityFunc.resize(m_numPhases, 0.0);
     m_deltaGRxn_tmp.resize(m_nsp, 0.0);
     m_deltaMolNumSpecies.resize(m_nsp, 0.0);
     m_feSpecies_old.resize(m_nsp, 0.0);
@@ -620,6 +624,70 @@ size_t VCS_SOLVE::vcs_popPhaseID(vector<size_t> & phasePopPhaseIDs)
     double FephaseMax = -1.0E30;
     double Fephase = -1.0E30;
 
+    // Evaluate the stability of the multispecies phases which are currently
+    // zeroed but could be brought back into existence
+    vector<double> phaseStabilityFunc(m_numPhases, -1.0E30);
+    vector<int> phasePopPossible(m_numPhases, 0);
+    vector<size_t> testPhases;
+    for (size_t iph = 0; iph < m_numPhases; iph++) {
+        vcs_VolPhase* Vphase = m_VolPhaseList[iph].get();
+        if (Vphase->exists() > 0 || Vphase->m_singleSpecies) {
+            continue;
+        }
+        phasePopPossible[iph] = vcs_popPhasePossible(iph);
+        if (!phasePopPossible[iph]) {
+            continue;
+        }
+        // Reuse the result of the previous test if the free energies which
+        // enter the stability calculation for this phase are unchanged to within
+        // a tight relative tolerance. Only effectively identical inputs share a
+        // result, since the test result is not updated for small changes.
+        vector<double> key = vcs_phaseStabilityKey(iph);
+        const vector<double>& oldKey = m_phaseStabilityKey[iph];
+        bool reuse = (key.size() == oldKey.size());
+        for (size_t i = 0; reuse && i < key.size(); i += 2) {
+            reuse = (key[i] == oldKey[i] && fabs(key[i+1] - oldKey[i+1])
+                     <= 1.0E-8 * std::max(fabs(oldKey[i+1]), 1.0));
+        }
+        if (reuse) {
+            phaseStabilityFunc[iph] = m_phaseStabilityFunc[iph];
+            if (m_debug_print_lvl >= 2) {
+                plogf("   --- vcs_popPhaseID(): reusing stability test result for phase %s\n",
+                      Vphase->PhaseName);
+            }
+        } else {
+            m_phaseStabilityKey[iph] = std::move(key);
+            testPhases.push_back(iph);
+        }
+    }
+
+    // Stability tests for different phases only modify data belonging to the
+    // phase being tested, so they can be run concurrently.
+    size_t nThreads = std::min(static_cast<size_t>(std::max(m_numThreads, 1)),
+                               testPhases.size());
+    if (nThreads > 1 && m_debug_print_lvl == 0) {
+        try {
+            parallelFor(nThreads, [&](size_t t) {
+                for (size_t i = t; i < testPhases.size(); i += nThreads) {
+                    size_t iph = testPhases[i];
+                    phaseStabilityFunc[iph] = vcs_phaseStabilityTest(iph);
+                }
+            });
+        } catch (...) {
+            for (size_t iph : testPhases) {
+                m_phaseStabilityKey[iph].clear();
+            }
+            throw;
+        }
+    } else {
+        for (size_t iph : testPhases) {
+            phaseStabilityFunc[iph] = vcs_phaseStabilityTest(iph);
+        }
+    }
+    for (size_t iph : testPhases) {
+        m_phaseStabilityFunc[iph] = phaseStabilityFunc[iph];
+    }
+
     char anote[128];
     if (m_debug_print_lvl >= 2) {
         plogf("   --- vcs_popPhaseID() called\n");
@@ -667,8 +735,8 @@ size_t VCS_SOLVE::vcs_popPhaseID(vector<size_t> & phasePopPhaseIDs)
                 }
             } else {
                 // MultiSpecies Phase Stability Resolution
-                if (vcs_popPhasePossible(iph)) {
-                    Fephase = vcs_phaseStabilityTest(iph);
+                if (phasePopPossible[iph]) {
+                    Fephase = phaseStabilityFunc[iph];
                     if (Fephase > 0.0) {
                         if (Fephase > FephaseMax) {
                             iphasePop = iph;
@@ -705,6 +773,25 @@ size_t VCS_SOLVE::vcs_popPhaseID(vector<size_t> & phasePopPhaseIDs)
     return iphasePop;
 }
 
+vector<double> VCS_SOLVE::vcs_phaseStabilityKey(const size_t iph) const
+{
+    vcs_VolPhase* Vphase = m_VolPhaseList[iph].get();
+    vector<double> key;
+    key.reserve(2 * Vphase->nSpecies() + 2);
+    key.push_back(static_cast<double>(m_numComponents));
+    key.push_back(0.0);
+    for (size_t k = 0; k < Vphase->nSpecies(); k++) {
+        size_t kspec = Vphase->spGlobalIndexVCS(k);
+        key.push_back(static_cast<double>(kspec));
+        if (kspec >= m_numComponents) {
+            key.push_back(m_deltaGRxn_old[kspec - m_numComponents]);
+        } else {
+            key.push_back(m_feSpecies_old[kspec]);
+        }
+    }
+    return key;
+}
+
 int VCS_SOLVE::vcs_popPhaseRxnStepSizes(const size_t iphasePop)
 {
     vcs_VolPhase* Vphase = m_VolPhaseList[iphasePop].get();
@@ -1152,7 +1239,16 @@ double VCS_SOLVE::vcs_phaseStabilityTest(const size_t iph)
     vector<double> fracDelta_old(nsp, 0.0);
     vector<double> fracDelta_raw(nsp, 0.0);
     vector<size_t> creationGlobalRxnNumbers(nsp, npos);
-    m_deltaGRxn_Deficient = m_deltaGRxn_old;
+    // Only the entries for the formation reactions of species in this phase
+    // are used (and modified), so that stability tests for different phases
+    // may be run concurrently.
+    for (size_t k = 0; k < nsp; k++) {
+        size_t kspec = Vphase->spGlobalIndexVCS(k);
+        if (kspec >= m_numComponents) {
+            size_t irxn = kspec - m_numComponents;
+            m_deltaGRxn_Deficient[irxn] = m_deltaGRxn_old[irxn];
+        }
+    }
     vector<double> feSpecies_Deficient = m_feSpecies_old;
 
     // get the activity coefficients
@@ -1474,6 +1570,11 @@ int VCS_SOLVE::vcs_prep(int printLvl)
     int retn = VCS_SUCCESS;
     m_debug_print_lvl = printLvl;
 
+    // Discard phase stability results from previous problems
+    for (auto& key : m_phaseStabilityKey) {
+        key.clear();
+    }
+
     // Calculate the Single Species status of phases
     // Also calculate the number of species per phase
     vcs_SSPhase();
@@ -3247,6 +3348,7 @@ void VCS_SOLVE::vcs_counters_init(int ifunc)
     if (ifunc) {
         m_VCount->T_Its = 0;
         m_VCount->T_Basis_Opts = 0;
+        m_VCount->T_Basis_Reuse = 0;
         m_VCount->T_Calls_Inest = 0;
         m_VCount->T_Calls_vcs_TP = 0;
         m_VCount->T_Time_vcs_TP = 0.0;
@@ -2283,6 +2283,21 @@ L_END_LOOP:
         goto L_CLEANUP;
     }
 
+    // The stoichiometric coefficients depend only on the formula matrix and the
+    // ordering of species and elements. If these are unchanged since the last
+    // evaluation (which is typical when the solver is called repeatedly for
+    // nearby temperatures and pressures), the existing coefficients are reused.
+    if (m_reuseStoichCoeffs && ncTrial == m_stoichNumComponents
+        && m_speciesMapIndex == m_stoichSpeciesMap
+        && m_elementMapIndex == m_stoichElementMap)
+    {
+        if (m_debug_print_lvl >= 2) {
+            plogf("   ---   Reusing stoichiometric coefficients for unchanged basis\n");
+        }
+        m_VCount->T_Basis_Reuse++;
+        goto L_DELTA_N;
+    }
+
     // EVALUATE THE STOICHIOMETRY
     //
     // Formulate the matrix problem for the stoichiometric
@@ -2377,6 +2392,9 @@ L_END_LOOP:
         }
         m_scSize[i] = szTmp;
     }
+    m_stoichNumComponents = ncTrial;
+    m_stoichSpeciesMap = m_speciesMapIndex;
+    m_stoichElementMap = m_elementMapIndex;
 
     if (m_debug_print_lvl >= 2) {
         plogf("   ---                Components:");
@@ -2463,20 +2481,22 @@ L_END_LOOP:
     //
     // Evaluate the change in gas and liquid total moles due to reaction
     // vectors, DNG and DNL.
-
+L_DELTA_N:
     //  Zero out the change of Phase Moles array
     m_deltaMolNumPhase.zero();
     m_phaseParticipation.zero();
 
     // Loop over each reaction, creating the change in Phase Moles array,
-    // m_deltaMolNumPhase(iphase,irxn), and the phase participation array,
-    // PhaseParticipation[irxn][iphase]
+    // m_deltaMolNumPhase(iphase,irxn), the phase participation array,
+    // PhaseParticipation[irxn][iphase], and the list of components
+    // participating in each reaction.
     for (size_t irxn = 0; irxn < m_numRxnTot; ++irxn) {
         double* scrxn_ptr = m_stoichCoeffRxnMatrix.ptrColumn(irxn);
         size_t kspec = m_indexRxnToSpecies[irxn];
         size_t iph = m_phaseID[kspec];
         m_deltaMolNumPhase(iph,irxn) = 1.0;
         m_phaseParticipation(iph,irxn)++;
+        m_stoichNonzeroComp[irxn].clear();
         for (size_t j = 0; j < ncTrial; ++j) {
             iph = m_phaseID[j];
             if (fabs(scrxn_ptr[j]) <= 1.0e-6) {
@@ -2484,6 +2504,7 @@ L_END_LOOP:
             } else {
                 m_deltaMolNumPhase(iph,irxn) += scrxn_ptr[j];
                 m_phaseParticipation(iph,irxn)++;
+                m_stoichNonzeroComp[irxn].push_back(j);
             }
         }
     }
@@ -3115,9 +3136,9 @@ void VCS_SOLVE::vcs_deltag(const int L, const bool doDeleted,
                 int icase = 0;
                 deltaGRxn[irxn] = feSpecies[m_indexRxnToSpecies[irxn]];
                 double* dtmp_ptr = m_stoichCoeffRxnMatrix.ptrColumn(irxn);
-                for (kspec = 0; kspec < m_numComponents; ++kspec) {
-                    deltaGRxn[irxn] += dtmp_ptr[kspec] * feSpecies[kspec];
-                    if (molNumSpecies[kspec] < VCS_DELETE_MINORSPECIES_CUTOFF && dtmp_ptr[kspec] < 0.0) {
+                for (size_t kcomp : m_stoichNonzeroComp[irxn]) {
+                    deltaGRxn[irxn] += dtmp_ptr[kcomp] * feSpecies[kcomp];
+                    if (molNumSpecies[kcomp] < VCS_DELETE_MINORSPECIES_CUTOFF && dtmp_ptr[kcomp] < 0.0) {
                         icase = 1;
                     }
                 }
@@ -3132,10 +3153,10 @@ void VCS_SOLVE::vcs_deltag(const int L, const bool doDeleted,
             int icase = 0;
             deltaGRxn[irxn] = feSpecies[m_indexRxnToSpecies[irxn]];
             double* dtmp_ptr = m_stoichCoeffRxnMatrix.ptrColumn(irxn);
-            for (size_t kspec = 0; kspec < m_numComponents; ++kspec) {
-                deltaGRxn[irxn] += dtmp_ptr[kspec] * feSpecies[kspec];
-                if (molNumSpecies[kspec] < VCS_DELETE_MINORSPECIES_CUTOFF &&
-                        dtmp_ptr[kspec] < 0.0) {
+            for (size_t kcomp : m_stoichNonzeroComp[irxn]) {
+                deltaGRxn[irxn] += dtmp_ptr[kcomp] * feSpecies[kcomp];
+                if (molNumSpecies[kcomp] < VCS_DELETE_MINORSPECIES_CUTOFF &&
+                        dtmp_ptr[kcomp] < 0.0) {
                     icase = 1;
                 }
             }
@@ -3151,10 +3172,10 @@ void VCS_SOLVE::vcs_deltag(const int L, const bool doDeleted,
                 int icase = 0;
                 deltaGRxn[irxn] = feSpecies[m_indexRxnToSpecies[irxn]];
                 double* dtmp_ptr = m_stoichCoeffRxnMatrix.ptrColumn(irxn);
-                for (kspec = 0; kspec < m_numComponents; ++kspec) {
-                    deltaGRxn[irxn] += dtmp_ptr[kspec] * feSpecies[kspec];
-                    if (m_molNumSpecies_old[kspec] < VCS_DELETE_MINORSPECIES_CUTOFF &&
-                            dtmp_ptr[kspec] < 0.0) {
+                for (size_t kcomp : m_stoichNonzeroComp[irxn]) {
+                    deltaGRxn[irxn] += dtmp_ptr[kcomp] * feSpecies[kcomp];
+                    if (m_molNumSpecies_old[kcomp] < VCS_DELETE_MINORSPECIES_CUTOFF &&
+                            dtmp_ptr[kcomp] < 0.0) {
                         icase = 1;
                     }
                 }
@@ -3447,6 +3468,7 @@ void VCS_SOLVE::vcs_switch_pos(const bool ifunc, const size_t k1, const size_t k
             std::swap(m_stoichCoeffRxnMatrix(j,i1), m_stoichCoeffRxnMatrix(j,i2));
         }
         std::swap(m_scSize[i1], m_scSize[i2]);
+        std::swap(m_stoichNonzeroComp[i1], m_stoichNonzeroComp[i2]);
         for (size_t iph = 0; iph < m_numPhases; iph++) {
             std::swap(m_deltaMolNumPhase(iph,i1), m_deltaMolNumPhase(iph,i2));
             std::swap(m_phaseParticipation(iph,i1),
@@ -3455,6 +3477,10 @@ void VCS_SOLVE::vcs_switch_pos(const bool ifunc, const size_t k1, const size_t k
         std::swap(m_deltaGRxn_new[i1], m_deltaGRxn_new[i2]);
         std::swap(m_deltaGRxn_old[i1], m_deltaGRxn_old[i2]);
         std::swap(m_deltaGRxn_tmp[i1], m_deltaGRxn_tmp[i2]);
+    } else {
+        // The reaction data is now out of date. Make sure it is recomputed by
+        // the next call to vcs_basopt().
+        m_stoichNumComponents = npos;
     }
 }
 
@@ -0,0 +1,348 @@
+/**
+ *  @file BatchSurfChem.cpp
+ *  Definitions for the simultaneous integration of the surface coverage
+ *  equations for many independent surface states (see @ref surfSolverGroup and
+ *  class @link Cantera::BatchSurfChem BatchSurfChem@endlink).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/BatchSurfChem.h"
+#include "cantera/kinetics/InterfaceKinetics.h"
+#include "cantera/base/Interface.h"
+#include "cantera/base/YamlWriter.h"
+#include "cantera/numerics/Integrator.h"
+#include "cantera/numerics/SystemJacobianFactory.h"
+#include "cantera/thermo/SurfPhase.h"
+
+namespace Cantera
+{
+
+BatchSurfChem::BatchSurfChem(shared_ptr<Interface> soln, size_t nBatch,
+                             double rtol, double atol)
+    : m_soln(soln)
+    , m_nBatch(nBatch)
+    , m_rtol(rtol)
+    , m_atol(atol)
+{
+    if (!soln || !soln->kinetics()) {
+        throw CanteraError("BatchSurfChem::BatchSurfChem",
+                           "Interface object does not define a kinetics manager.");
+    }
+    if (nBatch == 0) {
+        throw CanteraError("BatchSurfChem::BatchSurfChem",
+                           "Number of surface states must be positive.");
+    }
+    auto kin = soln->kinetics();
+    auto surf = dynamic_cast<SurfPhase*>(&kin->thermo(0));
+    if (!surf) {
+        throw CanteraError("BatchSurfChem::BatchSurfChem",
+                           "Kinetics manager contains no surface phase.");
+    }
+    m_nsp = surf->nSpecies();
+    m_stateStart.push_back(0);
+    for (size_t n = 0; n < kin->nPhases(); n++) {
+        m_stateStart.push_back(m_stateStart.back() + kin->thermo(n).stateSize());
+    }
+    m_blockState.resize(m_nBatch * m_stateStart.back());
+    m_coverages.resize(m_nBatch * m_nsp);
+    m_blockJac.resize(m_nBatch * m_nsp * m_nsp);
+    setupWorkers();
+    for (size_t i = 0; i < m_nBatch; i++) {
+        storeState(i);
+    }
+
+    m_integ.reset(newIntegrator("CVODE"));
+    m_integ->setMethod(BDF_Method);
+    // The blocks are uncoupled, so an iterative linear solver preconditioned
+    // with the block-diagonal Jacobian converges in very few iterations
+    m_integ->setLinearSolverType("GMRES");
+    m_precon = newSystemJacobian("eigen-sparse-direct");
+    m_precon->setPreconditionerSide("right");
+    m_integ->setPreconditioner(m_precon);
+}
+
+BatchSurfChem::~BatchSurfChem() = default;
+
+void BatchSurfChem::setupWorkers()
+{
+    size_t nw = std::min(m_nThreads, m_nBatch);
+    if (m_workers.empty()) {
+        m_workers.push_back(m_soln);
+    }
+    if (nw > m_workers.size()) {
+        // Create independent copies of the interface and its adjacent phases,
+        // since Kinetics and ThermoPhase objects cannot be shared between threads
+        YamlWriter writer;
+        writer.addPhase(m_soln);
+        AnyMap root = AnyMap::fromYamlString(writer.toYamlString());
+        AnyMap& phaseNode = root["phases"].getMapWhere("name", m_soln->name());
+        while (m_workers.size() < nw) {
+            m_workers.push_back(newInterface(phaseNode, root));
+        }
+    } else {
+        m_workers.resize(nw);
+    }
+    m_surf.clear();
+    m_work.clear();
+    for (auto& soln : m_workers) {
+        auto kin = soln->kinetics();
+        m_surf.push_back(dynamic_cast<SurfPhase*>(&kin->thermo(0)));
+        m_work.emplace_back(kin->nTotalSpecies() + 3 * m_nsp);
+    }
+}
+
+void BatchSurfChem::checkBlockIndex(const string& func, size_t i) const
+{
+    if (i >= m_nBatch) {
+        throw IndexError(func, "blocks", i, m_nBatch);
+    }
+}
+
+void BatchSurfChem::setThreads(size_t nThreads)
+{
+    m_nThreads = std::max<size_t>(nThreads, 1);
+    setupWorkers();
+}
+
+void BatchSurfChem::storeState(size_t i)
+{
+    checkBlockIndex("BatchSurfChem::storeState", i);
+    auto kin = m_soln->kinetics();
+    double* state = &m_blockState[i * m_stateStart.back()];
+    for (size_t n = 0; n < kin->nPhases(); n++) {
+        kin->thermo(n).saveState(m_stateStart[n+1] - m_stateStart[n],
+                                 state + m_stateStart[n]);
+    }
+    m_surf[0]->getCoverages(&m_coverages[i * m_nsp]);
+}
+
+void BatchSurfChem::restoreState(size_t i)
+{
+    checkBlockIndex("BatchSurfChem::restoreState", i);
+    setWorkerState(0, i, &m_coverages[i * m_nsp]);
+}
+
+void BatchSurfChem::getCoverages(size_t i, double* theta) const
+{
+    checkBlockIndex("BatchSurfChem::getCoverages", i);
+    std::copy(&m_coverages[i * m_nsp], &m_coverages[(i + 1) * m_nsp], theta);
+}
+
+void BatchSurfChem::setCoverages(size_t i, const double* theta)
+{
+    checkBlockIndex("BatchSurfChem::setCoverages", i);
+    double sum = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        sum += theta[k];
+    }
+    if (sum <= 0.0) {
+        throw CanteraError("BatchSurfChem::setCoverages",
+                           "Sum of coverage fractions is zero or negative");
+    }
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_coverages[i * m_nsp + k] = theta[k] / sum;
+    }
+}
+
+void BatchSurfChem::setTolerances(double rtol, double atol)
+{
+    m_rtol = rtol;
+    m_atol = atol;
+    m_integ->setTolerances(m_rtol, m_atol);
+}
+
+void BatchSurfChem::setMaxSteps(size_t maxSteps)
+{
+    m_maxSteps = maxSteps;
+    m_integ->setMaxSteps(static_cast<int>(m_maxSteps));
+}
+
+void BatchSurfChem::setMaxStepSize(double maxStep)
+{
+    m_maxStep = maxStep;
+    if (m_maxStep > 0) {
+        m_integ->setMaxStepSize(m_maxStep);
+    }
+}
+
+void BatchSurfChem::initialize(double t0)
+{
+    setTolerances(m_rtol, m_atol);
+    setMaxSteps(m_maxSteps);
+    setMaxStepSize(m_maxStep);
+    m_integ->initialize(t0, *this);
+}
+
+void BatchSurfChem::integrate(double t0, double t1)
+{
+    // The first worker uses the phases of the Interface object, so their
+    // states are saved here and restored after the integration
+    auto kin = m_soln->kinetics();
+    vector<double> state(m_stateStart.back());
+    for (size_t n = 0; n < kin->nPhases(); n++) {
+        kin->thermo(n).saveState(m_stateStart[n+1] - m_stateStart[n],
+                                 &state[m_stateStart[n]]);
+    }
+    try {
+        initialize(t0);
+        if (fabs(t1 - t0) < m_maxStep || m_maxStep == 0) {
+            // limit max step size on this run to t1 - t0
+            m_integ->setMaxStepSize(t1 - t0);
+        }
+        m_integ->integrate(t1);
+        const double* y = m_integ->solution();
+        for (size_t i = 0; i < m_nBatch; i++) {
+            setCoverages(i, y + i * m_nsp);
+        }
+    } catch (...) {
+        for (size_t n = 0; n < kin->nPhases(); n++) {
+            kin->thermo(n).restoreState(m_stateStart[n+1] - m_stateStart[n],
+                                        &state[m_stateStart[n]]);
+        }
+        throw;
+    }
+    for (size_t n = 0; n < kin->nPhases(); n++) {
+        kin->thermo(n).restoreState(m_stateStart[n+1] - m_stateStart[n],
+                                    &state[m_stateStart[n]]);
+    }
+}
+
+void BatchSurfChem::forEachBlock(const std::function<void(size_t, size_t)>& func)
+{
+    // Each range of blocks is evaluated using a single Interface object
+    size_t nw = m_workers.size();
+    parallelFor(nw, [&](size_t w) {
+        size_t stop = (w + 1) * m_nBatch / nw;
+        for (size_t i = w * m_nBatch / nw; i < stop; i++) {
+            func(w, i);
+        }
+    });
+}
+
+void BatchSurfChem::setWorkerState(size_t w, size_t i, const double* theta)
+{
+    auto kin = m_workers[w]->kinetics();
+    const double* state = &m_blockState[i * m_stateStart.back()];
+    for (size_t n = 0; n < kin->nPhases(); n++) {
+        kin->thermo(n).restoreState(m_stateStart[n+1] - m_stateStart[n],
+                                    state + m_stateStart[n]);
+    }
+    m_surf[w]->setCoveragesNoNorm(theta);
+}
+
+void BatchSurfChem::evalWorker(size_t w, double* ydot)
+{
+    SurfPhase* surf = m_surf[w];
+    double* wdot = m_work[w].data();
+    m_workers[w]->kinetics()->getNetProductionRates(wdot);
+    double rs0 = 1.0 / surf->siteDensity();
+    double sum = 0.0;
+    for (size_t k = 1; k < m_nsp; k++) {
+        ydot[k] = wdot[k] * rs0 * surf->size(k);
+        sum -= ydot[k];
+    }
+    ydot[0] = sum;
+}
+
+void BatchSurfChem::jacobianWorker(size_t w, const double* theta, double* jac)
+{
+    SurfPhase* surf = m_surf[w];
+    auto kin = m_workers[w]->kinetics();
+    std::fill(jac, jac + m_nsp * m_nsp, 0.0);
+    try {
+        // The surface phase is the first phase of the kinetics manager, and the
+        // concentration of surface species k is theta_k * n0 / size_k
+        Eigen::SparseMatrix<double> dwdot = kin->netProductionRates_ddCi();
+        for (int j = 0; j < static_cast<int>(m_nsp); j++) {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(dwdot, j); it; ++it) {
+                size_t k = it.row();
+                if (k > 0 && k < m_nsp) {
+                    jac[k + m_nsp * j] = it.value() * surf->size(k) / surf->size(j);
+                }
+            }
+        }
+    } catch (NotImplementedError&) {
+        // Use finite differences if analytical derivatives are not available
+        double* ydot0 = m_work[w].data() + kin->nTotalSpecies();
+        double* ydot1 = ydot0 + m_nsp;
+        double* thetaPert = ydot1 + m_nsp;
+        std::copy(theta, theta + m_nsp, thetaPert);
+        evalWorker(w, ydot0);
+        for (size_t j = 0; j < m_nsp; j++) {
+            double delta = 1e-7 * std::max(std::abs(theta[j]), 1e-6);
+            thetaPert[j] = theta[j] + delta;
+            surf->setCoveragesNoNorm(thetaPert);
+            evalWorker(w, ydot1);
+            for (size_t k = 1; k < m_nsp; k++) {
+                jac[k + m_nsp * j] = (ydot1[k] - ydot0[k]) / delta;
+            }
+            thetaPert[j] = theta[j];
+        }
+        surf->setCoveragesNoNorm(theta);
+    }
+    // Conservation of the total coverage
+    for (size_t j = 0; j < m_nsp; j++) {
+        double sum = 0.0;
+        for (size_t k = 1; k < m_nsp; k++) {
+            sum -= jac[k + m_nsp * j];
+        }
+        jac[m_nsp * j] = sum;
+    }
+}
+
+void BatchSurfChem::getBlockJacobian(size_t i, double* jac)
+{
+    checkBlockIndex("BatchSurfChem::getBlockJacobian", i);
+    setWorkerState(0, i, &m_coverages[i * m_nsp]);
+    jacobianWorker(0, &m_coverages[i * m_nsp], jac);
+}
+
+void BatchSurfChem::eval(double t, double* y, double* ydot, double* p)
+{
+    forEachBlock([this, y, ydot](size_t w, size_t i) {
+        setWorkerState(w, i, y + i * m_nsp);
+        evalWorker(w, ydot + i * m_nsp);
+    });
+}
+
+void BatchSurfChem::getState(double* y)
+{
+    std::copy(m_coverages.begin(), m_coverages.end(), y);
+}
+
+void BatchSurfChem::preconditionerSetup(double t, double* y, double gamma)
+{
+    forEachBlock([this, y](size_t w, size_t i) {
+        setWorkerState(w, i, y + i * m_nsp);
+        jacobianWorker(w, y + i * m_nsp, &m_blockJac[i * m_nsp * m_nsp]);
+    });
+    m_precon->reset();
+    m_precon->setGamma(gamma);
+    for (size_t i = 0; i < m_nBatch; i++) {
+        const double* jac = &m_blockJac[i * m_nsp * m_nsp];
+        size_t start = i * m_nsp;
+        for (size_t j = 0; j < m_nsp; j++) {
+            for (size_t k = 0; k < m_nsp; k++) {
+                if (jac[k + m_nsp * j] != 0.0) {
+                    m_precon->setValue(start + k, start + j, jac[k + m_nsp * j]);
+                }
+            }
+        }
+    }
+    m_precon->updatePreconditioner();
+}
+
+void BatchSurfChem::updatePreconditioner(double gamma)
+{
+    m_precon->setGamma(gamma);
+    m_precon->updatePreconditioner();
+}
+
+void BatchSurfChem::preconditionerSolve(double* rhs, double* output)
+{
+    m_integ->preconditionerSolve(neq(), rhs, output);
+}
+
+}
@@ -4,6 +4,7 @@
 #include "cantera/kinetics/BulkKinetics.h"
 #include "cantera/kinetics/Reaction.h"
 #include "cantera/thermo/ThermoPhase.h"
+#include "cantera/base/PerfCounters.h"
 
 namespace Cantera
 {
@@ -121,6 +122,7 @@ void BulkKinetics::resizeSpecies()
     m_act_conc.resize(m_kk);
     m_phys_conc.resize(m_kk);
     m_grt.resize(m_kk);
+    m_jacPatternValid = false;
     for (auto& rates : m_bulk_rates) {
         rates->resize(m_kk, nReactions(), nPhases());
     }
@@ -136,6 +138,7 @@ void BulkKinetics::resizeReactions()
     m_sbuf0.resize(nTotalSpecies());
     m_state.resize(thermo().stateSize());
     m_multi_concm.resizeCoeffs(nTotalSpecies(), nReactions());
+    m_jacPatternValid = false;
     for (auto& rates : m_bulk_rates) {
         rates->resize(nTotalSpecies(), nReactions(), nPhases());
         // @todo ensure that ReactionData are updated; calling rates->update
@@ -272,6 +275,7 @@ void BulkKinetics::setDerivativeSettings(const AnyMap& settings)
     bool force = settings.empty();
     if (force || settings.hasKey("skip-third-bodies")) {
         m_jac_skip_third_bodies = settings.getBool("skip-third-bodies", false);
+        m_jacPatternValid = false;
     }
     if (force || settings.hasKey("skip-falloff")) {
         m_jac_skip_falloff = settings.getBool("skip-falloff", false);
@@ -454,8 +458,21 @@ Eigen::SparseMatrix<double> BulkKinetics::netRatesOfProgress_ddCi()
     return jac - calculateCompositionDerivatives(m_revProductStoich, rop_rates, false);
 }
 
+void BulkKinetics::getNetRatesOfProgress_ddX(Eigen::SparseMatrix<double>& jac)
+{
+    assertDerivativesValid("BulkKinetics::getNetRatesOfProgress_ddX");
+    updateCompositionDerivatives(jac, true);
+}
+
+void BulkKinetics::getNetRatesOfProgress_ddCi(Eigen::SparseMatrix<double>& jac)
+{
+    assertDerivativesValid("BulkKinetics::getNetRatesOfProgress_ddCi");
+    updateCompositionDerivatives(jac, false);
+}
+
 void BulkKinetics::updateROP()
 {
+    CT_PERF_SCOPE("BulkKinetics::updateROP");
     static const int cacheId = m_cache.getId();
     CachedScalar last = m_cache.getScalar(cacheId);
     double T = thermo().temperature();
@@ -692,6 +709,138 @@ Eigen::SparseMatrix<double> BulkKinetics::calculateCompositionDerivatives(
     return out;
 }
 
+void BulkKinetics::updateCompositionDerivatives(Eigen::SparseMatrix<double>& jac,
+                                                bool ddX)
+{
+    if (!m_jacPatternValid) {
+        buildCompositionDerivativesPattern();
+    }
+    if (!sameSparsityPattern(jac, m_jacPattern)) {
+        jac = m_jacPattern;
+    }
+    double* values = jac.valuePtr();
+    std::fill(values, values + jac.nonZeros(), 0.0);
+
+    // forward reaction rate coefficients
+    vector<double>& rop_rates = m_rbuf0;
+    getFwdRateConstants(rop_rates.data());
+    addCompositionDerivatives(m_reactantStoich, rop_rates, ddX, 1.0,
+                              m_jacIndexFwd, values);
+
+    // reverse reaction rate coefficients
+    applyEquilibriumConstants(rop_rates.data());
+    addCompositionDerivatives(m_revProductStoich, rop_rates, ddX, -1.0,
+                              m_jacIndexRev, values);
+}
+
+void BulkKinetics::addCompositionDerivatives(
+    StoichManagerN& stoich, const vector<double>& in, bool ddX, double factor,
+    const vector<int>& index, double* values)
+{
+    vector<double>& scaled = m_rbuf1;
+    vector<double>& outV = m_rbuf2;
+
+    // convert from concentration to mole fraction output
+    copy(in.begin(), in.end(), scaled.begin());
+    if (ddX) {
+        double ctot = thermo().molarDensity();
+        for (size_t i = 0; i < nReactions(); ++i) {
+            scaled[i] *= ctot;
+        }
+    }
+
+    // derivatives handled by StoichManagerN
+    copy(scaled.begin(), scaled.end(), outV.begin());
+    processThirdBodies(outV.data());
+    const double* derivs = stoich.derivativesView(
+        m_act_conc.data(), outV.data()).valuePtr();
+    for (size_t n = 0; n < index.size(); n++) {
+        values[index[n]] += factor * derivs[n];
+    }
+    if (m_jac_skip_third_bodies || m_multi_concm.empty()) {
+        return;
+    }
+
+    // derivatives due to law of mass action
+    copy(scaled.begin(), scaled.end(), outV.begin());
+    stoich.multiply(m_act_conc.data(), outV.data());
+
+    // derivatives due to reaction rates depending on third-body colliders
+    if (!m_jac_skip_falloff) {
+        for (auto& rates : m_bulk_rates) {
+            // processing step does not modify entries not dependent on M
+            rates->processRateConstants_ddM(
+                outV.data(), m_rfn.data(), m_jac_rtol_delta, false);
+        }
+    }
+
+    // derivatives handled by ThirdBodyCalc
+    m_multi_concm.addDerivatives(outV.data(), factor, m_jacIndexThirdBody, values);
+}
+
+namespace {
+
+//! Append the sparsity pattern of a compressed, column-major matrix to a list of
+//! triplets with zero values
+template<class Matrix>
+void appendPattern(const Matrix& part, SparseTriplets& triplets)
+{
+    const int* outer = part.outerIndexPtr();
+    const int* inner = part.innerIndexPtr();
+    for (int j = 0; j < part.outerSize(); j++) {
+        for (int n = outer[j]; n < outer[j + 1]; n++) {
+            triplets.emplace_back(inner[n], j, 0.0);
+        }
+    }
+}
+
+//! Determine the position within `pattern` of each stored entry of `part`
+template<class Matrix>
+vector<int> patternIndex(const Eigen::SparseMatrix<double>& pattern,
+                         const Matrix& part)
+{
+    const int* outer = part.outerIndexPtr();
+    const int* inner = part.innerIndexPtr();
+    vector<int> index(part.nonZeros());
+    for (int j = 0; j < part.outerSize(); j++) {
+        for (int n = outer[j]; n < outer[j + 1]; n++) {
+            index[n] = sparseStorageIndex(pattern, inner[n], j);
+        }
+    }
+    return index;
+}
+
+}
+
+void BulkKinetics::buildCompositionDerivativesPattern()
+{
+    // The sparsity pattern of the stoichiometric derivatives does not depend on the
+    // state, so any valid inputs can be used here
+    auto fwd = m_reactantStoich.derivativesView(m_act_conc.data(), m_rbuf0.data());
+    auto rev = m_revProductStoich.derivativesView(m_act_conc.data(), m_rbuf0.data());
+    bool thirdBodies = !m_jac_skip_third_bodies && !m_multi_concm.empty();
+
+    SparseTriplets thirdBodyTerms;
+    if (thirdBodies) {
+        thirdBodyTerms = m_multi_concm.derivativesPattern();
+    }
+    SparseTriplets triplets(thirdBodyTerms);
+    appendPattern(fwd, triplets);
+    appendPattern(rev, triplets);
+    m_jacPattern.resize(nReactions(), nTotalSpecies());
+    m_jacPattern.setFromTriplets(triplets.begin(), triplets.end());
+    m_jacPattern.makeCompressed();
+
+    m_jacIndexFwd = patternIndex(m_jacPattern, fwd);
+    m_jacIndexRev = patternIndex(m_jacPattern, rev);
+    m_jacIndexThirdBody.resize(thirdBodyTerms.size());
+    for (size_t n = 0; n < thirdBodyTerms.size(); n++) {
+        m_jacIndexThirdBody[n] = sparseStorageIndex(
+            m_jacPattern, thirdBodyTerms[n].row(), thirdBodyTerms[n].col());
+    }
+    m_jacPatternValid = true;
+}
+
 void BulkKinetics::assertDerivativesValid(const string& name)
 {
     if (!thermo().isIdeal()) {
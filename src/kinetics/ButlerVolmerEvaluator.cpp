@@ -0,0 +1,236 @@
+/**
+ *  @file ButlerVolmerEvaluator.cpp
+ *  Batch evaluation of charge-transfer currents at electrode interfaces (see
+ *  @ref kineticsmgr and class
+ *  @link Cantera::ButlerVolmerEvaluator ButlerVolmerEvaluator@endlink).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/ButlerVolmerEvaluator.h"
+#include "cantera/kinetics/InterfaceRate.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/Reaction.h"
+#include "cantera/base/Interface.h"
+#include "cantera/base/utilities.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+namespace Cantera
+{
+
+ButlerVolmerEvaluator::ButlerVolmerEvaluator(shared_ptr<Interface> soln,
+                                             const string& electrode,
+                                             const string& species)
+    : m_soln(soln)
+{
+    if (!soln || !soln->kinetics()) {
+        throw CanteraError("ButlerVolmerEvaluator::ButlerVolmerEvaluator",
+                           "Interface object does not define a kinetics manager.");
+    }
+    m_kin = soln->kinetics();
+    m_electrode = m_kin->phaseIndex(electrode);
+    if (m_electrode == npos) {
+        throw CanteraError("ButlerVolmerEvaluator::ButlerVolmerEvaluator",
+                           "Phase '{}' is not part of the kinetics manager.",
+                           electrode);
+    }
+    m_species = m_kin->kineticsSpeciesIndex(species);
+    if (m_species == npos) {
+        throw CanteraError("ButlerVolmerEvaluator::ButlerVolmerEvaluator",
+                           "Species '{}' is not part of the kinetics manager.",
+                           species);
+    }
+
+    const ThermoPhase& phase = m_kin->thermo(m_electrode);
+    for (size_t i = 0; i < m_kin->nReactions(); i++) {
+        auto rxn = m_kin->reaction(i);
+        // Net number of charges transferred to the electrode phase
+        double nCharge = 0.0;
+        for (const auto& [name, stoich] : rxn->products) {
+            size_t k = phase.speciesIndex(name);
+            if (k != npos) {
+                nCharge += stoich * phase.charge(k);
+            }
+        }
+        for (const auto& [name, stoich] : rxn->reactants) {
+            size_t k = phase.speciesIndex(name);
+            if (k != npos) {
+                nCharge -= stoich * phase.charge(k);
+            }
+        }
+        if (std::abs(nCharge) < 1e-4) {
+            continue;
+        }
+
+        double beta = 0.0;
+        auto rate = std::dynamic_pointer_cast<InterfaceRateBase>(rxn->rate());
+        if (rate && rate->usesElectrochemistry()) {
+            beta = rate->beta();
+        }
+
+        // Reaction orders, consistent with Kinetics::addReaction
+        map<size_t, double> fwd;
+        for (const auto& [name, stoich] : rxn->reactants) {
+            fwd[m_kin->kineticsSpeciesIndex(name)] = stoich;
+        }
+        for (const auto& [name, order] : rxn->orders) {
+            fwd[m_kin->kineticsSpeciesIndex(name)] = order;
+        }
+        map<size_t, double> rev;
+        if (rxn->reversible) {
+            for (const auto& [name, stoich] : rxn->products) {
+                rev[m_kin->kineticsSpeciesIndex(name)] = stoich;
+            }
+        }
+
+        m_rxn.push_back(i);
+        m_nCharge.push_back(nCharge);
+        m_beta.push_back(beta);
+        m_orderFwd.push_back(getValue(fwd, m_species, 0.0));
+        m_orderRev.push_back(getValue(rev, m_species, 0.0));
+        fwd.erase(m_species);
+        rev.erase(m_species);
+        m_otherFwd.emplace_back(fwd.begin(), fwd.end());
+        m_otherRev.emplace_back(rev.begin(), rev.end());
+    }
+
+    m_kf.resize(m_kin->nReactions());
+    m_kr.resize(m_kin->nReactions());
+    m_actConc.resize(m_kin->nTotalSpecies());
+    m_phi.resize(m_kin->nPhases());
+}
+
+int ButlerVolmerEvaluator::stateNumber() const
+{
+    int mf = 0;
+    for (size_t n = 0; n < m_kin->nPhases(); n++) {
+        mf += m_kin->thermo(n).stateMFNumber();
+    }
+    return mf;
+}
+
+void ButlerVolmerEvaluator::checkState()
+{
+    bool changed = stateNumber() != m_stateNum;
+    for (size_t n = 0; n < m_kin->nPhases(); n++) {
+        if (n != m_electrode && m_kin->thermo(n).electricPotential() != m_phi[n]) {
+            changed = true;
+        }
+    }
+    if (changed) {
+        m_cache.clear();
+    }
+}
+
+const vector<double>& ButlerVolmerEvaluator::rateFactors(double T)
+{
+    auto iter = m_cache.find(T);
+    if (iter != m_cache.end()) {
+        return iter->second;
+    }
+    if (m_cache.size() >= m_maxCacheSize) {
+        m_cache.clear();
+    }
+
+    // Evaluate the rate constants at temperature T and zero potential of the
+    // electrode phase
+    size_t nPhases = m_kin->nPhases();
+    vector<vector<double>> states(nPhases);
+    for (size_t n = 0; n < nPhases; n++) {
+        ThermoPhase& phase = m_kin->thermo(n);
+        phase.saveState(states[n]);
+        if (phase.temperature() != T) {
+            phase.setState_TP(T, phase.pressure());
+        }
+    }
+    ThermoPhase& electrode = m_kin->thermo(m_electrode);
+    double phi0 = electrode.electricPotential();
+    electrode.setElectricPotential(0.0);
+    try {
+        m_kin->getFwdRateConstants(m_kf.data());
+        m_kin->getRevRateConstants(m_kr.data());
+        m_kin->getActivityConcentrations(m_actConc.data());
+    } catch (...) {
+        electrode.setElectricPotential(phi0);
+        for (size_t n = 0; n < nPhases; n++) {
+            m_kin->thermo(n).restoreState(states[n]);
+        }
+        throw;
+    }
+    electrode.setElectricPotential(phi0);
+    for (size_t n = 0; n < nPhases; n++) {
+        m_kin->thermo(n).restoreState(states[n]);
+    }
+
+    size_t nr = m_rxn.size();
+    vector<double> factors(2 * nr);
+    for (size_t j = 0; j < nr; j++) {
+        double kf = m_kf[m_rxn[j]];
+        for (const auto& [k, order] : m_otherFwd[j]) {
+            kf *= std::pow(m_actConc[k], order);
+        }
+        double kr = m_kr[m_rxn[j]];
+        for (const auto& [k, order] : m_otherRev[j]) {
+            kr *= std::pow(m_actConc[k], order);
+        }
+        factors[j] = kf;
+        factors[nr + j] = kr;
+    }
+
+    // Changing and restoring the state of the phases updates their state numbers
+    m_stateNum = stateNumber();
+    for (size_t n = 0; n < nPhases; n++) {
+        m_phi[n] = m_kin->thermo(n).electricPotential();
+    }
+    return m_cache.emplace(T, std::move(factors)).first->second;
+}
+
+void ButlerVolmerEvaluator::eval(size_t nNodes, const double* T, const double* conc,
+                                 const double* phi, double* current,
+                                 double* dcurrent_dphi, double* dcurrent_dconc)
+{
+    checkState();
+    size_t nr = m_rxn.size();
+    const double* kf = nullptr;
+    double Tlast = NAN;
+    for (size_t i = 0; i < nNodes; i++) {
+        if (T[i] != Tlast) {
+            kf = rateFactors(T[i]).data();
+            Tlast = T[i];
+        }
+        const double* kr = kf + nr;
+        double FRT = Faraday / (GasConstant * T[i]);
+        double C = conc[i];
+        double cur = 0.0;
+        double dphi = 0.0;
+        double dconc = 0.0;
+        for (size_t j = 0; j < nr; j++) {
+            double x = m_nCharge[j] * FRT * phi[i];
+            double ef = kf[j] * std::exp(-m_beta[j] * x);
+            double er = kr[j] * std::exp((1.0 - m_beta[j]) * x);
+            double of = m_orderFwd[j];
+            double orev = m_orderRev[j];
+            double ropf = (of == 0.0) ? ef : ef * std::pow(C, of);
+            double ropr = (orev == 0.0) ? er : er * std::pow(C, orev);
+            cur += m_nCharge[j] * (ropf - ropr);
+            dphi -= m_nCharge[j] * m_nCharge[j] * FRT
+                    * (m_beta[j] * ropf + (1.0 - m_beta[j]) * ropr);
+            if (of != 0.0) {
+                dconc += m_nCharge[j] * of * ef * std::pow(C, of - 1.0);
+            }
+            if (orev != 0.0) {
+                dconc -= m_nCharge[j] * orev * er * std::pow(C, orev - 1.0);
+            }
+        }
+        current[i] = Faraday * cur;
+        if (dcurrent_dphi) {
+            dcurrent_dphi[i] = Faraday * dphi;
+        }
+        if (dcurrent_dconc) {
+            dcurrent_dconc[i] = Faraday * dconc;
+        }
+    }
+}
+
+}
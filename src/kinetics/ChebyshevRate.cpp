@@ -47,6 +47,71 @@ void ChebyshevData::restore()
     m_pressure_buf = -1.;
 }
 
+void ChebyshevEvaluator::clear()
+{
+    m_rxn.clear();
+    m_nT.clear();
+    m_nP.clear();
+    m_TrNum.clear();
+    m_TrDen.clear();
+    m_PrNum.clear();
+    m_PrDen.clear();
+    m_coeffs.clear();
+    m_coeffOffset.assign(1, 0);
+    m_dotProd.clear();
+    m_dotOffset.assign(1, 0);
+    m_log10P = NAN;
+}
+
+void ChebyshevEvaluator::update(const ChebyshevData& shared_data)
+{
+    if (shared_data.log10P == m_log10P) {
+        return;
+    }
+    m_log10P = shared_data.log10P;
+    for (size_t j = 0; j < m_rxn.size(); j++) {
+        size_t nT = m_nT[j];
+        const double* coeffs = m_coeffs.data() + m_coeffOffset[j];
+        double* dotProd = m_dotProd.data() + m_dotOffset[j];
+        double Pr = (2 * m_log10P + m_PrNum[j]) * m_PrDen[j];
+        double Cnm1 = Pr;
+        double Cn = 1;
+        double Cnp1;
+        for (size_t i = 0; i < nT; i++) {
+            dotProd[i] = coeffs[i];
+        }
+        for (size_t n = 1; n < m_nP[j]; n++) {
+            Cnp1 = 2 * Pr * Cn - Cnm1;
+            for (size_t i = 0; i < nT; i++) {
+                dotProd[i] += Cnp1 * coeffs[nT * n + i];
+            }
+            Cnm1 = Cn;
+            Cn = Cnp1;
+        }
+    }
+}
+
+void ChebyshevEvaluator::getRateConstants(const ChebyshevData& shared_data,
+                                          double* kf) const
+{
+    double recipT = shared_data.recipT;
+    for (size_t j = 0; j < m_rxn.size(); j++) {
+        const double* dotProd = m_dotProd.data() + m_dotOffset[j];
+        double Tr = (2 * recipT + m_TrNum[j]) * m_TrDen[j];
+        double Cnm1 = Tr;
+        double Cn = 1;
+        double Cnp1;
+        double logk = dotProd[0];
+        for (size_t i = 1; i < m_nT[j]; i++) {
+            Cnp1 = 2 * Tr * Cn - Cnm1;
+            logk += Cnp1 * dotProd[i];
+            Cnm1 = Cn;
+            Cn = Cnp1;
+        }
+        kf[m_rxn[j]] = std::pow(10, logk);
+    }
+}
+
 ChebyshevRate::ChebyshevRate(double Tmin, double Tmax, double Pmin, double Pmax,
                              const Array2D& coeffs) : ChebyshevRate()
 {
@@ -200,6 +200,102 @@ void FalloffRate::validate(const string& equation, const Kinetics& kin)
     }
 }
 
+void FalloffEvaluator::addReaction(size_t rxn, FalloffRate& rate)
+{
+    m_rxn.push_back(rxn);
+    m_activated.push_back(rate.chemicallyActivated());
+    auto& low = rate.lowRate();
+    m_ALow.push_back(low.preExponentialFactor());
+    m_bLow.push_back(low.temperatureExponent());
+    m_EaLow_R.push_back(low.activationEnergy_R());
+    auto& high = rate.highRate();
+    m_AHigh.push_back(high.preExponentialFactor());
+    m_bHigh.push_back(high.temperatureExponent());
+    m_EaHigh_R.push_back(high.activationEnergy_R());
+    m_kLow.push_back(NAN);
+    m_kHigh.push_back(NAN);
+}
+
+void FalloffEvaluator::clear()
+{
+    m_rxn.clear();
+    m_activated.clear();
+    m_ALow.clear();
+    m_bLow.clear();
+    m_EaLow_R.clear();
+    m_AHigh.clear();
+    m_bHigh.clear();
+    m_EaHigh_R.clear();
+    m_kLow.clear();
+    m_kHigh.clear();
+    m_temperature = NAN;
+}
+
+bool FalloffEvaluator::updateLimits(const FalloffData& shared_data)
+{
+    if (shared_data.temperature == m_temperature) {
+        return false;
+    }
+    m_temperature = shared_data.temperature;
+    double logT = shared_data.logT;
+    double recipT = shared_data.recipT;
+    for (size_t j = 0; j < m_rxn.size(); j++) {
+        m_kLow[j] = m_ALow[j] * std::exp(m_bLow[j] * logT - m_EaLow_R[j] * recipT);
+        m_kHigh[j] = m_AHigh[j] * std::exp(m_bHigh[j] * logT - m_EaHigh_R[j] * recipT);
+    }
+    return true;
+}
+
+void TroeEvaluator::update(const FalloffData& shared_data)
+{
+    if (!updateLimits(shared_data)) {
+        return;
+    }
+    double T = shared_data.temperature;
+    for (size_t j = 0; j < m_a.size(); j++) {
+        double Fcent = (1.0 - m_a[j]) * exp(-T*m_rt3[j]) + m_a[j] * exp(-T*m_rt1[j]);
+        if (m_t2[j]) {
+            Fcent += exp(- m_t2[j] / T);
+        }
+        m_logFcent[j] = log10(std::max(Fcent, SmallNumber));
+        m_cc[j] = -0.4 - 0.67 * m_logFcent[j];
+        m_nn[j] = 0.75 - 1.27 * m_logFcent[j];
+    }
+}
+
+void TroeEvaluator::getRateConstants(const FalloffData& shared_data, double* kf) const
+{
+    evaluate(shared_data, kf, [this](size_t j, double pr) {
+        double lpr = log10(std::max(pr, SmallNumber));
+        double f1 = (lpr + m_cc[j]) / (m_nn[j] - 0.14 * (lpr + m_cc[j]));
+        return pow(10.0, m_logFcent[j] / (1.0 + f1 * f1));
+    });
+}
+
+void SriEvaluator::update(const FalloffData& shared_data)
+{
+    if (!updateLimits(shared_data)) {
+        return;
+    }
+    double T = shared_data.temperature;
+    for (size_t j = 0; j < m_a.size(); j++) {
+        m_base[j] = m_a[j] * exp(- m_b[j] / T);
+        if (m_c[j] != 0.0) {
+            m_base[j] += exp(- T / m_c[j]);
+        }
+        m_scale[j] = m_d[j] * pow(T, m_e[j]);
+    }
+}
+
+void SriEvaluator::getRateConstants(const FalloffData& shared_data, double* kf) const
+{
+    evaluate(shared_data, kf, [this](size_t j, double pr) {
+        double lpr = log10(std::max(pr, SmallNumber));
+        double xx = 1.0 / (1.0 + lpr * lpr);
+        return pow(m_base[j], xx) * m_scale[j];
+    });
+}
+
 LindemannRate::LindemannRate(const AnyMap& node, const UnitStack& rate_units)
     : LindemannRate()
 {
@@ -8,8 +8,11 @@
 #include "cantera/kinetics/InterfaceKinetics.h"
 #include "cantera/kinetics/ImplicitSurfChem.h"
 #include "cantera/kinetics/Reaction.h"
+#include "cantera/kinetics/InterfaceRate.h"
 #include "cantera/thermo/SurfPhase.h"
+#include "cantera/thermo/CoverageDependentSurfPhase.h"
 #include "cantera/base/utilities.h"
+#include "cantera/base/PerfCounters.h"
 
 namespace Cantera
 {
@@ -89,9 +92,26 @@ void InterfaceKinetics::_update_rates_phi()
     }
 }
 
+bool InterfaceKinetics::phaseStateChanged(size_t n, vector<double>& states)
+{
+    const auto& tp = thermo(n);
+    double* state = &states[m_nStateVars * n];
+    double current[m_nStateVars] = {tp.temperature(), tp.density(), tp.pressure(),
+                                    static_cast<double>(tp.stateMFNumber())};
+    if (std::equal(current, current + m_nStateVars, state)) {
+        return false;
+    }
+    std::copy(current, current + m_nStateVars, state);
+    return true;
+}
+
 void InterfaceKinetics::_update_rates_C()
 {
     for (size_t n = 0; n < nPhases(); n++) {
+        if (!phaseStateChanged(n, m_concStates)) {
+            // concentrations of this phase are unchanged
+            continue;
+        }
         const auto& tp = thermo(n);
         /*
          * We call the getActivityConcentrations function of each ThermoPhase
@@ -154,7 +174,9 @@ void InterfaceKinetics::updateMu0()
     //      once the old framework is removed
     size_t ik = 0;
     for (size_t n = 0; n < nPhases(); n++) {
-        thermo(n).getStandardChemPotentials(m_mu0.data() + m_start[n]);
+        if (phaseStateChanged(n, m_mu0States)) {
+            thermo(n).getStandardChemPotentials(m_mu0.data() + m_start[n]);
+        }
         for (size_t k = 0; k < thermo(n).nSpecies(); k++) {
             m_mu0_Kc[ik] = m_mu0[ik] + Faraday * m_phi[n] * thermo(n).charge(k);
             m_mu0_Kc[ik] -= thermo(0).RT() * thermo(n).logStandardConc(k);
@@ -200,6 +222,7 @@ void InterfaceKinetics::getRevRateConstants(double* krev, bool doIrreversible)
 
 void InterfaceKinetics::updateROP()
 {
+    CT_PERF_SCOPE("InterfaceKinetics::updateROP");
     // evaluate rate constants and equilibrium constants at temperature and phi
     // (electric potential)
     _update_rates_T();
@@ -337,7 +360,9 @@ void InterfaceKinetics::getDeltaSSGibbs(double* deltaGSS)
     // chemical potentials of the pure species at the temperature and pressure
     // of the solution.
     for (size_t n = 0; n < nPhases(); n++) {
-        thermo(n).getStandardChemPotentials(m_mu0.data() + m_start[n]);
+        if (phaseStateChanged(n, m_mu0States)) {
+            thermo(n).getStandardChemPotentials(m_mu0.data() + m_start[n]);
+        }
     }
 
     // Use the stoichiometric manager to find deltaG for each reaction.
@@ -465,6 +490,11 @@ void InterfaceKinetics::modifyReaction(size_t i, shared_ptr<Reaction> r_base)
     size_t index = m_interfaceTypes[rate->type()];
     m_interfaceRates[index]->replace(i, *rate);
 
+    // Set flag for coverage dependence to true
+    if (rate->compositionDependent()) {
+        m_has_coverage_dependence = true;
+    }
+
     // Invalidate cached data
     m_redo_rates = true;
     m_temp += 0.1;
@@ -513,6 +543,15 @@ void InterfaceKinetics::resizeSpecies()
     m_mu0_Kc.resize(m_kk);
     m_grt.resize(m_kk);
     m_phi.resize(nPhases(), 0.0);
+    m_concStates.assign(m_nStateVars * nPhases(), NAN);
+    m_mu0States.assign(m_nStateVars * nPhases(), NAN);
+}
+
+void InterfaceKinetics::invalidateCache()
+{
+    Kinetics::invalidateCache();
+    std::fill(m_concStates.begin(), m_concStates.end(), NAN);
+    std::fill(m_mu0States.begin(), m_mu0States.end(), NAN);
 }
 
 void InterfaceKinetics::advanceCoverages(double tstep, double rtol, double atol,
@@ -603,6 +642,54 @@ double InterfaceKinetics::interfaceCurrent(const size_t iphase)
     return dotProduct * Faraday;
 }
 
+void InterfaceKinetics::getFwdRateConstants_ddT(double* dkfwd)
+{
+    assertDerivativesValid("InterfaceKinetics::getFwdRateConstants_ddT");
+    updateROP();
+    for (size_t i = 0; i < nReactions(); i++) {
+        dkfwd[i] = m_rfn[i] * m_perturb[i];
+    }
+    process_ddT(dkfwd);
+}
+
+void InterfaceKinetics::getFwdRatesOfProgress_ddT(double* drop)
+{
+    assertDerivativesValid("InterfaceKinetics::getFwdRatesOfProgress_ddT");
+    updateROP();
+    copy(m_ropf.begin(), m_ropf.end(), drop);
+    process_ddT(drop);
+}
+
+void InterfaceKinetics::getRevRatesOfProgress_ddT(double* drop)
+{
+    assertDerivativesValid("InterfaceKinetics::getRevRatesOfProgress_ddT");
+    updateROP();
+    copy(m_ropr.begin(), m_ropr.end(), drop);
+    process_ddT(drop);
+    Eigen::Map<Eigen::VectorXd> dRevRop(drop, nReactions());
+
+    // reverse rop times scaled inverse equilibrium constant derivatives
+    Eigen::Map<Eigen::VectorXd> dRevRop2(m_rbuf1.data(), nReactions());
+    copy(m_ropr.begin(), m_ropr.end(), m_rbuf1.begin());
+    applyEquilibriumConstants_ddT(dRevRop2.data());
+    dRevRop += dRevRop2;
+}
+
+void InterfaceKinetics::getNetRatesOfProgress_ddT(double* drop)
+{
+    assertDerivativesValid("InterfaceKinetics::getNetRatesOfProgress_ddT");
+    updateROP();
+    copy(m_ropnet.begin(), m_ropnet.end(), drop);
+    process_ddT(drop);
+    Eigen::Map<Eigen::VectorXd> dNetRop(drop, nReactions());
+
+    // reverse rop times scaled inverse equilibrium constant derivatives
+    Eigen::Map<Eigen::VectorXd> dNetRop2(m_rbuf1.data(), nReactions());
+    copy(m_ropr.begin(), m_ropr.end(), m_rbuf1.begin());
+    applyEquilibriumConstants_ddT(dNetRop2.data());
+    dNetRop -= dNetRop2;
+}
+
 Eigen::SparseMatrix<double> InterfaceKinetics::fwdRatesOfProgress_ddCi()
 {
     // check derivatives are valid
@@ -610,7 +697,12 @@ Eigen::SparseMatrix<double> InterfaceKinetics::fwdRatesOfProgress_ddCi()
     // forward reaction rate coefficients
     vector<double>& rop_rates = m_rbuf0;
     getFwdRateConstants(rop_rates.data());
-    return calculateCompositionDerivatives(m_reactantStoich, rop_rates);
+    Eigen::SparseMatrix<double> jac = calculateCompositionDerivatives(
+        m_reactantStoich, rop_rates);
+    if (!m_jac_skip_coverage_dependence) {
+        jac += calculateCoverageDerivatives(m_ropf.data(), nullptr);
+    }
+    return jac;
 }
 
 Eigen::SparseMatrix<double> InterfaceKinetics::revRatesOfProgress_ddCi()
@@ -621,7 +713,12 @@ Eigen::SparseMatrix<double> InterfaceKinetics::revRatesOfProgress_ddCi()
     vector<double>& rop_rates = m_rbuf0;
     getFwdRateConstants(rop_rates.data());
     applyEquilibriumConstants(rop_rates.data());
-    return calculateCompositionDerivatives(m_revProductStoich, rop_rates);
+    Eigen::SparseMatrix<double> jac = calculateCompositionDerivatives(
+        m_revProductStoich, rop_rates);
+    if (!m_jac_skip_coverage_dependence) {
+        jac += calculateCoverageDerivatives(nullptr, m_ropr.data());
+    }
+    return jac;
 }
 
 Eigen::SparseMatrix<double> InterfaceKinetics::netRatesOfProgress_ddCi()
@@ -636,7 +733,15 @@ Eigen::SparseMatrix<double> InterfaceKinetics::netRatesOfProgress_ddCi()
 
     // reverse reaction rate coefficients
     applyEquilibriumConstants(rop_rates.data());
-    return jac - calculateCompositionDerivatives(m_revProductStoich, rop_rates);
+    jac -= calculateCompositionDerivatives(m_revProductStoich, rop_rates);
+    if (!m_jac_skip_coverage_dependence) {
+        // reverse rates of progress enter with a negative sign
+        for (size_t i = 0; i < nReactions(); i++) {
+            m_rbuf1[i] = -m_ropr[i];
+        }
+        jac += calculateCoverageDerivatives(m_ropf.data(), m_rbuf1.data());
+    }
+    return jac;
 }
 
 void InterfaceKinetics::setDerivativeSettings(const AnyMap& settings)
@@ -657,8 +762,8 @@ void InterfaceKinetics::setDerivativeSettings(const AnyMap& settings)
 
 void InterfaceKinetics::getDerivativeSettings(AnyMap& settings) const
 {
-    settings["skip-coverage-dependence"] = m_jac_skip_electrochemistry;
-    settings["skip-electrochemistry"] = m_jac_skip_coverage_dependence;
+    settings["skip-coverage-dependence"] = m_jac_skip_coverage_dependence;
+    settings["skip-electrochemistry"] = m_jac_skip_electrochemistry;
     settings["rtol-delta"] = m_jac_rtol_delta;
 }
 
@@ -671,15 +776,122 @@ Eigen::SparseMatrix<double> InterfaceKinetics::calculateCompositionDerivatives(
     return stoich.derivatives(m_actConc.data(), outV.data());
 }
 
+Eigen::SparseMatrix<double> InterfaceKinetics::calculateCoverageDerivatives(
+    const double* ropf, const double* ropr)
+{
+    Eigen::SparseMatrix<double> out(nReactions(), m_kk);
+    auto surf = dynamic_cast<SurfPhase*>(&thermo(0));
+    if (!surf) {
+        return out;
+    }
+    size_t nsurf = surf->nSpecies();
+    double T = surf->temperature();
+    double sd = surf->siteDensity();
+    vector<double> coverages(nsurf);
+    surf->getCoverages(coverages.data());
+
+    // coverage dependence of the forward rate constants; the coverage of species j
+    // depends on its concentration as d(theta_j)/d(C_j) = size_j / sd
+    vector<Eigen::Triplet<double>> triplets;
+    if (m_has_coverage_dependence) {
+        vector<pair<size_t, double>> dlnk;
+        for (size_t i = 0; i < nReactions(); i++) {
+            double rop = (ropf ? ropf[i] : 0.0) + (ropr ? ropr[i] : 0.0);
+            auto rate = m_reactions[i]->rate();
+            if (rop == 0.0 || !rate->compositionDependent()) {
+                continue;
+            }
+            auto rbase = std::dynamic_pointer_cast<InterfaceRateBase>(rate);
+            if (!rbase) {
+                continue;
+            }
+            dlnk.clear();
+            rbase->setSiteDensity(sd);
+            rbase->getCoverageDerivatives(coverages.data(), T, m_rfn[i], dlnk);
+            for (auto& [j, d] : dlnk) {
+                triplets.emplace_back(static_cast<int>(i), static_cast<int>(j),
+                                      rop * d * surf->size(j) / sd);
+            }
+        }
+    }
+
+    // coverage dependence of the equilibrium constants, which arises if the
+    // standard chemical potentials of the surface species depend on coverages
+    auto covdep = dynamic_cast<CoverageDependentSurfPhase*>(surf);
+    if (covdep && ropr && m_revindex.size()) {
+        vector<double> dmu0(nsurf * nsurf);
+        covdep->getStandardChemPotentials_ddCov(dmu0.data());
+        vector<double>& dmu = m_grt;
+        vector<double>& delta = m_rbuf0;
+        fill(dmu.begin(), dmu.end(), 0.0);
+        double rrt = 1.0 / surf->RT();
+        for (size_t j = 0; j < nsurf; j++) {
+            copy(&dmu0[nsurf * j], &dmu0[nsurf * (j + 1)], dmu.begin());
+            fill(delta.begin(), delta.end(), 0.0);
+            getRevReactionDelta(dmu.data(), delta.data());
+            double scale = rrt * surf->size(j) / sd;
+            for (size_t irxn : m_revindex) {
+                if (delta[irxn] != 0.0 && ropr[irxn] != 0.0) {
+                    triplets.emplace_back(static_cast<int>(irxn), static_cast<int>(j),
+                                          ropr[irxn] * delta[irxn] * scale);
+                }
+            }
+        }
+    }
+    out.setFromTriplets(triplets.begin(), triplets.end());
+    return out;
+}
+
 void InterfaceKinetics::assertDerivativesValid(const string& name)
 {
-    if (!m_jac_skip_coverage_dependence && m_has_coverage_dependence) {
-        throw NotImplementedError(name, "Coverage-dependent reactions not supported.");
-    } else if (!m_jac_skip_electrochemistry && m_has_electrochemistry) {
+    if (!m_jac_skip_electrochemistry && m_has_electrochemistry) {
         throw NotImplementedError(name, "Electrochemical reactions not supported.");
     }
 }
 
+void InterfaceKinetics::applyEquilibriumConstants_ddT(double* drkcn)
+{
+    double T = thermo(0).temperature();
+    double dT = T * m_jac_rtol_delta;
+    vector<double>& delta0 = m_rbuf0;
+    vector<double> delta1(nReactions(), 0.0);
+
+    // Delta mu^0 / T at the current state
+    updateMu0();
+    fill(delta0.begin(), delta0.end(), 0.0);
+    getRevReactionDelta(m_mu0_Kc.data(), delta0.data());
+
+    // compute perturbed Delta mu^0 for all reversible reactions
+    vector<vector<double>> states(nPhases());
+    for (size_t n = 0; n < nPhases(); n++) {
+        thermo(n).saveState(states[n]);
+        thermo(n).setState_TP(T + dT, thermo(n).pressure());
+    }
+    updateMu0();
+    getRevReactionDelta(m_mu0_Kc.data(), delta1.data());
+    for (size_t n = 0; n < nPhases(); n++) {
+        thermo(n).restoreState(states[n]);
+    }
+    updateMu0();
+
+    // d(ln(rkcn))/dT = d(Delta mu^0 / RT)/dT
+    for (size_t irxn : m_revindex) {
+        drkcn[irxn] *= (delta1[irxn] / (T + dT) - delta0[irxn] / T)
+            / (GasConstant * dT);
+    }
+    for (size_t irxn : m_irrev) {
+        drkcn[irxn] = 0.0;
+    }
+}
+
+void InterfaceKinetics::process_ddT(double* drop)
+{
+    // apply temperature derivative of the rate constants
+    for (auto& rates : m_interfaceRates) {
+        rates->processRateConstants_ddT(drop, m_rfn.data(), m_jac_rtol_delta);
+    }
+}
+
 void InterfaceKinetics::applyEquilibriumConstants(double* rop)
 {
     // For reverse rates computed from thermochemistry, multiply the forward
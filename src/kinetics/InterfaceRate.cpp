@@ -276,6 +276,22 @@ void InterfaceRateBase::updateFromStruct(const InterfaceData& shared_data) {
     }
 }
 
+void InterfaceRateBase::getCoverageDerivatives(const double* coverages, double T,
+    double kf, vector<pair<size_t, double>>& dlnk) const
+{
+    for (auto& [iCov, iKin] : m_indices) {
+        double theta = coverages[iKin];
+        const double* E = m_ec[iCov].data();
+        double dE = ((4 * E[4] * theta + 3 * E[3]) * theta + 2 * E[2]) * theta + E[1];
+        double d = std::log(10.0) * m_ac[iCov] - dE / T;
+        if (theta > Tiny) {
+            // consistent with the lower bound used for logCoverages
+            d += m_mc[iCov] / theta;
+        }
+        dlnk.emplace_back(iKin, d);
+    }
+}
+
 void InterfaceRateBase::setContext(const Reaction& rxn, const Kinetics& kin)
 {
     setSpecies(kin.thermo().speciesNames());
@@ -302,6 +318,22 @@ void InterfaceRateBase::setContext(const Reaction& rxn, const Kinetics& kin)
     }
 }
 
+void StickingCoverage::getCoverageDerivatives(const double* coverages, double T,
+    double kf, vector<pair<size_t, double>>& dlnk) const
+{
+    size_t start = dlnk.size();
+    InterfaceRateBase::getCoverageDerivatives(coverages, T, kf, dlnk);
+    if (m_motzWise && kf != 0.0) {
+        // Recover the corrected sticking coefficient gamma' = gamma / (1 - gamma/2),
+        // where d ln(gamma') / d ln(gamma) = 1 + gamma'/2
+        double factor = pow(m_siteDensity, -m_surfaceOrder) * sqrt(T) * m_multiplier;
+        double gammaCorr = kf / factor;
+        for (size_t i = start; i < dlnk.size(); i++) {
+            dlnk[i].second *= 1 + 0.5 * gammaCorr;
+        }
+    }
+}
+
 StickingCoverage::StickingCoverage()
     : m_motzWise(false)
     , m_explicitMotzWise(false)
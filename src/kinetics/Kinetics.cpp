@@ -559,6 +559,69 @@ Eigen::SparseMatrix<double> Kinetics::netProductionRates_ddCi()
     return m_stoichMatrix * netRatesOfProgress_ddCi();
 }
 
+void Kinetics::getNetProductionRates_ddX(Eigen::SparseMatrix<double>& jac)
+{
+    getNetRatesOfProgress_ddX(m_ropJac);
+    multiplyStoichMatrix(m_ropJac, jac);
+}
+
+void Kinetics::getNetProductionRates_ddCi(Eigen::SparseMatrix<double>& jac)
+{
+    getNetRatesOfProgress_ddCi(m_ropJac);
+    multiplyStoichMatrix(m_ropJac, jac);
+}
+
+void Kinetics::multiplyStoichMatrix(const Eigen::SparseMatrix<double>& rop,
+                                    Eigen::SparseMatrix<double>& out)
+{
+    if (!sameSparsityPattern(rop, m_productJacSource)) {
+        // Each entry (k, j) of the product receives contributions from entries
+        // (r, j) of the rate-of-progress derivatives for all reactions r involving
+        // species k. These terms are determined once for a given sparsity pattern.
+        SparseTriplets triplets;
+        for (int j = 0; j < rop.outerSize(); j++) {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(rop, j); it; ++it) {
+                for (Eigen::SparseMatrix<double>::InnerIterator
+                     st(m_stoichMatrix, it.row()); st; ++st)
+                {
+                    triplets.emplace_back(static_cast<int>(st.row()), j, 0.0);
+                }
+            }
+        }
+        m_productJacPattern.resize(m_stoichMatrix.rows(), rop.cols());
+        m_productJacPattern.setFromTriplets(triplets.begin(), triplets.end());
+        m_productJacPattern.makeCompressed();
+
+        m_productJacOut.clear();
+        m_productJacIn.clear();
+        m_productJacCoeffs.clear();
+        const int* outer = rop.outerIndexPtr();
+        const int* inner = rop.innerIndexPtr();
+        for (int j = 0; j < rop.outerSize(); j++) {
+            for (int n = outer[j]; n < outer[j + 1]; n++) {
+                for (Eigen::SparseMatrix<double>::InnerIterator
+                     st(m_stoichMatrix, inner[n]); st; ++st)
+                {
+                    m_productJacOut.push_back(sparseStorageIndex(
+                        m_productJacPattern, static_cast<int>(st.row()), j));
+                    m_productJacIn.push_back(n);
+                    m_productJacCoeffs.push_back(st.value());
+                }
+            }
+        }
+        m_productJacSource = rop;
+    }
+    if (!sameSparsityPattern(out, m_productJacPattern)) {
+        out = m_productJacPattern;
+    }
+    double* values = out.valuePtr();
+    const double* in = rop.valuePtr();
+    std::fill(values, values + out.nonZeros(), 0.0);
+    for (size_t n = 0; n < m_productJacOut.size(); n++) {
+        values[m_productJacOut[n]] += m_productJacCoeffs[n] * in[m_productJacIn[n]];
+    }
+}
+
 void Kinetics::addThermo(shared_ptr<ThermoPhase> thermo)
 {
     // the phase with lowest dimensionality is assumed to be the
@@ -612,8 +675,10 @@ void Kinetics::resizeSpecies()
 
 bool Kinetics::addReaction(shared_ptr<Reaction> r, bool resize)
 {
-    r->check();
-    r->validate(*this);
+    if (!m_reactionsChecked) {
+        r->check();
+        r->validate(*this);
+    }
 
     if (m_kk == 0) {
         init();
@@ -621,7 +686,7 @@ bool Kinetics::addReaction(shared_ptr<Reaction> r, bool resize)
     resizeSpecies();
 
     // Check validity of reaction within the context of the Kinetics object
-    if (!r->checkSpecies(*this)) {
+    if (!m_reactionsChecked && !r->checkSpecies(*this)) {
         // Do not add reaction
         return false;
     }
@@ -702,6 +767,41 @@ bool Kinetics::addReaction(shared_ptr<Reaction> r, bool resize)
     return true;
 }
 
+size_t Kinetics::addReactions(const vector<shared_ptr<Reaction>>& reactions,
+                              bool checked, vector<string>* errors)
+{
+    size_t nTotal = nReactions() + reactions.size();
+    m_reactions.reserve(nTotal);
+    for (auto* v : {&m_rfn, &m_delta_gibbs0, &m_rkcn, &m_ropf, &m_ropr, &m_ropnet,
+                    &m_perturb, &m_dH})
+    {
+        v->reserve(nTotal);
+    }
+
+    size_t nAdded = 0;
+    m_reactionsChecked = checked;
+    try {
+        for (const auto& r : reactions) {
+            if (!errors) {
+                nAdded += addReaction(r, false);
+                continue;
+            }
+            try {
+                nAdded += addReaction(r, false);
+            } catch (CanteraError& err) {
+                errors->push_back(err.what());
+            }
+        }
+    } catch (...) {
+        m_reactionsChecked = false;
+        resizeReactions();
+        throw;
+    }
+    m_reactionsChecked = false;
+    resizeReactions();
+    return nAdded;
+}
+
 void Kinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
 {
     checkReactionIndex(i);
@@ -13,11 +13,31 @@
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/Solution.h"
+#include "cantera/base/ExtensionManager.h"
 #include <boost/algorithm/string.hpp>
 
 namespace Cantera
 {
 
+namespace {
+
+//! Create a reaction and perform the checks done by Kinetics::addReaction() which
+//! do not modify the Kinetics object. Returns `nullptr` if the reaction should be
+//! skipped because it contains undeclared species.
+shared_ptr<Reaction> newCheckedReaction(const AnyMap& node, Kinetics& kin)
+{
+    // Copy the definition, which may be part of a shared input file
+    shared_ptr<Reaction> R = newReaction(AnyMap(node), kin);
+    R->check();
+    R->validate(kin);
+    if (!R->checkSpecies(kin)) {
+        return nullptr;
+    }
+    return R;
+}
+
+}
+
 KineticsFactory* KineticsFactory::s_factory = 0;
 std::mutex KineticsFactory::kinetics_mutex;
 
@@ -99,9 +119,9 @@ shared_ptr<Kinetics> newKinetics(const vector<shared_ptr<ThermoPhase>>& phases,
                                  const string& filename)
 {
     string reaction_phase = phases.at(0)->name();
-    AnyMap root = AnyMap::fromYamlFile(filename);
-    AnyMap& phaseNode = root["phases"].getMapWhere("name", reaction_phase);
-    return newKinetics(phases, phaseNode, root);
+    auto root = AnyMap::sharedYamlFile(filename);
+    AnyMap phaseNode = root->at("phases").getMapWhere("name", reaction_phase);
+    return newKinetics(phases, phaseNode, *root);
 }
 
 void addReactions(Kinetics& kin, const AnyMap& phaseNode, const AnyMap& rootNode)
@@ -161,8 +181,47 @@ void addReactions(Kinetics& kin, const AnyMap& phaseNode, const AnyMap& rootNode
         }
     }
 
-    // Add reactions from each section
+    // Add reactions from each section. The reactions in each section are created
+    // and checked concurrently, and then added to the Kinetics object in order.
+    // User-defined rate types may be implemented in a language which does not
+    // support this, in which case the reactions are created sequentially.
     fmt::memory_buffer add_rxn_err;
+    auto addSection = [&](const vector<AnyMap>& items) {
+        size_t grain = ExtensionManager::hasUserRateTypes() ? npos : 64;
+        vector<shared_ptr<Reaction>> reactions(items.size());
+        vector<string> errors(items.size());
+        parallelFor(items.size(), [&](size_t i) {
+            #ifdef NDEBUG
+                try {
+                    reactions[i] = newCheckedReaction(items[i], kin);
+                } catch (CanteraError& err) {
+                    errors[i] = err.what();
+                }
+            #else
+                reactions[i] = newCheckedReaction(items[i], kin);
+            #endif
+        }, grain);
+
+        vector<shared_ptr<Reaction>> checked;
+        checked.reserve(items.size());
+        for (size_t i = 0; i < items.size(); i++) {
+            if (!errors[i].empty()) {
+                fmt_append(add_rxn_err, "{}", errors[i]);
+            } else if (reactions[i]) {
+                checked.push_back(reactions[i]);
+            }
+        }
+        #ifdef NDEBUG
+            vector<string> addErrors;
+            kin.addReactions(checked, true, &addErrors);
+            for (const auto& err : addErrors) {
+                fmt_append(add_rxn_err, "{}", err);
+            }
+        #else
+            kin.addReactions(checked, true);
+        #endif
+    };
+
     for (size_t i = 0; i < sections.size(); i++) {
         if (rules[i] == "all") {
             kin.skipUndeclaredSpecies(false);
@@ -180,33 +239,13 @@ void addReactions(Kinetics& kin, const AnyMap& phaseNode, const AnyMap& rootNode
             // specified section is in a different file
             string fileName (sections[i].begin(), slash.begin());
             string node(slash.end(), sections[i].end());
-            AnyMap reactions = AnyMap::fromYamlFile(fileName,
+            auto reactions = AnyMap::sharedYamlFile(fileName,
                 rootNode.getString("__file__", ""));
-            loadExtensions(reactions);
-            for (const auto& R : reactions[node].asVector<AnyMap>()) {
-                #ifdef NDEBUG
-                    try {
-                        kin.addReaction(newReaction(R, kin), false);
-                    } catch (CanteraError& err) {
-                        fmt_append(add_rxn_err, "{}", err.what());
-                    }
-                #else
-                    kin.addReaction(newReaction(R, kin), false);
-                #endif
-            }
+            loadExtensions(*reactions);
+            addSection(reactions->at(node).asVector<AnyMap>());
         } else {
             // specified section is in the current file
-            for (const auto& R : rootNode.at(sections[i]).asVector<AnyMap>()) {
-                #ifdef NDEBUG
-                    try {
-                        kin.addReaction(newReaction(R, kin), false);
-                    } catch (CanteraError& err) {
-                        fmt_append(add_rxn_err, "{}", err.what());
-                    }
-                #else
-                    kin.addReaction(newReaction(R, kin), false);
-                #endif
-            }
+            addSection(rootNode.at(sections[i]).asVector<AnyMap>());
         }
     }
 
@@ -49,6 +49,71 @@ void PlogData::restore()
 
 // Methods of class PlogRate
 
+void PlogEvaluator::clear()
+{
+    m_rxn.clear();
+    m_A.clear();
+    m_logA.clear();
+    m_b.clear();
+    m_Ea_R.clear();
+    m_grid.assign(1, 0);
+    m_logP.clear();
+    m_first.clear();
+    m_last.clear();
+    m_ilow.clear();
+    m_ihigh.clear();
+    m_logP1.clear();
+    m_logP2.clear();
+    m_rDeltaP.clear();
+    m_logPressure = NAN;
+}
+
+void PlogEvaluator::addArrhenius(const ArrheniusRate& rate)
+{
+    m_A.push_back(rate.preExponentialFactor());
+    m_logA.push_back(rate.logPreExponentialFactor());
+    m_b.push_back(rate.temperatureExponent());
+    m_Ea_R.push_back(rate.activationEnergy_R());
+}
+
+void PlogEvaluator::update(const PlogData& shared_data)
+{
+    double logP = shared_data.logP;
+    if (logP == m_logPressure) {
+        return;
+    }
+    m_logPressure = logP;
+    for (size_t j = 0; j < m_rxn.size(); j++) {
+        if (logP > m_logP1[j] && logP < m_logP2[j]) {
+            continue;
+        }
+        auto begin = m_logP.begin() + m_grid[j];
+        auto end = m_logP.begin() + m_grid[j + 1];
+        auto iter = std::upper_bound(begin, end, logP);
+        AssertThrowMsg(iter != end, "PlogEvaluator::update",
+                       "Pressure out of range: {}", logP);
+        AssertThrowMsg(iter != begin, "PlogEvaluator::update",
+                       "Pressure out of range: {}", logP);
+        m_ihigh[j] = iter - m_logP.begin();
+        m_ilow[j] = m_ihigh[j] - 1;
+        m_logP1[j] = m_logP[m_ilow[j]];
+        m_logP2[j] = m_logP[m_ihigh[j]];
+        m_rDeltaP[j] = 1.0 / (m_logP2[j] - m_logP1[j]);
+    }
+}
+
+void PlogEvaluator::getRateConstants(const PlogData& shared_data, double* kf) const
+{
+    double logT = shared_data.logT;
+    double recipT = shared_data.recipT;
+    for (size_t j = 0; j < m_rxn.size(); j++) {
+        double log_k1 = logRate(m_ilow[j], logT, recipT);
+        double log_k2 = logRate(m_ihigh[j], logT, recipT);
+        kf[m_rxn[j]] = std::exp(log_k1 + (log_k2 - log_k1)
+                                * (m_logPressure - m_logP1[j]) * m_rDeltaP[j]);
+    }
+}
+
 PlogRate::PlogRate(const std::multimap<double, ArrheniusRate>& rates)
 {
     setRates(rates);
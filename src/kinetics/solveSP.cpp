@@ -75,6 +75,24 @@ solveSP::solveSP(ImplicitSurfChem* surfChemPtr, int bulkFunc) :
         }
     }
 
+    // Map the species of each kinetics object onto the solution vector
+    m_kinEqnIndex.resize(m_numSurfPhases);
+    for (size_t isp = 0; isp < m_numSurfPhases; isp++) {
+        InterfaceKinetics* kin = m_objects[m_indexKinObjSurfPhase[isp]];
+        m_kinEqnIndex[isp].assign(kin->nTotalSpecies(), npos);
+        for (size_t iph = 0; iph < kin->nPhases(); iph++) {
+            for (size_t jsp = 0; jsp < m_numSurfPhases; jsp++) {
+                if (&kin->thermo(iph) != m_ptrsSurfPhase[jsp]) {
+                    continue;
+                }
+                size_t kstart = kin->kineticsSpeciesIndex(0, iph);
+                for (size_t k = 0; k < m_nSpeciesSurfPhase[jsp]; k++) {
+                    m_kinEqnIndex[isp][kstart + k] = m_eqnIndexStartSolnPhase[jsp] + k;
+                }
+            }
+        }
+    }
+
     // Dimension solution vector
     size_t dim1 = std::max<size_t>(1, m_neq);
     m_CSolnSP.resize(dim1, 0.0);
@@ -103,6 +121,7 @@ int solveSP::solveSurfProb(int ifunc, double time_scale, double TKelvin,
     double damp=1.0;
     double inv_t = 0.0;
     double t_real = 0.0, update_norm = 1.0E6;
+    double update_norm_old = 1.0E20;
     bool do_time = false, not_converged = true;
     m_ioflag = std::min(m_ioflag, 1);
 
@@ -124,6 +143,12 @@ int solveSP::solveSurfProb(int ifunc, double time_scale, double TKelvin,
 
     m_CSolnSPInit = m_CSolnSP;
 
+    // The factorization from a previous call can only be used as a starting
+    // point if the conditions are unchanged
+    if (TKelvin != m_jacTemperature || PGas != m_jacPressure) {
+        m_jacFactored = false;
+    }
+
     // Calculate the largest species in each phase
     evalSurfLarge(m_CSolnSP.data());
 
@@ -181,10 +206,17 @@ int solveSP::solveSurfProb(int ifunc, double time_scale, double TKelvin,
         }
         deltaT = 1.0/inv_t;
 
-        // Call the routine to numerically evaluation the Jacobian and residual
-        // for the current iteration.
-        resjac_eval(m_Jac, m_resid.data(), m_CSolnSP.data(),
-                    m_CSolnSPOld.data(), do_time, deltaT);
+        // Evaluate the residual for the current iteration, and the Jacobian if
+        // the current factorization can't be reused.
+        bool newJac = !canReuseJacobian(inv_t, damp, update_norm, update_norm_old);
+        if (newJac) {
+            resjac_eval(m_Jac, m_resid.data(), m_CSolnSP.data(),
+                        m_CSolnSPOld.data(), do_time, deltaT);
+        } else {
+            fun_eval(m_resid.data(), m_CSolnSP.data(), m_CSolnSPOld.data(),
+                     do_time, deltaT);
+            m_jacAge++;
+        }
 
         // Calculate the weights. Make sure the calculation is carried out on
         // the first iteration.
@@ -197,7 +229,22 @@ int solveSP::solveSurfProb(int ifunc, double time_scale, double TKelvin,
         double resid_norm = calcWeightedNorm(m_wtResid.data(), m_resid.data(), m_neq);
 
         // Solve Linear system.  The solution is in m_resid
-        solve(m_Jac, m_resid.data());
+        if (newJac) {
+            m_jacLU.compute(MappedMatrix(m_Jac.ptrColumn(0), m_neq, m_neq));
+            m_jacFactored = true;
+            m_jacAge = 1;
+            m_jacInvT = inv_t;
+            m_jacTemperature = TKelvin;
+            m_jacPressure = PGas;
+            m_jacSurfLarge = m_spSurfLarge;
+        }
+        MappedVector dx(m_resid.data(), m_neq);
+        dx = m_jacLU.solve(dx);
+        if (!dx.allFinite()) {
+            m_jacFactored = false;
+            throw CanteraError("solveSP::solveSurfProb",
+                               "Jacobian matrix is singular");
+        }
 
         // Calculate the Damping factor needed to keep all unknowns between 0
         // and 1, and not allow too large a change (factor of 2) in any unknown.
@@ -205,6 +252,7 @@ int solveSP::solveSurfProb(int ifunc, double time_scale, double TKelvin,
 
         // Calculate the weighted norm of the update vector Here, resid is the
         // delta of the solution, in concentration units.
+        update_norm_old = update_norm;
         update_norm = calcWeightedNorm(m_wtSpecies.data(),
                                        m_resid.data(), m_neq);
 
@@ -422,6 +470,15 @@ void solveSP::resjac_eval(DenseMatrix& jac, double resid[], double CSoln[],
     size_t kColIndex = 0;
     // Calculate the residual
     fun_eval(resid, CSoln, CSolnOld, do_time, deltaT);
+
+    // Use the analytic derivatives of the surface production rates if possible
+    if (m_analyticJac && m_bulkFunc != BULK_DEPOSITION) {
+        if (analyticJacobian(jac, do_time, deltaT)) {
+            return;
+        }
+        m_analyticJac = false;
+    }
+
     // Now we will look over the columns perturbing each unknown.
     for (size_t jsp = 0; jsp < m_numSurfPhases; jsp++) {
         size_t nsp = m_nSpeciesSurfPhase[jsp];
@@ -458,6 +515,71 @@ void solveSP::resjac_eval(DenseMatrix& jac, double resid[], double CSoln[],
     }
 }
 
+bool solveSP::analyticJacobian(DenseMatrix& jac, const bool do_time,
+                               const double deltaT)
+{
+    jac.zero();
+    for (size_t isp = 0; isp < m_numSurfPhases; isp++) {
+        InterfaceKinetics* kin = m_objects[isp];
+        Eigen::SparseMatrix<double> dwdot;
+        try {
+            dwdot = kin->netProductionRates_ddCi();
+        } catch (NotImplementedError&) {
+            return false;
+        }
+
+        size_t kins = m_eqnIndexStartSolnPhase[isp];
+        size_t kstart = m_kinSpecIndex[kins];
+        size_t nsp = m_nSpeciesSurfPhase[isp];
+        const vector<size_t>& eqnIndex = m_kinEqnIndex[isp];
+        // The unknowns are the concentrations of the surface species (see
+        // updateState()), so the rate derivatives map directly onto the Jacobian
+        for (int col = 0; col < dwdot.outerSize(); col++) {
+            size_t jcol = eqnIndex[col];
+            if (jcol == npos) {
+                continue;
+            }
+            for (Eigen::SparseMatrix<double>::InnerIterator it(dwdot, col); it; ++it) {
+                size_t k = it.row();
+                if (k >= kstart && k < kstart + nsp) {
+                    jac(kins + k - kstart, jcol) -= it.value();
+                }
+            }
+        }
+        if (do_time) {
+            for (size_t k = 0; k < nsp; k++) {
+                jac(kins + k, kins + k) += 1.0 / deltaT;
+            }
+        }
+
+        // Site conservation equation replaces the equation for the largest
+        // species
+        size_t kspecial = kins + m_spSurfLarge[isp];
+        for (size_t j = 0; j < m_neq; j++) {
+            jac(kspecial, j) = 0.0;
+        }
+        for (size_t k = 0; k < nsp; k++) {
+            jac(kspecial, kins + k) = -1.0;
+        }
+    }
+    return true;
+}
+
+bool solveSP::canReuseJacobian(double inv_t, double damp, double update_norm,
+                               double update_norm_old) const
+{
+    if (!m_jacFactored || m_jacAge >= m_maxJacAge || damp < 1.0
+        || m_spSurfLarge != m_jacSurfLarge) {
+        return false;
+    }
+    // Require rapid convergence of the modified Newton iteration
+    if (update_norm > 0.5 * update_norm_old) {
+        return false;
+    }
+    // The time step contributes to the diagonal of the Jacobian
+    return inv_t <= 2.0 * m_jacInvT && inv_t >= 0.5 * m_jacInvT;
+}
+
 /**
  * This function calculates a damping factor for the Newton iteration update
  * vector, dxneg, to insure that all site and bulk fractions, x, remain
@@ -5,6 +5,7 @@
 
 #include "cantera/base/global.h"
 #include "cantera/numerics/AdaptivePreconditioner.h"
+#include "cantera/base/PerfCounters.h"
 
 namespace Cantera
 {
@@ -76,6 +77,7 @@ void AdaptivePreconditioner::prunePreconditioner()
 void AdaptivePreconditioner::solve(const size_t stateSize, double* rhs_vector, double*
     output)
 {
+    CT_PERF_SCOPE("AdaptivePreconditioner::solve");
     // creating vectors in the form of Ax=b
     Eigen::Map<Eigen::VectorXd> bVector(rhs_vector, stateSize);
     Eigen::Map<Eigen::VectorXd> xVector(output, stateSize);
@@ -9,6 +9,7 @@
 
 #if CT_USE_LAPACK
     #include "cantera/numerics/ctlapack.h"
+#include "cantera/base/PerfCounters.h"
 #else
     #include "sunlinsol/sunlinsol_band.h"
 #endif
@@ -225,6 +226,7 @@ void BandMatrix::leftMult(const double* const b, double* const prod) const
 
 int BandMatrix::factor()
 {
+    CT_PERF_SCOPE("BandMatrix::factor");
     ludata = data;
 #if CT_USE_LAPACK
     ct_dgbtrf(nRows(), nColumns(), nSubDiagonals(), nSuperDiagonals(),
@@ -258,6 +260,7 @@ int BandMatrix::solve(const double* const b, double* const x)
 
 int BandMatrix::solve(double* b, size_t nrhs, size_t ldb)
 {
+    CT_PERF_SCOPE("BandMatrix::solve");
     if (!m_factored) {
         factor();
     }
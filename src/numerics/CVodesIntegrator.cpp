@@ -10,6 +10,7 @@
 using namespace std;
 
 #include "cantera/numerics/sundials_headers.h"
+#include "cantera/base/PerfCounters.h"
 
 namespace {
 
@@ -68,6 +69,38 @@ extern "C" {
         }
     #endif
 
+    //! Function called by cvodes to evaluate the right-hand side of the adjoint
+    //! equations for the backward problem used in adjoint sensitivity analysis.
+    static int cvodes_rhsB(sunrealtype t, N_Vector y, N_Vector yB, N_Vector yBdot,
+                           void* f_data)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        return f->evalAdjointNoThrow(t, NV_DATA_S(y), NV_DATA_S(yB),
+                                     NV_DATA_S(yBdot));
+    }
+
+    //! Function called by cvodes to evaluate the integrand of the quadrature giving
+    //! the parameter sensitivities in adjoint sensitivity analysis.
+    static int cvodes_quadB(sunrealtype t, N_Vector y, N_Vector yB, N_Vector qBdot,
+                            void* f_data)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        return f->evalAdjointQuadratureNoThrow(t, NV_DATA_S(y), NV_DATA_S(yB),
+                                               NV_DATA_S(qBdot));
+    }
+
+    //! Function called by cvodes to evaluate the Jacobian of the adjoint equations
+    //! for the Newton iteration of the backward problem. CVODES zeroes the dense
+    //! matrix *JB* before calling this function.
+    static int cvodes_jacB(sunrealtype t, N_Vector y, N_Vector yB, N_Vector fyB,
+                           SUNMatrix JB, void* f_data, N_Vector tmp1,
+                           N_Vector tmp2, N_Vector tmp3)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        return f->evalAdjointJacobianNoThrow(t, NV_DATA_S(y),
+                                             SUNDenseMatrix_Data(JB));
+    }
+
     static int cvodes_prec_setup(sunrealtype t, N_Vector y, N_Vector ydot,
                                  sunbooleantype jok, sunbooleantype *jcurPtr,
                                  sunrealtype gamma, void *f_data)
@@ -100,6 +133,7 @@ CVodesIntegrator::CVodesIntegrator()
 
 CVodesIntegrator::~CVodesIntegrator()
 {
+    adjointFree();
     if (m_cvode_mem) {
         if (m_np > 0) {
             CVodeSensFree(m_cvode_mem);
@@ -276,6 +310,7 @@ void CVodesIntegrator::initialize(double t0, FuncEval& func)
 
     func.getState(NV_DATA_S(m_y));
 
+    adjointFree();
     if (m_cvode_mem) {
         CVodeFree(&m_cvode_mem);
     }
@@ -323,7 +358,13 @@ void CVodesIntegrator::initialize(double t0, FuncEval& func)
     flag = CVodeSetUserData(m_cvode_mem, &func);
     checkError(flag, "initialize", "CVodeSetUserData");
 
-    if (func.nparams() > 0) {
+    m_adjoint = (m_adjointSteps > 0);
+    if (m_adjoint) {
+        // Parameter sensitivities are obtained from the backward problem instead
+        // of the forward sensitivity equations
+        flag = CVodeAdjInit(m_cvode_mem, m_adjointSteps, CV_HERMITE);
+        checkError(flag, "initialize", "CVodeAdjInit");
+    } else if (func.nparams() > 0) {
         sensInit(t0, func);
         flag = CVodeSetSensParams(m_cvode_mem, func.m_sens_params.data(),
                                   func.m_paramScales.data(), NULL);
@@ -346,6 +387,10 @@ void CVodesIntegrator::reinitialize(double t0, FuncEval& func)
     }
     int result = CVodeReInit(m_cvode_mem, m_t0, m_y);
     checkError(result, "reinitialize", "CVodeReInit");
+    if (m_adjoint) {
+        result = CVodeAdjReInit(m_cvode_mem);
+        checkError(result, "reinitialize", "CVodeAdjReInit");
+    }
     applyOptions();
 }
 
@@ -481,6 +526,7 @@ void CVodesIntegrator::applyOptions()
 
 void CVodesIntegrator::integrate(double tout)
 {
+    CT_PERF_SCOPE("CVodesIntegrator::integrate");
     if (tout == m_time) {
         return;
     } else if (tout < m_time) {
@@ -501,7 +547,7 @@ void CVodesIntegrator::integrate(double tout)
                 "time ({}).\nCurrent integrator time: {}{}",
                 nsteps, tout, m_tInteg, f_errs);
         }
-        int flag = CVode(m_cvode_mem, tout, m_y, &m_tInteg, CV_ONE_STEP);
+        int flag = stepForward(tout);
         if (flag != CV_SUCCESS) {
             string f_errs = m_func->getErrors();
             if (!f_errs.empty()) {
@@ -523,7 +569,8 @@ void CVodesIntegrator::integrate(double tout)
 
 double CVodesIntegrator::step(double tout)
 {
-    int flag = CVode(m_cvode_mem, tout, m_y, &m_tInteg, CV_ONE_STEP);
+    CT_PERF_SCOPE("CVodesIntegrator::step");
+    int flag = stepForward(tout);
     if (flag != CV_SUCCESS) {
         string f_errs = m_func->getErrors();
         if (!f_errs.empty()) {
@@ -541,6 +588,15 @@ double CVodesIntegrator::step(double tout)
     return m_time;
 }
 
+int CVodesIntegrator::stepForward(double tout)
+{
+    if (m_adjoint) {
+        int nCheckpoints;
+        return CVodeF(m_cvode_mem, tout, m_y, &m_tInteg, CV_ONE_STEP, &nCheckpoints);
+    }
+    return CVode(m_cvode_mem, tout, m_y, &m_tInteg, CV_ONE_STEP);
+}
+
 double* CVodesIntegrator::derivative(double tout, int n)
 {
     int flag = CVodeGetDky(m_cvode_mem, tout, n, m_dky);
@@ -640,6 +696,140 @@ double CVodesIntegrator::sensitivity(size_t k, size_t p)
     return NV_Ith_S(m_yS[p],k);
 }
 
+void CVodesIntegrator::integrateAdjoint(const double* lambda, double* lambda0,
+                                        double* dgdp)
+{
+    CT_PERF_SCOPE("CVodesIntegrator::integrateAdjoint");
+    if (!m_adjoint) {
+        throw CanteraError("CVodesIntegrator::integrateAdjoint",
+            "Adjoint sensitivity analysis was not enabled before the integrator "
+            "was initialized.");
+    }
+    size_t np = m_func->nparams();
+    if (m_time == m_t0) {
+        // no forward steps have been taken
+        std::copy(lambda, lambda + m_neq, lambda0);
+        std::fill(dgdp, dgdp + np, 0.0);
+        return;
+    }
+    if (!m_yB) {
+        m_yB = newNVector(m_neq, m_sundials_ctx);
+    }
+    std::copy(lambda, lambda + m_neq, NV_DATA_S(m_yB));
+    if (np && !m_qB) {
+        m_qB = newNVector(np, m_sundials_ctx);
+    }
+    if (np) {
+        N_VConst(0.0, m_qB);
+    }
+    if (m_indexB < 0) {
+        adjointInit();
+    } else {
+        int flag = CVodeReInitB(m_cvode_mem, m_indexB, m_time, m_yB);
+        checkError(flag, "integrateAdjoint", "CVodeReInitB");
+        if (np) {
+            flag = CVodeQuadReInitB(m_cvode_mem, m_indexB, m_qB);
+            checkError(flag, "integrateAdjoint", "CVodeQuadReInitB");
+        }
+    }
+
+    int flag = CVodeB(m_cvode_mem, m_t0, CV_NORMAL);
+    if (flag != CV_SUCCESS) {
+        string f_errs = m_func->getErrors();
+        if (!f_errs.empty()) {
+            f_errs = "Exceptions caught during adjoint RHS evaluation:\n" + f_errs;
+        }
+        throw CanteraError("CVodesIntegrator::integrateAdjoint",
+            "CVodes error encountered. Error code: {}\n{}\n{}",
+            flag, m_error_message, f_errs);
+    }
+    double tret;
+    flag = CVodeGetB(m_cvode_mem, m_indexB, &tret, m_yB);
+    checkError(flag, "integrateAdjoint", "CVodeGetB");
+    std::copy(NV_DATA_S(m_yB), NV_DATA_S(m_yB) + m_neq, lambda0);
+    if (np) {
+        flag = CVodeGetQuadB(m_cvode_mem, m_indexB, &tret, m_qB);
+        checkError(flag, "integrateAdjoint", "CVodeGetQuadB");
+        std::copy(NV_DATA_S(m_qB), NV_DATA_S(m_qB) + np, dgdp);
+    }
+}
+
+void CVodesIntegrator::adjointInit()
+{
+    int flag = CVodeCreateB(m_cvode_mem, m_method, &m_indexB);
+    checkError(flag, "adjointInit", "CVodeCreateB");
+    flag = CVodeInitB(m_cvode_mem, m_indexB, cvodes_rhsB, m_time, m_yB);
+    checkError(flag, "adjointInit", "CVodeInitB");
+    flag = CVodeSStolerancesB(m_cvode_mem, m_indexB, m_reltolsens, m_abstolsens);
+    checkError(flag, "adjointInit", "CVodeSStolerancesB");
+    flag = CVodeSetUserDataB(m_cvode_mem, m_indexB, m_func);
+    checkError(flag, "adjointInit", "CVodeSetUserDataB");
+    if (m_maxsteps > 0) {
+        CVodeSetMaxNumStepsB(m_cvode_mem, m_indexB, m_maxsteps);
+    }
+
+    // The backward problem uses a dense linear solver, with the Jacobian of the
+    // adjoint equations provided by the FuncEval object.
+    sd_size_t N = static_cast<sd_size_t>(m_neq);
+    #if SUNDIALS_VERSION_MAJOR >= 6
+        m_linsol_matrixB = SUNDenseMatrix(N, N, m_sundials_ctx.get());
+        #if CT_SUNDIALS_USE_LAPACK
+            m_linsolB = SUNLinSol_LapackDense(m_yB, (SUNMatrix) m_linsol_matrixB,
+                                              m_sundials_ctx.get());
+        #else
+            m_linsolB = SUNLinSol_Dense(m_yB, (SUNMatrix) m_linsol_matrixB,
+                                        m_sundials_ctx.get());
+        #endif
+        flag = CVodeSetLinearSolverB(m_cvode_mem, m_indexB,
+                                     (SUNLinearSolver) m_linsolB,
+                                     (SUNMatrix) m_linsol_matrixB);
+    #else
+        m_linsol_matrixB = SUNDenseMatrix(N, N);
+        #if CT_SUNDIALS_USE_LAPACK
+            m_linsolB = SUNLapackDense(m_yB, (SUNMatrix) m_linsol_matrixB);
+        #else
+            m_linsolB = SUNDenseLinearSolver(m_yB, (SUNMatrix) m_linsol_matrixB);
+        #endif
+        flag = CVDlsSetLinearSolverB(m_cvode_mem, m_indexB,
+                                     (SUNLinearSolver) m_linsolB,
+                                     (SUNMatrix) m_linsol_matrixB);
+    #endif
+    if (m_linsolB == nullptr) {
+        throw CanteraError("CVodesIntegrator::adjointInit",
+            "Error creating Sundials dense linear solver object");
+    }
+    checkError(flag, "adjointInit", "CVodeSetLinearSolverB");
+    #if SUNDIALS_VERSION_MAJOR >= 6
+        flag = CVodeSetJacFnB(m_cvode_mem, m_indexB, cvodes_jacB);
+    #else
+        flag = CVDlsSetJacFnB(m_cvode_mem, m_indexB, cvodes_jacB);
+    #endif
+    checkError(flag, "adjointInit", "CVodeSetJacFnB");
+
+    if (m_func->nparams()) {
+        flag = CVodeQuadInitB(m_cvode_mem, m_indexB, cvodes_quadB, m_qB);
+        checkError(flag, "adjointInit", "CVodeQuadInitB");
+    }
+}
+
+void CVodesIntegrator::adjointFree()
+{
+    // Memory for the backward problem itself is owned by m_cvode_mem
+    m_indexB = -1;
+    SUNLinSolFree((SUNLinearSolver) m_linsolB);
+    SUNMatDestroy((SUNMatrix) m_linsol_matrixB);
+    m_linsolB = nullptr;
+    m_linsol_matrixB = nullptr;
+    if (m_yB) {
+        N_VDestroy_Serial(m_yB);
+        m_yB = nullptr;
+    }
+    if (m_qB) {
+        N_VDestroy_Serial(m_qB);
+        m_qB = nullptr;
+    }
+}
+
 string CVodesIntegrator::getErrorInfo(int N)
 {
     N_Vector errs = newNVector(m_neq, m_sundials_ctx);
@@ -5,12 +5,14 @@
 
 #include "cantera/numerics/EigenSparseDirectJacobian.h"
 #include "cantera/numerics/eigen_dense.h"
+#include "cantera/base/PerfCounters.h"
 
 namespace Cantera
 {
 
 void EigenSparseDirectJacobian::factorize()
 {
+    CT_PERF_SCOPE("EigenSparseDirectJacobian::factorize");
     m_matrix.makeCompressed();
     // analyze and factorize
     m_solver.compute(m_matrix);
@@ -23,6 +25,7 @@ void EigenSparseDirectJacobian::factorize()
 
 void EigenSparseDirectJacobian::solve(const size_t stateSize, double* b, double* x)
 {
+    CT_PERF_SCOPE("EigenSparseDirectJacobian::solve");
     MappedVector(x, m_dim) = m_solver.solve(MappedVector(b, m_dim));
     // check for errors
     if (m_solver.info() != Eigen::Success) {
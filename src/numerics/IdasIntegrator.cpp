@@ -7,6 +7,7 @@
 #include "cantera/base/stringUtils.h"
 
 #include "cantera/numerics/sundials_headers.h"
+#include "cantera/base/PerfCounters.h"
 
 using namespace std;
 
@@ -455,6 +456,7 @@ void IdasIntegrator::sensInit(double t0, FuncEval& func)
 
 void IdasIntegrator::integrate(double tout)
 {
+    CT_PERF_SCOPE("IdasIntegrator::integrate");
     if (tout == m_time) {
         return;
     } else if (tout < m_time) {
@@ -492,6 +494,7 @@ void IdasIntegrator::integrate(double tout)
 
 double IdasIntegrator::step(double tout)
 {
+    CT_PERF_SCOPE("IdasIntegrator::step");
     int flag = IDASolve(m_ida_mem, tout, &m_tInteg, m_y, m_ydot, IDA_ONE_STEP);
     if (flag != IDA_SUCCESS) {
         string f_errs = m_func->getErrors();
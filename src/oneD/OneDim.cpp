@@ -8,6 +8,7 @@
 #include "cantera/oneD/MultiNewton.h"
 #include "cantera/base/AnyMap.h"
 #include "cantera/numerics/SystemJacobianFactory.h"
+#include "cantera/base/PerfCounters.h"
 
 #include <fstream>
 #include <ctime>
@@ -229,6 +230,7 @@ void OneDim::resize()
 
 int OneDim::solve(double* x, double* xnew, int loglevel)
 {
+    CT_PERF_SCOPE("OneDim::solve");
     if (!m_jac_ok) {
         evalJacobian(x);
         m_jac->updateTransient(m_rdt, m_mask.data());
@@ -292,6 +294,7 @@ void OneDim::eval(size_t j, double* x, double* r, double rdt, int count)
 
 void OneDim::evalJacobian(double* x0)
 {
+    CT_PERF_SCOPE("OneDim::evalJacobian");
     m_jac->reset();
     clock_t t0 = clock();
     m_work1.resize(size());
@@ -14,6 +14,7 @@
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/SolutionArray.h"
 #include "cantera/numerics/Func1.h"
+#include "cantera/base/PerfCounters.h"
 #include <limits>
 #include <fstream>
 
@@ -400,6 +401,7 @@ int Sim1D::newtonSolve(int loglevel)
 
 void Sim1D::solve(int loglevel, bool refine_grid)
 {
+    CT_PERF_SCOPE("Sim1D::solve");
     int new_points = 1;
     double dt = m_tstep;
     m_nsteps = 0;
@@ -400,6 +400,59 @@ void CoverageDependentSurfPhase::getStandardChemPotentials(double* mu0) const
     }
 }
 
+void CoverageDependentSurfPhase::getStandardChemPotentials_ddCov(double* dmu0) const
+{
+    _updateCovDepThermo();
+    double tnow = temperature();
+    std::fill(dmu0, dmu0 + m_kk * m_kk, 0.0);
+
+    // For linear and polynomial model
+    for (auto& item : m_PolynomialDependency) {
+        double theta = m_cov[item.j];
+        double dh = 0.0;
+        double ds = 0.0;
+        double thetaPow = 1.0;
+        for (size_t i = 1; i < item.enthalpy_coeffs.size(); i++) {
+            dh += i * item.enthalpy_coeffs[i] * thetaPow;
+            if (i < item.entropy_coeffs.size()) {
+                ds += i * item.entropy_coeffs[i] * thetaPow;
+            }
+            thetaPow *= theta;
+        }
+        dmu0[item.k + m_kk * item.j] += dh - tnow * ds;
+    }
+
+    // For piecewise-linear and interpolative model; the slope of the current
+    // interval is used
+    for (auto& item : m_InterpolativeDependency) {
+        auto h_iter = item.enthalpy_map.upper_bound(m_cov[item.j]);
+        auto s_iter = item.entropy_map.upper_bound(m_cov[item.j]);
+        double highHcov = h_iter->first;
+        double highH = h_iter->second;
+        double lowHcov = (--h_iter)->first;
+        double lowH = h_iter->second;
+        double highScov = s_iter->first;
+        double highS = s_iter->second;
+        double lowScov = (--s_iter)->first;
+        double lowS = s_iter->second;
+        dmu0[item.k + m_kk * item.j] += (highH - lowH) / (highHcov - lowHcov)
+            - tnow * (highS - lowS) / (highScov - lowScov);
+    }
+
+    // For coverage-dependent heat capacity
+    for (auto& item : m_HeatCapacityDependency) {
+        double a = item.coeff_a;
+        double b = item.coeff_b;
+        double int_cp_tnow = tnow * (a * log(tnow) - a + b);
+        double int_cp_298 = 298.15 * (a * log(298.15) - a + b);
+        double int_cp_T_tnow = log(tnow) * (a * log(tnow) + 2 * b);
+        double int_cp_T_298 = log(298.15) * (a * log(298.15) + 2 * b);
+        double theta = m_cov[item.j];
+        dmu0[item.k + m_kk * item.j] += 2 * theta * (int_cp_tnow - int_cp_298)
+            - tnow * theta * (int_cp_T_tnow - int_cp_T_298);
+    }
+}
+
 void CoverageDependentSurfPhase::getPartialMolarEnthalpies(double* hbar) const
 {
     _updateTotalThermo();
@@ -352,6 +352,7 @@ void IdealMolalSoln::setStandardConcentrationModel(const string& model)
         throw CanteraError("IdealMolalSoln::setStandardConcentrationModel",
                            "Unknown standard concentration model '{}'", model);
     }
+    invalidateCache();
 }
 
 void IdealMolalSoln::setCutoffModel(const string& model)
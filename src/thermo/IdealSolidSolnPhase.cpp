@@ -414,6 +414,7 @@ void IdealSolidSolnPhase::setStandardConcentrationModel(const string& model)
         throw CanteraError("IdealSolidSolnPhase::setStandardConcentrationModel",
                            "Unknown standard concentration model '{}'", model);
     }
+    invalidateCache();
 }
 
 double IdealSolidSolnPhase::speciesMolarVolume(int k) const
@@ -37,6 +37,7 @@ void IdealSolnGasVPSS::setStandardConcentrationModel(const string& model)
         throw CanteraError("IdealSolnGasVPSS::setStandardConcentrationModel",
                            "Unknown standard concentration model '{}'", model);
     }
+    invalidateCache();
 }
 
 // ------------Molar Thermodynamic Properties -------------------------
@@ -264,6 +264,7 @@ void LatticePhase::setSiteDensity(double sitedens)
         }
         m_speciesMolarVolume[k] = 1.0 / m_site_density;
     }
+    invalidateCache();
 }
 
 void LatticePhase::_updateThermo() const
@@ -149,9 +149,9 @@ shared_ptr<ThermoPhase> newThermo(const string& infile, const string& id)
                            "The CTI and XML formats are no longer supported.");
     }
 
-    AnyMap root = AnyMap::fromYamlFile(infile);
-    AnyMap& phase = root["phases"].getMapWhere("name", id_);
-    return newThermo(phase, root);
+    auto root = AnyMap::sharedYamlFile(infile);
+    AnyMap phase = root->at("phases").getMapWhere("name", id_);
+    return newThermo(phase, *root);
 }
 
 void addDefaultElements(ThermoPhase& thermo, const vector<string>& element_names) {
@@ -166,7 +166,7 @@ void addElements(ThermoPhase& thermo, const vector<string>& element_names,
     const auto& local_elements = elements.asMap("symbol");
     for (const auto& symbol : element_names) {
         if (local_elements.count(symbol)) {
-            auto& element = *local_elements.at(symbol);
+            AnyMap element = *local_elements.at(symbol);
             double weight = element["atomic-weight"].asDouble();
             long int number = element.getInt("atomic-number", 0);
             double e298 = element.getDouble("entropy298", ENTROPY298_UNKNOWN);
@@ -182,22 +182,38 @@ void addElements(ThermoPhase& thermo, const vector<string>& element_names,
 
 void addSpecies(ThermoPhase& thermo, const AnyValue& names, const AnyValue& species)
 {
+    // Species objects are created concurrently from copies of their definitions,
+    // which may be part of a shared input file, and then added to the phase in order
+    auto addNodes = [&thermo](const vector<const AnyMap*>& nodes) {
+        vector<shared_ptr<Species>> created(nodes.size());
+        parallelFor(nodes.size(), [&](size_t i) {
+            created[i] = newSpecies(AnyMap(*nodes[i]));
+        }, 64);
+        for (auto& sp : created) {
+            thermo.addSpecies(sp);
+        }
+    };
+
     if (names.is<vector<string>>()) {
         // 'names' is a list of species names which should be found in 'species'
         const auto& species_nodes = species.asMap("name");
+        vector<const AnyMap*> nodes;
         for (const auto& name : names.asVector<string>()) {
             if (species_nodes.count(name)) {
-                thermo.addSpecies(newSpecies(*species_nodes.at(name)));
+                nodes.push_back(species_nodes.at(name));
             } else {
                 throw InputFileError("addSpecies", names, species,
                     "Could not find a species named '{}'.", name);
             }
         }
+        addNodes(nodes);
     } else if (names == "all") {
         // The keyword 'all' means to add all species from this source
+        vector<const AnyMap*> nodes;
         for (const auto& item : species.asVector<AnyMap>()) {
-            thermo.addSpecies(newSpecies(item));
+            nodes.push_back(&item);
         }
+        addNodes(nodes);
     } else {
         throw InputFileError("addSpecies", names,
             "Could not parse species declaration of type '{}'", names.type_str());
@@ -243,9 +259,9 @@ void setupPhase(ThermoPhase& thermo, const AnyMap& phaseNode, const AnyMap& root
                 if (slash) {
                     string fileName(source.begin(), slash.begin());
                     string node(slash.end(), source.end());
-                    const AnyMap elements = AnyMap::fromYamlFile(fileName,
+                    auto elements = AnyMap::sharedYamlFile(fileName,
                         rootNode.getString("__file__", ""));
-                    addElements(thermo, names, elements.at(node), false);
+                    addElements(thermo, names, elements->at(node), false);
                 } else if (rootNode.hasKey(source)) {
                     addElements(thermo, names, rootNode.at(source), false);
                 } else if (source == "default") {
@@ -288,9 +304,9 @@ void setupPhase(ThermoPhase& thermo, const AnyMap& phaseNode, const AnyMap& root
                     // source is a different input file
                     string fileName(source.begin(), slash.begin());
                     string node(slash.end(), source.end());
-                    AnyMap species = AnyMap::fromYamlFile(fileName,
+                    auto species = AnyMap::sharedYamlFile(fileName,
                         rootNode.getString("__file__", ""));
-                    addSpecies(thermo, names, species[node]);
+                    addSpecies(thermo, names, species->at(node));
                 } else if (rootNode.hasKey(source)) {
                     // source is in the current file
                     addSpecies(thermo, names, rootNode[source]);
@@ -25,6 +25,10 @@ using namespace std;
 namespace Cantera
 {
 
+ThermoPhase::ThermoPhase() = default;
+
+ThermoPhase::~ThermoPhase() = default;
+
 void ThermoPhase::resetHf298(size_t k) {
     if (k != npos) {
         m_spthermo.resetHf298(k);
@@ -1008,9 +1012,9 @@ void ThermoPhase::initThermoFile(const string& inputFile, const string& id)
                            "The CTI and XML formats are no longer supported.");
     }
 
-    AnyMap root = AnyMap::fromYamlFile(inputFile);
-    auto& phase = root["phases"].getMapWhere("name", id);
-    setupPhase(*this, phase, root);
+    auto root = AnyMap::sharedYamlFile(inputFile);
+    AnyMap phase = root->at("phases").getMapWhere("name", id);
+    setupPhase(*this, phase, *root);
 }
 
 void ThermoPhase::initThermo()
@@ -1173,7 +1177,11 @@ void ThermoPhase::equilibrate(const string& XY, const string& solver,
         saveState(initial_state);
         debuglog("Trying ChemEquil solver\n", log_level);
         try {
-            ChemEquil E;
+            if (!m_equil) {
+                m_equil = make_unique<ChemEquil>();
+                m_equil->options.contin = true;
+            }
+            ChemEquil& E = *m_equil;
             E.options.maxIterations = max_steps;
             E.options.relTolerance = rtol;
             int ret = E.equilibrate(*this, XY.c_str(), log_level-1);
@@ -1194,7 +1202,8 @@ void ThermoPhase::equilibrate(const string& XY, const string& solver,
         }
     }
 
-    if (solver == "auto" || solver == "vcs" || solver == "gibbs") {
+    if (solver == "auto" || solver == "vcs" || solver == "gibbs"
+        || solver == "interior_point") {
         MultiPhase M;
         M.addPhase(this, 1.0);
         M.init();
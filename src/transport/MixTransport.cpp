@@ -10,6 +10,7 @@
 #include "cantera/base/stringUtils.h"
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/base/utilities.h"
+#include "cantera/base/PerfCounters.h"
 
 namespace Cantera
 {
@@ -82,6 +83,7 @@ void MixTransport::getSpeciesFluxes(size_t ndim, const double* const grad_T,
 
 void MixTransport::update_T()
 {
+    CT_PERF_SCOPE("MixTransport::update_T");
     double t = m_thermo->temperature();
     if (t == m_temp && m_nsp == m_thermo->nSpecies()) {
         return;
@@ -95,6 +97,7 @@ void MixTransport::update_T()
 
 void MixTransport::update_C()
 {
+    CT_PERF_SCOPE("MixTransport::update_C");
     // signal that concentration-dependent quantities will need to be recomputed
     // before use, and update the local mole fractions.
     m_visc_ok = false;
@@ -10,6 +10,7 @@
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/utilities.h"
+#include "cantera/base/PerfCounters.h"
 
 using namespace std;
 
@@ -392,6 +393,7 @@ void MultiTransport::getMultiDiffCoeffs(const size_t ld, double* const d)
 
 void MultiTransport::update_T()
 {
+    CT_PERF_SCOPE("MultiTransport::update_T");
     if (m_temp == m_thermo->temperature() && m_nsp == m_thermo->nSpecies()) {
         return;
     }
@@ -404,6 +406,7 @@ void MultiTransport::update_T()
 
 void MultiTransport::update_C()
 {
+    CT_PERF_SCOPE("MultiTransport::update_C");
     // Update the local mole fraction array
     m_thermo->getMoleFractions(m_molefracs.data());
 
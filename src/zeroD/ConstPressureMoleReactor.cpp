@@ -107,6 +107,15 @@ void ConstPressureMoleReactor::eval(double time, double* LHS, double* RHS)
     }
 }
 
+void ConstPressureMoleReactor::getProductionRateAdjoint(const double* lambda,
+                                                        double* out)
+{
+    // species equations: dn_k/dt = V wdot_k + ...
+    for (size_t k = 0; k < m_nsp; k++) {
+        out[k] = lambda[k + m_sidx] * m_vol;
+    }
+}
+
 size_t ConstPressureMoleReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
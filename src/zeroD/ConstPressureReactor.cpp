@@ -118,6 +118,16 @@ void ConstPressureReactor::eval(double time, double* LHS, double* RHS)
     }
 }
 
+void ConstPressureReactor::getProductionRateAdjoint(const double* lambda,
+                                                    double* out)
+{
+    // species equations: m dY_k/dt = V W_k wdot_k + ...
+    const vector<double>& mw = m_thermo->molecularWeights();
+    for (size_t k = 0; k < m_nsp; k++) {
+        out[k] = lambda[k + 2] * m_vol * mw[k] / m_mass;
+    }
+}
+
 size_t ConstPressureReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
@@ -119,6 +119,20 @@ void IdealGasConstPressureMoleReactor::eval(double time, double* LHS, double* RH
     }
 }
 
+void IdealGasConstPressureMoleReactor::getProductionRateAdjoint(
+    const double* lambda, double* out)
+{
+    ConstPressureMoleReactor::getProductionRateAdjoint(lambda, out);
+    if (m_energy) {
+        // energy equation: m c_p dT/dt = - V sum(h_k wdot_k) + ...
+        m_thermo->getPartialMolarEnthalpies(&m_hk[0]);
+        double mcp = m_mass * m_thermo->cp_mass();
+        for (size_t k = 0; k < m_nsp; k++) {
+            out[k] -= lambda[0] * m_hk[k] * m_vol / mcp;
+        }
+    }
+}
+
 Eigen::SparseMatrix<double> IdealGasConstPressureMoleReactor::jacobian()
 {
     if (m_nv == 0) {
@@ -129,7 +143,8 @@ Eigen::SparseMatrix<double> IdealGasConstPressureMoleReactor::jacobian()
     m_jac_trips.clear();
     // dnk_dnj represents d(dot(n_k)) / d (n_j) but is first assigned as
     // d (dot(omega)) / d c_j, it is later transformed appropriately.
-    Eigen::SparseMatrix<double> dnk_dnj = m_kin->netProductionRates_ddCi();
+    m_kin->getNetProductionRates_ddCi(m_dnk_dnj);
+    Eigen::SparseMatrix<double>& dnk_dnj = m_dnk_dnj;
     // species size that accounts for surface species
     size_t ssize = m_nv - m_sidx;
     // map derivatives from the surface chemistry jacobian
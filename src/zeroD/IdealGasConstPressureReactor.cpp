@@ -130,6 +130,20 @@ void IdealGasConstPressureReactor::eval(double time, double* LHS, double* RHS)
     }
 }
 
+void IdealGasConstPressureReactor::getProductionRateAdjoint(const double* lambda,
+                                                            double* out)
+{
+    ConstPressureReactor::getProductionRateAdjoint(lambda, out);
+    if (m_energy) {
+        // energy equation: m c_p dT/dt = - V sum(h_k wdot_k) + ...
+        m_thermo->getPartialMolarEnthalpies(&m_hk[0]);
+        double mcp = m_mass * m_thermo->cp_mass();
+        for (size_t k = 0; k < m_nsp; k++) {
+            out[k] -= lambda[1] * m_hk[k] * m_vol / mcp;
+        }
+    }
+}
+
 size_t IdealGasConstPressureReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
@@ -9,6 +9,7 @@
 #include "cantera/zeroD/ReactorNet.h"
 #include "cantera/zeroD/ReactorSurface.h"
 #include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/Reaction.h"
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/thermo/SurfPhase.h"
 #include "cantera/base/utilities.h"
@@ -153,6 +154,20 @@ void IdealGasMoleReactor::eval(double time, double* LHS, double* RHS)
     }
 }
 
+void IdealGasMoleReactor::getProductionRateAdjoint(const double* lambda,
+                                                   double* out)
+{
+    MoleReactor::getProductionRateAdjoint(lambda, out);
+    if (m_energy) {
+        // energy equation: m c_v dT/dt = - V sum(u_k wdot_k) + ...
+        m_thermo->getPartialMolarIntEnergies(&m_uk[0]);
+        double mcv = m_mass * m_thermo->cv_mass();
+        for (size_t k = 0; k < m_nsp; k++) {
+            out[k] -= lambda[0] * m_uk[k] * m_vol / mcv;
+        }
+    }
+}
+
 Eigen::SparseMatrix<double> IdealGasMoleReactor::jacobian()
 {
     if (m_nv == 0) {
@@ -163,7 +178,8 @@ Eigen::SparseMatrix<double> IdealGasMoleReactor::jacobian()
     m_jac_trips.clear();
     // dnk_dnj represents d(dot(n_k)) / d (n_j) but is first assigned as
     // d (dot(omega)) / d c_j, it is later transformed appropriately.
-    Eigen::SparseMatrix<double> dnk_dnj = m_kin->netProductionRates_ddCi();
+    m_kin->getNetProductionRates_ddCi(m_dnk_dnj);
+    Eigen::SparseMatrix<double>& dnk_dnj = m_dnk_dnj;
     // species size that accounts for surface species
     size_t ssize = m_nv - m_sidx;
     // map derivatives from the surface chemistry jacobian
@@ -252,4 +268,38 @@ Eigen::SparseMatrix<double> IdealGasMoleReactor::jacobian()
     return jac;
 }
 
+bool IdealGasMoleReactor::jacobianIsExact() const
+{
+    if (!m_wall.empty() || !m_inlet.empty() || !m_outlet.empty()
+        || !m_surfaces.empty())
+    {
+        return false;
+    }
+    if (!m_chem || !m_kin) {
+        // jacobian() includes the kinetics terms regardless of the chemistry flag
+        return false;
+    }
+    AnyMap settings;
+    try {
+        m_kin->getDerivativeSettings(settings);
+    } catch (NotImplementedError&) {
+        return false;
+    }
+    if (settings.getBool("skip-third-bodies", false)
+        || settings.getBool("skip-falloff", false))
+    {
+        return false;
+    }
+    // Composition derivatives are taken at constant pressure, which neglects the
+    // dependence of pressure-dependent rates on the total concentration
+    static const set<string> exactRates = {
+        "Arrhenius", "Blowers-Masel", "falloff", "chemically-activated"};
+    for (size_t i = 0; i < m_kin->nReactions(); i++) {
+        if (!exactRates.count(m_kin->reaction(i)->rate()->type())) {
+            return false;
+        }
+    }
+    return true;
+}
+
 }
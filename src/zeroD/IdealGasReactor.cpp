@@ -135,6 +135,19 @@ void IdealGasReactor::eval(double time, double* LHS, double* RHS)
     }
 }
 
+void IdealGasReactor::getProductionRateAdjoint(const double* lambda, double* out)
+{
+    Reactor::getProductionRateAdjoint(lambda, out);
+    if (m_energy) {
+        // energy equation: m c_v dT/dt = - V sum(u_k wdot_k) + ...
+        m_thermo->getPartialMolarIntEnergies(&m_uk[0]);
+        double mcv = m_mass * m_thermo->cv_mass();
+        for (size_t k = 0; k < m_nsp; k++) {
+            out[k] -= lambda[2] * m_uk[k] * m_vol / mcv;
+        }
+    }
+}
+
 size_t IdealGasReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
@@ -280,6 +280,14 @@ void MoleReactor::eval(double time, double* LHS, double* RHS)
     }
 }
 
+void MoleReactor::getProductionRateAdjoint(const double* lambda, double* out)
+{
+    // species equations: dn_k/dt = V wdot_k + ...
+    for (size_t k = 0; k < m_nsp; k++) {
+        out[k] = lambda[k + m_sidx] * m_vol;
+    }
+}
+
 
 size_t MoleReactor::componentIndex(const string& nm) const
 {
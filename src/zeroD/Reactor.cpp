@@ -279,6 +279,48 @@ void Reactor::eval(double time, double* LHS, double* RHS)
     }
 }
 
+void Reactor::getProductionRateAdjoint(const double* lambda, double* out)
+{
+    // species equations: m dY_k/dt = V W_k wdot_k + ...
+    const vector<double>& mw = m_thermo->molecularWeights();
+    for (size_t k = 0; k < m_nsp; k++) {
+        out[k] = lambda[k + 3] * m_vol * mw[k] / m_mass;
+    }
+}
+
+void Reactor::addAdjointSensitivities(const double* lambda, double* dgdp)
+{
+    for (auto& S : m_surfaces) {
+        if (S->nSensParams()) {
+            throw NotImplementedError("Reactor::addAdjointSensitivities",
+                "Adjoint sensitivities with respect to surface reactions.");
+        }
+    }
+    for (auto& p : m_sensParams) {
+        if (p.type != SensParameterType::reaction) {
+            throw NotImplementedError("Reactor::addAdjointSensitivities",
+                "Adjoint sensitivities with respect to species enthalpies.");
+        }
+    }
+    if (m_sensParams.empty() || !m_chem) {
+        return;
+    }
+    m_thermo->restoreState(m_state);
+    vector<double> u(m_kin->nTotalSpecies(), 0.0);
+    getProductionRateAdjoint(lambda, u.data());
+    vector<double> rop(m_kin->nReactions());
+    m_kin->getNetRatesOfProgress(rop.data());
+
+    // Rates of progress are proportional to the multipliers, which are scaled by
+    // the (nominal) parameter values
+    Eigen::SparseMatrix<double> nu = m_kin->productStoichCoeffs()
+                                     - m_kin->reactantStoichCoeffs();
+    Eigen::VectorXd v = nu.transpose() * Eigen::Map<Eigen::VectorXd>(u.data(), u.size());
+    for (auto& p : m_sensParams) {
+        dgdp[p.global] += v[p.local] * rop[p.local];
+    }
+}
+
 void Reactor::evalWalls(double t)
 {
     // time is currently unused
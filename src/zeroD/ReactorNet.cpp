@@ -11,6 +11,7 @@
 #include "cantera/base/Array.h"
 #include "cantera/numerics/Integrator.h"
 #include "cantera/zeroD/FlowReactor.h"
+#include "cantera/base/PerfCounters.h"
 
 #include <cstdio>
 
@@ -66,6 +67,20 @@ void ReactorNet::setSensitivityTolerances(double rtol, double atol)
     m_init = false;
 }
 
+void ReactorNet::setSensitivityMethod(const string& method)
+{
+    if (method != "forward" && method != "adjoint") {
+        throw CanteraError("ReactorNet::setSensitivityMethod",
+            "Unknown sensitivity method '{}'. Options are 'forward' and 'adjoint'.",
+            method);
+    }
+    if (method == "forward" && m_sensitivityMethod == "adjoint" && m_integ) {
+        m_integ->setAdjointCheckpointSteps(0);
+    }
+    m_sensitivityMethod = method;
+    m_init = false;
+}
+
 double ReactorNet::time() {
     if (m_timeIsIndependent) {
         return m_time;
@@ -123,6 +138,10 @@ void ReactorNet::initialize()
     if (m_precon) {
         m_integ->setPreconditioner(m_precon);
     }
+    if (m_sensitivityMethod == "adjoint") {
+        m_integ->setAdjointCheckpointSteps(m_adjointCheckpointSteps);
+    }
+    m_adjointTime = NAN;
     m_integ->initialize(m_time, *this);
     if (m_verbose) {
         writelog("Number of equations: {:d}\n", neq());
@@ -132,6 +151,7 @@ void ReactorNet::initialize()
         checkPreconditionerSupported();
     }
     m_integrator_init = true;
+    m_adjointReinit = false;
     m_init = true;
 }
 
@@ -140,6 +160,7 @@ void ReactorNet::reinitialize()
     if (m_init) {
         debuglog("Re-initializing reactor network.\n", m_verbose);
         m_integ->reinitialize(m_time, *this);
+        m_adjointReinit = false;
         if (m_integ->preconditionerSide() != PreconditionerSide::NO_PRECONDITION) {
             checkPreconditionerSupported();
         }
@@ -173,9 +194,10 @@ int ReactorNet::maxSteps()
 
 void ReactorNet::advance(double time)
 {
+    CT_PERF_SCOPE("ReactorNet::advance");
     if (!m_init) {
         initialize();
-    } else if (!m_integrator_init) {
+    } else if (!m_integrator_init || m_adjointReinit) {
         reinitialize();
     }
     m_integ->integrate(time);
@@ -187,7 +209,7 @@ double ReactorNet::advance(double time, bool applylimit)
 {
     if (!m_init) {
         initialize();
-    } else if (!m_integrator_init) {
+    } else if (!m_integrator_init || m_adjointReinit) {
         reinitialize();
     }
 
@@ -240,9 +262,10 @@ double ReactorNet::advance(double time, bool applylimit)
 
 double ReactorNet::step()
 {
+    CT_PERF_SCOPE("ReactorNet::step");
     if (!m_init) {
         initialize();
-    } else if (!m_integrator_init) {
+    } else if (!m_integrator_init || m_adjointReinit) {
         reinitialize();
     }
     m_time = m_integ->step(m_time + 1.0);
@@ -356,6 +379,7 @@ Integrator& ReactorNet::integrator() {
 
 void ReactorNet::eval(double t, double* y, double* ydot, double* p)
 {
+    CT_PERF_SCOPE("ReactorNet::eval");
     m_time = t;
     updateState(y);
     m_LHS.assign(m_nv, 1);
@@ -379,6 +403,7 @@ void ReactorNet::eval(double t, double* y, double* ydot, double* p)
 
 void ReactorNet::evalDae(double t, double* y, double* ydot, double* p, double* residual)
 {
+    CT_PERF_SCOPE("ReactorNet::evalDae");
     m_time = t;
     updateState(y);
     for (size_t n = 0; n < m_reactors.size(); n++) {
@@ -398,6 +423,11 @@ void ReactorNet::getConstraints(double* constraints)
 
 double ReactorNet::sensitivity(size_t k, size_t p)
 {
+    if (m_sensitivityMethod == "adjoint") {
+        throw CanteraError("ReactorNet::sensitivity",
+            "Forward sensitivities are not computed when the sensitivity method is "
+            "'adjoint'. Use 'adjointSensitivities' instead.");
+    }
     if (!m_init) {
         initialize();
     }
@@ -412,8 +442,127 @@ double ReactorNet::sensitivity(size_t k, size_t p)
     return m_integ->sensitivity(k, p) / denom;
 }
 
+vector<double> ReactorNet::adjointSensitivities(const vector<double>& dgdy)
+{
+    if (m_sensitivityMethod != "adjoint") {
+        throw CanteraError("ReactorNet::adjointSensitivities",
+            "Sensitivity method must be set to 'adjoint' before integrating.");
+    }
+    if (!m_init) {
+        initialize();
+    } else if (!m_integrator_init) {
+        reinitialize();
+    }
+    if (dgdy.size() != m_nv) {
+        throw CanteraError("ReactorNet::adjointSensitivities",
+            "Length of 'dgdy' ({}) does not match the number of state variables ({}).",
+            dgdy.size(), m_nv);
+    }
+    vector<double> lambda0(m_nv);
+    vector<double> dgdp(nparams(), 0.0);
+    m_adjointState.resize(m_nv);
+    m_adjointYdot.resize(m_nv);
+    m_adjointExactJac = std::all_of(m_reactors.begin(), m_reactors.end(),
+        [](Reactor* r) { return r->jacobianIsExact(); });
+    if (!m_adjointExactJac) {
+        if (!m_adjointFDJac) {
+            m_adjointFDJac = make_unique<Array2D>();
+        }
+        m_adjointFDJac->resize(m_nv, m_nv);
+    }
+    m_adjointJac.resize(m_nv, m_nv);
+    m_adjointTime = NAN;
+
+    double tf = m_time;
+    m_integ->integrateAdjoint(dgdy.data(), lambda0.data(), dgdp.data());
+
+    // The backward integration evaluates the reactors at earlier states, so restore
+    // the state at the end of the forward integration
+    m_time = tf;
+    updateState(m_integ->solution());
+    m_adjointTime = NAN;
+    // The checkpoints are kept for evaluating other objectives, but the forward
+    // problem has to be restarted before integration continues
+    m_adjointReinit = true;
+    return dgdp;
+}
+
+void ReactorNet::evalAdjoint(double t, double* y, double* lambda, double* lambdaDot)
+{
+    CT_PERF_SCOPE("ReactorNet::evalAdjoint");
+    updateAdjointJacobian(t, y);
+    Eigen::Map<Eigen::VectorXd> lam(lambda, m_nv);
+    Eigen::Map<Eigen::VectorXd> lamDot(lambdaDot, m_nv);
+    lamDot.noalias() = -(m_adjointJac.transpose() * lam);
+}
+
+void ReactorNet::evalAdjointQuadrature(double t, double* y, double* lambda,
+                                       double* qDot)
+{
+    CT_PERF_SCOPE("ReactorNet::evalAdjointQuadrature");
+    m_time = t;
+    updateState(y);
+    std::fill(qDot, qDot + nparams(), 0.0);
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        m_reactors[n]->addAdjointSensitivities(lambda + m_start[n], qDot);
+    }
+    for (size_t p = 0; p < nparams(); p++) {
+        qDot[p] = -qDot[p];
+    }
+}
+
+void ReactorNet::evalAdjointJacobian(double t, double* y, double* jacB)
+{
+    CT_PERF_SCOPE("ReactorNet::evalAdjointJacobian");
+    updateAdjointJacobian(t, y);
+    for (int k = 0; k < m_adjointJac.outerSize(); k++) {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(m_adjointJac, k); it; ++it) {
+            // element (col, row) of the column-major matrix -J^T
+            jacB[it.col() + it.row() * m_nv] = -it.value();
+        }
+    }
+}
+
+void ReactorNet::updateAdjointJacobian(double t, double* y)
+{
+    if (t == m_adjointTime && std::equal(y, y + m_nv, m_adjointState.begin())) {
+        return;
+    }
+    std::copy(y, y + m_nv, m_adjointState.begin());
+    m_adjointTime = t;
+    vector<Eigen::Triplet<double>> trips;
+    if (m_adjointExactJac) {
+        m_time = t;
+        updateState(m_adjointState.data());
+        for (size_t i = 0; i < m_reactors.size(); i++) {
+            Eigen::SparseMatrix<double> rJac = m_reactors[i]->jacobian();
+            for (int k = 0; k < rJac.outerSize(); k++) {
+                for (Eigen::SparseMatrix<double>::InnerIterator it(rJac, k); it; ++it) {
+                    trips.emplace_back(static_cast<int>(it.row() + m_start[i]),
+                                       static_cast<int>(it.col() + m_start[i]),
+                                       it.value());
+                }
+            }
+        }
+    } else {
+        evalJacobian(t, m_adjointState.data(), m_adjointYdot.data(),
+                     m_sens_params.data(), m_adjointFDJac.get());
+        const Array2D& J = *m_adjointFDJac;
+        for (size_t j = 0; j < m_nv; j++) {
+            for (size_t i = 0; i < m_nv; i++) {
+                if (J(i, j) != 0.0) {
+                    trips.emplace_back(static_cast<int>(i), static_cast<int>(j),
+                                       J(i, j));
+                }
+            }
+        }
+    }
+    m_adjointJac.setFromTriplets(trips.begin(), trips.end());
+}
+
 void ReactorNet::evalJacobian(double t, double* y, double* ydot, double* p, Array2D* j)
 {
+    CT_PERF_SCOPE("ReactorNet::evalJacobian");
     //evaluate the unperturbed ydot
     eval(t, y, ydot, p);
     for (size_t n = 0; n < m_nv; n++) {
@@ -566,6 +715,7 @@ void ReactorNet::preconditionerSolve(double* rhs, double* output)
 
 void ReactorNet::preconditionerSetup(double t, double* y, double gamma)
 {
+    CT_PERF_SCOPE("ReactorNet::preconditionerSetup");
     // ensure state is up to date.
     updateState(y);
     // get the preconditioner
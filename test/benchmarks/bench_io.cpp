@@ -0,0 +1,79 @@
+//! @file bench_io.cpp
+//!    Benchmarks for saving and restoring SolutionArray data.
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "benchmark.h"
+#include "cantera/core.h"
+#include "cantera/base/SolutionArray.h"
+#include <cstdio>
+
+using namespace Cantera;
+
+namespace {
+
+//! Create a SolutionArray with `size` entries spanning a range of temperatures
+shared_ptr<SolutionArray> makeArray(shared_ptr<Solution> sol, int size)
+{
+    auto arr = SolutionArray::create(sol, size);
+    auto& thermo = *sol->thermo();
+    vector<double> X(thermo.nSpecies(), 1.0);
+    for (int i = 0; i < size; i++) {
+        thermo.setState_TPX(300.0 + 2000.0 * i / size, OneAtm, X.data());
+        arr->updateState(i);
+    }
+    return arr;
+}
+
+//! Time saving a SolutionArray to a file with the given extension, and if
+//! `restore` is `true`, time restoring it instead.
+void solutionArrayIO(BenchmarkState& state, const string& mech, int size,
+                     const string& extension, bool restore)
+{
+    auto sol = benchmarkSolution(state, mech);
+    if (!sol) {
+        return;
+    }
+    if (extension == "h5" && !usesHDF5()) {
+        state.skip("Cantera was compiled without HDF5 support");
+        return;
+    }
+    auto arr = makeArray(sol, size);
+    string fname = fmt::format("benchmark-{}-{}.{}", mech, size, extension);
+    std::remove(fname.c_str());
+    string name = (extension == "csv") ? "" : "data";
+    arr->save(fname, name, "", "", true);
+    for (auto _ : state) {
+        if (restore) {
+            auto restored = SolutionArray::create(sol);
+            restored->restore(fname, name);
+        } else {
+            arr->save(fname, name, "", "", true);
+        }
+    }
+    std::remove(fname.c_str());
+    state.setCounter("entries", size);
+}
+
+bool registerIO()
+{
+    for (string ext : {"yaml", "csv", "h5"}) {
+        for (int size : {100, 10000}) {
+            string suffix = fmt::format("{}/{}", ext, size);
+            registerBenchmark("io/gri30/save/" + suffix,
+                [ext, size](BenchmarkState& state) {
+                    solutionArrayIO(state, "gri30", size, ext, false);
+                });
+            registerBenchmark("io/gri30/restore/" + suffix,
+                [ext, size](BenchmarkState& state) {
+                    solutionArrayIO(state, "gri30", size, ext, true);
+                });
+        }
+    }
+    return true;
+}
+
+bool registered = registerIO();
+
+}
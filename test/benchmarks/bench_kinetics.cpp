@@ -0,0 +1,129 @@
+//! @file bench_kinetics.cpp
+//!    Benchmarks for reaction rates of progress and their derivatives.
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "benchmark.h"
+#include "cantera/core.h"
+#include "cantera/numerics/eigen_sparse.h"
+
+using namespace Cantera;
+
+namespace {
+
+//! Set a reacting state where all species are present, so that every reaction
+//! contributes to the evaluated rates.
+void setReactingState(ThermoPhase& thermo)
+{
+    vector<double> X(thermo.nSpecies(), 1.0);
+    thermo.setState_TPX(1500.0, OneAtm, X.data());
+}
+
+//! Time evaluations of a kinetics method writing to an array of length `size`,
+//! perturbing the temperature between calls to avoid cached results.
+void timeArrayGetter(BenchmarkState& state, const string& mech,
+                     void (Kinetics::*getter)(double*), bool perReaction)
+{
+    auto sol = benchmarkSolution(state, mech);
+    if (!sol) {
+        return;
+    }
+    auto& thermo = *sol->thermo();
+    auto& kin = *sol->kinetics();
+    setReactingState(thermo);
+    vector<double> out(perReaction ? kin.nReactions() : kin.nTotalSpecies());
+    double T = thermo.temperature();
+    double P = thermo.pressure();
+    size_t i = 0;
+    for (auto _ : state) {
+        thermo.setState_TP(T + 1e-5 * (i++ % 2), P);
+        (kin.*getter)(out.data());
+    }
+    state.setCounter("reactions", kin.nReactions());
+}
+
+//! Time evaluations of a kinetics method returning a sparse matrix
+void timeSparseGetter(BenchmarkState& state, const string& mech,
+                      Eigen::SparseMatrix<double> (Kinetics::*getter)())
+{
+    auto sol = benchmarkSolution(state, mech);
+    if (!sol) {
+        return;
+    }
+    auto& thermo = *sol->thermo();
+    auto& kin = *sol->kinetics();
+    setReactingState(thermo);
+    double T = thermo.temperature();
+    double P = thermo.pressure();
+    size_t i = 0;
+    size_t nonzeros = 0;
+    for (auto _ : state) {
+        thermo.setState_TP(T + 1e-5 * (i++ % 2), P);
+        nonzeros = (kin.*getter)().nonZeros();
+    }
+    state.setCounter("nonzeros", nonzeros);
+}
+
+//! Time evaluations of a kinetics method updating a sparse matrix in place
+void timeSparseInPlace(BenchmarkState& state, const string& mech,
+                       void (Kinetics::*getter)(Eigen::SparseMatrix<double>&))
+{
+    auto sol = benchmarkSolution(state, mech);
+    if (!sol) {
+        return;
+    }
+    auto& thermo = *sol->thermo();
+    auto& kin = *sol->kinetics();
+    setReactingState(thermo);
+    double T = thermo.temperature();
+    double P = thermo.pressure();
+    size_t i = 0;
+    Eigen::SparseMatrix<double> jac;
+    for (auto _ : state) {
+        thermo.setState_TP(T + 1e-5 * (i++ % 2), P);
+        (kin.*getter)(jac);
+    }
+    state.setCounter("nonzeros", jac.nonZeros());
+}
+
+bool registerKinetics()
+{
+    for (const auto& mech : benchmarkMechanisms()) {
+        string prefix = "kinetics/" + mech + "/";
+        registerBenchmark(prefix + "getNetRatesOfProgress",
+            [mech](BenchmarkState& state) {
+                timeArrayGetter(state, mech, &Kinetics::getNetRatesOfProgress, true);
+            });
+        registerBenchmark(prefix + "getNetProductionRates",
+            [mech](BenchmarkState& state) {
+                timeArrayGetter(state, mech, &Kinetics::getNetProductionRates, false);
+            });
+        registerBenchmark(prefix + "getNetRatesOfProgress_ddT",
+            [mech](BenchmarkState& state) {
+                timeArrayGetter(state, mech, &Kinetics::getNetRatesOfProgress_ddT,
+                                true);
+            });
+        registerBenchmark(prefix + "netRatesOfProgress_ddX",
+            [mech](BenchmarkState& state) {
+                timeSparseGetter(state, mech, &Kinetics::netRatesOfProgress_ddX);
+            });
+        registerBenchmark(prefix + "netProductionRates_ddX",
+            [mech](BenchmarkState& state) {
+                timeSparseGetter(state, mech, &Kinetics::netProductionRates_ddX);
+            });
+        registerBenchmark(prefix + "getNetRatesOfProgress_ddX",
+            [mech](BenchmarkState& state) {
+                timeSparseInPlace(state, mech, &Kinetics::getNetRatesOfProgress_ddX);
+            });
+        registerBenchmark(prefix + "getNetProductionRates_ddX",
+            [mech](BenchmarkState& state) {
+                timeSparseInPlace(state, mech, &Kinetics::getNetProductionRates_ddX);
+            });
+    }
+    return true;
+}
+
+bool registered = registerKinetics();
+
+}
@@ -0,0 +1,128 @@
+//! @file bench_reactor.cpp
+//!    Benchmarks for reactor network integration and 1D flame solutions.
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "benchmark.h"
+#include "cantera/core.h"
+#include "cantera/zerodim.h"
+#include "cantera/onedim.h"
+#include "cantera/oneD/DomainFactory.h"
+#include "cantera/numerics/SystemJacobianFactory.h"
+
+using namespace Cantera;
+
+namespace {
+
+//! Time the integration of a constant pressure reactor through ignition.
+//! @param solver  Either "DENSE", or "GMRES" followed by the type of the
+//!     preconditioner, for example "GMRES/Adaptive".
+void ignition(BenchmarkState& state, const string& mech, const string& fuel,
+              const string& solver)
+{
+    auto sol = benchmarkSolution(state, mech);
+    if (!sol) {
+        return;
+    }
+    auto& thermo = *sol->thermo();
+    size_t nSteps = 0;
+    for (auto _ : state) {
+        state.pauseTiming();
+        thermo.setEquivalenceRatio(1.0, fuel, "O2:1.0, N2:3.76");
+        thermo.setState_TP(1200.0, OneAtm);
+        IdealGasConstPressureMoleReactor reactor(sol);
+        ReactorNet net;
+        net.addReactor(reactor);
+        if (solver != "DENSE") {
+            net.setLinearSolverType("GMRES");
+            net.setPreconditioner(newSystemJacobian(solver.substr(6)));
+        }
+        state.resumeTiming();
+
+        net.advance(0.1);
+        nSteps = net.solverStats()["steps"].asInt();
+    }
+    state.setCounter("steps", nSteps);
+}
+
+//! Time the solution of a freely propagating, premixed hydrogen flame, starting
+//! from a coarse initial guess
+void freeFlame(BenchmarkState& state, const string& transport)
+{
+    auto sol = benchmarkSolution(state, "h2o2", transport);
+    auto gas = sol->thermo();
+    size_t nsp = gas->nSpecies();
+    double uin = 0.3;
+    double T = 300.0;
+    string X = "H2:0.65, O2:0.5, AR:2";
+    size_t nPoints = 0;
+    for (auto _ : state) {
+        state.pauseTiming();
+        gas->setState_TPX(T, OneAtm, X);
+        double rho_in = gas->density();
+        vector<double> yin(nsp);
+        gas->getMassFractions(yin.data());
+        gas->equilibrate("HP");
+        vector<double> yout(nsp);
+        gas->getMassFractions(yout.data());
+        double rho_out = gas->density();
+        double Tad = gas->temperature();
+
+        auto flow = newDomain<Flow1D>("free-flow", sol, "flow");
+        vector<double> z(11);
+        for (size_t iz = 0; iz < z.size(); iz++) {
+            z[iz] = 0.02 * iz / (z.size() - 1);
+        }
+        flow->setupGrid(z.size(), z.data());
+        auto inlet = newDomain<Inlet1D>("inlet", sol);
+        inlet->setMoleFractions(X);
+        inlet->setMdot(uin * rho_in);
+        inlet->setTemperature(T);
+        auto outlet = newDomain<Outlet1D>("outlet", sol);
+        vector<shared_ptr<Domain1D>> domains{inlet, flow, outlet};
+        Sim1D flame(domains);
+
+        vector<double> locs{0.0, 0.3, 0.7, 1.0};
+        double uout = inlet->mdot() / rho_out;
+        vector<double> value{uin, uin, uout, uout};
+        flame.setInitialGuess("velocity", locs, value);
+        value = {T, T, Tad, Tad};
+        flame.setInitialGuess("T", locs, value);
+        for (size_t k = 0; k < nsp; k++) {
+            value = {yin[k], yin[k], yout[k], yout[k]};
+            flame.setInitialGuess(gas->speciesName(k), locs, value);
+        }
+        flame.setRefineCriteria(1, 10.0, 0.2, 0.3);
+        flame.setFixedTemperature(0.85 * T + 0.15 * Tad);
+        flow->solveEnergyEqn();
+        state.resumeTiming();
+
+        flame.solve(0, true);
+        nPoints = flow->nPoints();
+    }
+    state.setCounter("points", nPoints);
+}
+
+bool registerReactor()
+{
+    for (string solver : {"DENSE", "GMRES/Adaptive", "GMRES/eigen-sparse-direct"}) {
+        registerBenchmark("reactor/h2o2/ignition/" + solver,
+            [solver](BenchmarkState& state) {
+                ignition(state, "h2o2", "H2", solver);
+            });
+        registerBenchmark("reactor/gri30/ignition/" + solver,
+            [solver](BenchmarkState& state) {
+                ignition(state, "gri30", "CH4", solver);
+            });
+    }
+    for (string transport : {"mixture-averaged", "multicomponent"}) {
+        registerBenchmark("flame/h2o2/free-flame/" + transport,
+            [transport](BenchmarkState& state) { freeFlame(state, transport); });
+    }
+    return true;
+}
+
+bool registered = registerReactor();
+
+}
@@ -0,0 +1,70 @@
+//! @file bench_thermo.cpp
+//!    Benchmarks for species thermodynamic properties and loading input files.
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "benchmark.h"
+#include "cantera/core.h"
+
+using namespace Cantera;
+
+namespace {
+
+//! Time evaluation of the standard state properties of all species for a sequence
+//! of temperatures
+void speciesThermo(BenchmarkState& state, const string& mech)
+{
+    auto sol = benchmarkSolution(state, mech);
+    if (!sol) {
+        return;
+    }
+    auto& thermo = *sol->thermo();
+    size_t nsp = thermo.nSpecies();
+    vector<double> cp(nsp), h(nsp), s(nsp);
+    vector<double> X(nsp, 1.0);
+    thermo.setState_TPX(300.0, OneAtm, X.data());
+    size_t i = 0;
+    for (auto _ : state) {
+        thermo.setState_TP(300.0 + 0.1 * (i++ % 20000), OneAtm);
+        thermo.getCp_R(cp.data());
+        thermo.getEnthalpy_RT(h.data());
+        thermo.getEntropy_R(s.data());
+    }
+    state.setCounter("species", nsp);
+}
+
+//! Time creation of a Solution from an input file. If `cached` is `false`, the file
+//! is parsed in every iteration; otherwise, the parsed YAML is reused.
+void loadMechanism(BenchmarkState& state, const string& mech, bool cached)
+{
+    string infile = benchmarkInputFile(state, mech);
+    if (infile.empty()) {
+        return;
+    }
+    for (auto _ : state) {
+        if (!cached) {
+            state.pauseTiming();
+            AnyMap::clearCachedFile(infile);
+            state.resumeTiming();
+        }
+        newSolution(infile, "", "none");
+    }
+}
+
+bool registerThermo()
+{
+    for (const auto& mech : benchmarkMechanisms()) {
+        registerBenchmark("thermo/" + mech + "/species-properties",
+            [mech](BenchmarkState& state) { speciesThermo(state, mech); });
+        registerBenchmark("input/" + mech + "/load",
+            [mech](BenchmarkState& state) { loadMechanism(state, mech, false); });
+        registerBenchmark("input/" + mech + "/load-cached",
+            [mech](BenchmarkState& state) { loadMechanism(state, mech, true); });
+    }
+    return true;
+}
+
+bool registered = registerThermo();
+
+}
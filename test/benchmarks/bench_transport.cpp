@@ -0,0 +1,61 @@
+//! @file bench_transport.cpp
+//!    Benchmarks for mixture-averaged and multicomponent transport properties.
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "benchmark.h"
+#include "cantera/core.h"
+
+using namespace Cantera;
+
+namespace {
+
+//! Time the evaluation of the properties required by a 1D flame model, perturbing
+//! the temperature between calls to avoid cached results.
+void transportProperties(BenchmarkState& state, const string& mech,
+                         const string& model)
+{
+    auto sol = benchmarkSolution(state, mech, model);
+    if (!sol) {
+        return;
+    }
+    auto& thermo = *sol->thermo();
+    auto& trans = *sol->transport();
+    size_t nsp = thermo.nSpecies();
+    vector<double> X(nsp, 1.0);
+    thermo.setState_TPX(1500.0, OneAtm, X.data());
+    double T = thermo.temperature();
+    vector<double> diff(model == "multicomponent" ? nsp * nsp : nsp);
+    vector<double> thermalDiff(nsp);
+    size_t i = 0;
+    for (auto _ : state) {
+        thermo.setState_TP(T + 1e-5 * (i++ % 2), OneAtm);
+        trans.viscosity();
+        trans.thermalConductivity();
+        if (model == "multicomponent") {
+            trans.getMultiDiffCoeffs(nsp, diff.data());
+            trans.getThermalDiffCoeffs(thermalDiff.data());
+        } else {
+            trans.getMixDiffCoeffs(diff.data());
+        }
+    }
+    state.setCounter("species", nsp);
+}
+
+bool registerTransport()
+{
+    for (const auto& mech : benchmarkMechanisms()) {
+        for (string model : {"mixture-averaged", "multicomponent"}) {
+            registerBenchmark("transport/" + mech + "/" + model,
+                [mech, model](BenchmarkState& state) {
+                    transportProperties(state, mech, model);
+                });
+        }
+    }
+    return true;
+}
+
+bool registered = registerTransport();
+
+}
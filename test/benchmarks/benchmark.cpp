@@ -0,0 +1,394 @@
+//! @file benchmark.cpp
+//!    Driver for the %Cantera performance benchmarks.
+//!
+//! Usage:
+//!
+//!     benchmark [--benchmark_filter=<regex>] [--benchmark_min_time=<seconds>]
+//!               [--benchmark_repetitions=<n>] [--benchmark_out=<file.json>]
+//!               [--benchmark_list_tests] [--<option>=<value> ...]
+//!
+//! Additional options are made available to individual benchmarks through
+//! benchmarkOption(), for example `--large-mechanism=<file>`.
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "benchmark.h"
+#include "cantera/base/Solution.h"
+#include "cantera/base/global.h"
+#include "cantera/base/ctexceptions.h"
+#include "cantera/base/stringUtils.h"
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <regex>
+#include <thread>
+
+namespace Cantera
+{
+
+namespace {
+
+struct Registered
+{
+    string name;
+    std::function<void(BenchmarkState&)> func;
+};
+
+vector<Registered>& registry()
+{
+    static vector<Registered> benchmarks;
+    return benchmarks;
+}
+
+map<string, string>& options()
+{
+    static map<string, string> opts;
+    return opts;
+}
+
+//! Result of one repetition of a benchmark, or an aggregate over repetitions
+struct RunResult
+{
+    string name;
+    string runName;
+    string aggregate; //!< Empty for individual repetitions
+    size_t repetition = 0;
+    size_t repetitions = 1;
+    size_t iterations = 0;
+    double realTime = 0.0; //!< Time per iteration [ns]
+    double cpuTime = 0.0; //!< Processor time per iteration [ns]
+    string skipped;
+    map<string, double> counters;
+};
+
+string jsonEscape(const string& text)
+{
+    string out;
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (c == '\n') {
+            out += "\\n";
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out += fmt::format("\\u{:04x}", static_cast<int>(c));
+        } else {
+            out += c;
+        }
+    }
+    return out;
+}
+
+string formatTime(double ns)
+{
+    if (ns < 1e4) {
+        return fmt::format("{:10.1f} ns", ns);
+    } else if (ns < 1e7) {
+        return fmt::format("{:10.1f} us", ns * 1e-3);
+    } else if (ns < 1e10) {
+        return fmt::format("{:10.1f} ms", ns * 1e-6);
+    }
+    return fmt::format("{:10.2f}  s", ns * 1e-9);
+}
+
+//! Run a benchmark with an increasing number of iterations until the timed loop
+//! takes at least `minTime` seconds, then return the number of iterations.
+size_t calibrate(const Registered& bench, double minTime, string& skipped)
+{
+    size_t iterations = 1;
+    while (true) {
+        BenchmarkState state(iterations);
+        bench.func(state);
+        if (!state.skipReason().empty()) {
+            skipped = state.skipReason();
+            return 0;
+        }
+        double elapsed = state.realTime();
+        if (elapsed >= minTime || iterations >= 1000000000) {
+            return iterations;
+        }
+        // Aim slightly above the target time, growing by at most a factor of 10
+        double factor = (elapsed > 0) ? 1.4 * minTime / elapsed : 10.0;
+        factor = std::min(std::max(factor, 2.0), 10.0);
+        iterations = static_cast<size_t>(iterations * factor);
+    }
+}
+
+vector<RunResult> runBenchmark(const Registered& bench, double minTime,
+                               size_t repetitions)
+{
+    vector<RunResult> results;
+    string skipped;
+    size_t iterations = calibrate(bench, minTime, skipped);
+    if (!skipped.empty()) {
+        RunResult result;
+        result.name = result.runName = bench.name;
+        result.skipped = skipped;
+        results.push_back(result);
+        return results;
+    }
+    for (size_t rep = 0; rep < repetitions; rep++) {
+        BenchmarkState state(iterations);
+        bench.func(state);
+        RunResult result;
+        result.name = result.runName = bench.name;
+        result.repetition = rep;
+        result.repetitions = repetitions;
+        result.iterations = iterations;
+        result.realTime = state.realTime() / iterations * 1e9;
+        result.cpuTime = state.cpuTime() / iterations * 1e9;
+        result.counters = state.counters();
+        results.push_back(result);
+    }
+    if (repetitions < 2) {
+        return results;
+    }
+
+    // Aggregates over all repetitions, named as in Google Benchmark
+    auto aggregate = [&](const string& kind, auto stat) {
+        RunResult result;
+        result.runName = bench.name;
+        result.name = bench.name + "_" + kind;
+        result.aggregate = kind;
+        result.repetitions = repetitions;
+        result.iterations = repetitions;
+        vector<double> real, cpu;
+        for (size_t i = 0; i < repetitions; i++) {
+            real.push_back(results[i].realTime);
+            cpu.push_back(results[i].cpuTime);
+        }
+        result.realTime = stat(real);
+        result.cpuTime = stat(cpu);
+        return result;
+    };
+    auto mean = [](const vector<double>& v) {
+        return std::accumulate(v.begin(), v.end(), 0.0) / v.size();
+    };
+    auto median = [](vector<double> v) {
+        std::sort(v.begin(), v.end());
+        size_t n = v.size();
+        return (n % 2) ? v[n / 2] : 0.5 * (v[n / 2 - 1] + v[n / 2]);
+    };
+    auto stddev = [&mean](const vector<double>& v) {
+        double avg = mean(v);
+        double sum = 0.0;
+        for (double x : v) {
+            sum += (x - avg) * (x - avg);
+        }
+        return std::sqrt(sum / (v.size() - 1));
+    };
+    results.push_back(aggregate("mean", mean));
+    results.push_back(aggregate("median", median));
+    results.push_back(aggregate("stddev", stddev));
+    return results;
+}
+
+void writeJson(const string& fname, const vector<RunResult>& results,
+               const string& executable)
+{
+    std::ofstream out(fname);
+    if (!out) {
+        throw CanteraError("writeJson", "Unable to open '{}' for writing", fname);
+    }
+    std::time_t now = std::time(nullptr);
+    char date[64];
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+#ifdef NDEBUG
+    string buildType = "release";
+#else
+    string buildType = "debug";
+#endif
+    out << "{\n  \"context\": {\n";
+    out << fmt::format("    \"date\": \"{}\",\n", date);
+    out << fmt::format("    \"executable\": \"{}\",\n", jsonEscape(executable));
+    out << fmt::format("    \"num_cpus\": {},\n", std::thread::hardware_concurrency());
+    out << fmt::format("    \"library_version\": \"{}\",\n", version());
+    out << fmt::format("    \"git_commit\": \"{}\",\n", gitCommit());
+    out << fmt::format("    \"library_build_type\": \"{}\"\n", buildType);
+    out << "  },\n  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& r = results[i];
+        out << (i ? ",\n" : "\n") << "    {\n";
+        out << fmt::format("      \"name\": \"{}\",\n", jsonEscape(r.name));
+        out << fmt::format("      \"run_name\": \"{}\",\n", jsonEscape(r.runName));
+        if (!r.skipped.empty()) {
+            out << "      \"run_type\": \"iteration\",\n";
+            out << "      \"error_occurred\": true,\n";
+            out << fmt::format("      \"error_message\": \"{}\"\n    }}",
+                               jsonEscape(r.skipped));
+            continue;
+        }
+        if (r.aggregate.empty()) {
+            out << "      \"run_type\": \"iteration\",\n";
+            out << fmt::format("      \"repetition_index\": {},\n", r.repetition);
+        } else {
+            out << "      \"run_type\": \"aggregate\",\n";
+            out << fmt::format("      \"aggregate_name\": \"{}\",\n", r.aggregate);
+        }
+        out << fmt::format("      \"repetitions\": {},\n", r.repetitions);
+        out << "      \"threads\": 1,\n";
+        out << fmt::format("      \"iterations\": {},\n", r.iterations);
+        out << fmt::format("      \"real_time\": {:.10g},\n", r.realTime);
+        out << fmt::format("      \"cpu_time\": {:.10g},\n", r.cpuTime);
+        for (const auto& [name, value] : r.counters) {
+            out << fmt::format("      \"{}\": {:.10g},\n", jsonEscape(name), value);
+        }
+        out << "      \"time_unit\": \"ns\"\n    }";
+    }
+    out << "\n  ]\n}\n";
+}
+
+} // end unnamed namespace
+
+void BenchmarkState::pauseTiming()
+{
+    if (m_running) {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_start;
+        m_realTime += elapsed.count();
+        m_cpuTime += double(std::clock() - m_cpuStart) / CLOCKS_PER_SEC;
+        m_running = false;
+    }
+}
+
+void BenchmarkState::resumeTiming()
+{
+    if (!m_running) {
+        m_running = true;
+        m_start = std::chrono::steady_clock::now();
+        m_cpuStart = std::clock();
+    }
+}
+
+void BenchmarkState::stopTiming()
+{
+    pauseTiming();
+}
+
+bool registerBenchmark(const string& name, std::function<void(BenchmarkState&)> func)
+{
+    registry().push_back({name, func});
+    return true;
+}
+
+string benchmarkOption(const string& name, const string& default_)
+{
+    auto iter = options().find(name);
+    return (iter == options().end()) ? default_ : iter->second;
+}
+
+const vector<string>& benchmarkMechanisms()
+{
+    static const vector<string> mechanisms = {"h2o2", "gri30", "nDodecane", "large"};
+    return mechanisms;
+}
+
+string benchmarkInputFile(BenchmarkState& state, const string& mech)
+{
+    if (mech == "nDodecane") {
+        return "nDodecane_Reitz.yaml";
+    } else if (mech == "large") {
+        string infile = benchmarkOption("large-mechanism");
+        if (infile.empty()) {
+            state.skip("No input file given with '--large-mechanism'");
+        }
+        return infile;
+    }
+    return mech + ".yaml";
+}
+
+shared_ptr<Solution> benchmarkSolution(BenchmarkState& state, const string& mech,
+                                       const string& transport)
+{
+    static map<pair<string, string>, shared_ptr<Solution>> cache;
+    auto& sol = cache[{mech, transport}];
+    if (!sol) {
+        string infile = benchmarkInputFile(state, mech);
+        if (infile.empty()) {
+            return nullptr;
+        }
+        sol = newSolution(infile, "", transport);
+    }
+    return sol;
+}
+
+}
+
+using namespace Cantera;
+
+int main(int argc, char** argv)
+{
+    string filter = ".*";
+    string outFile;
+    double minTime = 0.5;
+    size_t repetitions = 1;
+    bool listOnly = false;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg.substr(0, 2) != "--") {
+            std::cerr << "Unrecognized argument: " << arg << "\n";
+            return 1;
+        }
+        size_t eq = arg.find('=');
+        string key = arg.substr(2, eq == npos ? npos : eq - 2);
+        string value = (eq == npos) ? "true" : arg.substr(eq + 1);
+        if (key == "benchmark_filter") {
+            filter = value;
+        } else if (key == "benchmark_out") {
+            outFile = value;
+        } else if (key == "benchmark_min_time") {
+            if (!value.empty() && value.back() == 's') {
+                value.pop_back();
+            }
+            minTime = fpValueCheck(value);
+        } else if (key == "benchmark_repetitions") {
+            repetitions = std::max(std::stoi(value), 1);
+        } else if (key == "benchmark_list_tests") {
+            listOnly = true;
+        } else {
+            options()[key] = value;
+        }
+    }
+
+    std::regex pattern(filter);
+    vector<RunResult> results;
+    if (!listOnly) {
+        fmt::print("{:<60s} {:>13s} {:>13s} {:>12s}\n",
+                   "Benchmark", "Time", "CPU", "Iterations");
+        fmt::print("{}\n", string(101, '-'));
+    }
+    int status = 0;
+    for (const auto& bench : registry()) {
+        if (!std::regex_search(bench.name, pattern)) {
+            continue;
+        }
+        if (listOnly) {
+            fmt::print("{}\n", bench.name);
+            continue;
+        }
+        try {
+            for (const auto& r : runBenchmark(bench, minTime, repetitions)) {
+                if (!r.skipped.empty()) {
+                    fmt::print("{:<60s} SKIPPED: {}\n", r.name, r.skipped);
+                } else {
+                    fmt::print("{:<60s} {} {} {:>12d}\n", r.name,
+                               formatTime(r.realTime), formatTime(r.cpuTime),
+                               r.iterations);
+                }
+                results.push_back(r);
+            }
+        } catch (std::exception& err) {
+            fmt::print("{:<60s} ERROR\n{}\n", bench.name, err.what());
+            RunResult failed;
+            failed.name = failed.runName = bench.name;
+            failed.skipped = err.what();
+            results.push_back(failed);
+            status = 1;
+        }
+    }
+    if (!outFile.empty()) {
+        writeJson(outFile, results, argv[0]);
+    }
+    appdelete();
+    return status;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file benchmark.h
+ *    Minimal harness for the %Cantera performance benchmarks.
+ *
+ * The interface follows Google Benchmark, so that results can be compared with its
+ * tools: a benchmark is a function taking a BenchmarkState, and the timed code is
+ * the body of a range-based for loop over the state. Benchmarks are registered at
+ * static initialization time using registerBenchmark() or #CT_BENCHMARK. Results
+ * are written as JSON in the format produced by Google Benchmark.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_BENCHMARK_H
+#define CT_BENCHMARK_H
+
+#include "cantera/base/ct_defs.h"
+#include <chrono>
+#include <ctime>
+#include <functional>
+
+namespace Cantera
+{
+
+class Solution;
+
+//! Controls the timed loop of a single benchmark run
+class BenchmarkState
+{
+public:
+    explicit BenchmarkState(size_t iterations) : m_iterations(iterations) {}
+
+    //! Value of the loop variable, which is never used
+    struct [[maybe_unused]] Value {};
+
+    //! Iterator used by the range-based for loop over the state
+    struct Iterator
+    {
+        BenchmarkState* state;
+        size_t remaining;
+        bool operator!=(const Iterator& other) const {
+            if (remaining != 0) {
+                return true;
+            }
+            state->stopTiming();
+            return false;
+        }
+        Iterator& operator++() {
+            remaining--;
+            return *this;
+        }
+        Value operator*() const { return {}; }
+    };
+
+    //! Start timing. Code before the loop is not included in the measurement.
+    Iterator begin() {
+        m_running = true;
+        m_start = std::chrono::steady_clock::now();
+        m_cpuStart = std::clock();
+        return {this, m_iterations};
+    }
+    Iterator end() { return {this, 0}; }
+
+    //! Exclude the following code from the measurement
+    void pauseTiming();
+
+    //! Resume timing after a call to pauseTiming()
+    void resumeTiming();
+
+    //! Number of iterations of the timed loop
+    size_t iterations() const { return m_iterations; }
+
+    //! Mark the benchmark as skipped, for example if a required input is missing
+    void skip(const string& reason) { m_skipped = reason; }
+
+    //! Add a user-defined counter which is reported together with the timings
+    void setCounter(const string& name, double value) { m_counters[name] = value; }
+
+    //! Elapsed wall clock time of the timed loop [s]
+    double realTime() const { return m_realTime; }
+
+    //! Elapsed processor time of the timed loop [s]
+    double cpuTime() const { return m_cpuTime; }
+
+    const string& skipReason() const { return m_skipped; }
+    const map<string, double>& counters() const { return m_counters; }
+
+private:
+    void stopTiming();
+
+    size_t m_iterations;
+    bool m_running = false;
+    std::chrono::steady_clock::time_point m_start;
+    std::clock_t m_cpuStart = 0;
+    double m_realTime = 0.0;
+    double m_cpuTime = 0.0;
+    string m_skipped;
+    map<string, double> m_counters;
+};
+
+//! Register a benchmark. Returns `true` so the result can be used to initialize a
+//! static variable.
+bool registerBenchmark(const string& name, std::function<void(BenchmarkState&)> func);
+
+//! Get the value of a command line option of the form `--name=value` that is not
+//! used by the harness itself, or `default_` if the option was not given.
+string benchmarkOption(const string& name, const string& default_="");
+
+//! Names of the mechanisms used to compare performance for different problem sizes:
+//! `h2o2` (10 species), `gri30` (53 species), `nDodecane` (100 species), and `large`,
+//! which is read from the file given by the `--large-mechanism` option, since no
+//! mechanism with more than 1000 species is distributed with %Cantera.
+const vector<string>& benchmarkMechanisms();
+
+//! Get the input file for one of the benchmarkMechanisms(). Returns an empty string
+//! and marks the benchmark as skipped if no file was given for the `large` mechanism.
+string benchmarkInputFile(BenchmarkState& state, const string& mech);
+
+//! Get a Solution for one of the benchmarkMechanisms(), which is created on first use
+//! and shared by all benchmarks using the same mechanism and transport model.
+//! Returns an empty pointer and marks the benchmark as skipped if no file was given
+//! for the `large` mechanism.
+shared_ptr<Solution> benchmarkSolution(BenchmarkState& state, const string& mech,
+                                       const string& transport="none");
+
+}
+
+#define CT_BENCHMARK_CONCAT_(a, b) a##b
+#define CT_BENCHMARK_CONCAT(a, b) CT_BENCHMARK_CONCAT_(a, b)
+
+//! Register a benchmark function under the given name
+#define CT_BENCHMARK(name, func) \
+    static bool CT_BENCHMARK_CONCAT(ct_benchmark_, __LINE__) = \
+        ::Cantera::registerBenchmark(name, func)
+
+#endif
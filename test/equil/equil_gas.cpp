@@ -5,6 +5,11 @@
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/thermo/Species.h"
 #include "cantera/equil/MultiPhase.h"
+#include "cantera/equil/ChemEquil.h"
+#include "cantera/equil/InteriorPointEquil.h"
+#include "cantera/equil/vcs_MultiPhaseEquil.h"
+#include "cantera/equil/EquilibriumTable.h"
+#include "cantera/base/Solution.h"
 #include "cantera/base/global.h"
 #include "cantera/base/utilities.h"
 
@@ -294,22 +299,244 @@ public:
 TEST_F(PropertyPairs, ChemEquil_TP) { check_TP("element_potential"); }
 TEST_F(PropertyPairs, MultiPhase_TP) { check_TP("gibbs"); }
 TEST_F(PropertyPairs, VcsNonideal_TP) { check_TP("vcs"); }
+TEST_F(PropertyPairs, InteriorPoint_TP) { check_TP("interior_point"); }
 TEST_F(PropertyPairs, ChemEquil_HP) { check_HP("element_potential"); }
 TEST_F(PropertyPairs, MultiPhase_HP) { check_HP("gibbs"); }
 TEST_F(PropertyPairs, VcsNonideal_HP) { check_HP("vcs"); }
+TEST_F(PropertyPairs, InteriorPoint_HP) { check_HP("interior_point"); }
 TEST_F(PropertyPairs, ChemEquil_SP) { check_SP("element_potential"); }
 TEST_F(PropertyPairs, MultiPhase_SP) { check_SP("gibbs"); }
 TEST_F(PropertyPairs, VcsNonideal_SP) { check_SP("vcs"); }
+TEST_F(PropertyPairs, InteriorPoint_SP) { check_SP("interior_point"); }
 TEST_F(PropertyPairs, ChemEquil_SV) { check_SV("element_potential"); }
 // TEST_F(PropertyPairs, MultiPhase_SV) { check_SV("gibbs"); } // not implemented
 TEST_F(PropertyPairs, VcsNonideal_SV) { check_SV("vcs"); }
 TEST_F(PropertyPairs, ChemEquil_TV) { check_TV("element_potential"); }
 TEST_F(PropertyPairs, MultiPhase_TV) { check_TV("gibbs"); }
 TEST_F(PropertyPairs, VcsNonideal_TV) { check_TV("vcs"); }
+TEST_F(PropertyPairs, InteriorPoint_TV) { check_TV("interior_point"); }
 TEST_F(PropertyPairs, ChemEquil_UV) { check_UV("element_potential"); }
 // TEST_F(PropertyPairs, MultiPhase_UV) { check_UV("gibbs"); } // not implemented
 TEST_F(PropertyPairs, VcsNonideal_UV) { check_UV("vcs"); }
 
+TEST_F(PropertyPairs, ChemEquil_HP_continuation)
+{
+    // Repeated calls to ThermoPhase::equilibrate start from the previous
+    // solution, and should give the same result as a calculation from scratch
+    IdealGasPhase ref("gri30.yaml");
+    ChemEquil solver;
+    for (int i = 0; i < 6; i++) {
+        double T = 500 + 40 * i;
+        gas.setState_TPX(T, 1e5, "CH4:0.3, O2:0.3, N2:0.4");
+        ref.setState_TPX(T, 1e5, "CH4:0.3, O2:0.3, N2:0.4");
+        double h0 = gas.enthalpy_mass();
+        save_elemental_mole_fractions();
+        gas.equilibrate("HP", "element_potential");
+        EXPECT_NEAR(h0, gas.enthalpy_mass(), 1e-3);
+        check();
+
+        solver.equilibrate(ref, "HP");
+        EXPECT_NEAR(ref.temperature(), gas.temperature(), 1e-6);
+        for (size_t k = 0; k < gas.nSpecies(); k++) {
+            EXPECT_NEAR(ref.moleFraction(k), gas.moleFraction(k), 1e-10);
+        }
+    }
+}
+
+TEST(EquilibriumTable, build_and_interpolate)
+{
+    auto sol = newSolution("h2o2.yaml", "", "none");
+    auto gas = sol->thermo();
+    EquilibriumTable table(sol, "H2:1", "O2:1, AR:3.76", 300, 400);
+    vector<double> Z = {0.01, 0.02, 0.03, 0.05};
+    vector<double> dh = {-2e5, 0.0};
+    vector<double> P = {OneAtm, 2 * OneAtm};
+    table.setGrid(Z, dh, P);
+    table.build();
+    ASSERT_TRUE(table.ready());
+    ASSERT_EQ(table.nValues(), gas->nSpecies() + 2);
+
+    // Values at grid points match direct calculations
+    gas->setState_TPX(300, 2 * OneAtm, "H2:1");
+    double hFuel = gas->enthalpy_mass();
+    gas->setState_TPX(400, 2 * OneAtm, "O2:1, AR:3.76");
+    double hOx = gas->enthalpy_mass();
+    gas->setMixtureFraction(0.03, "H2:1", "O2:1, AR:3.76");
+    gas->setState_HP(0.03 * hFuel + 0.97 * hOx - 2e5, 2 * OneAtm);
+    gas->equilibrate("HP");
+    EXPECT_NEAR(table.temperature(0.03, -2e5, 2 * OneAtm), gas->temperature(), 1e-6);
+    EXPECT_NEAR(table.density(0.03, -2e5, 2 * OneAtm), gas->density(), 1e-10);
+    vector<double> X(gas->nSpecies());
+    table.getMoleFractions(0.03, -2e5, 2 * OneAtm, X.data());
+    for (size_t k = 0; k < gas->nSpecies(); k++) {
+        EXPECT_NEAR(X[k], gas->moleFraction(k), 1e-10);
+    }
+
+    // Interpolated values lie between the values at neighboring grid points
+    double T1 = table.temperature(0.02, 0.0, OneAtm);
+    double T2 = table.temperature(0.03, 0.0, OneAtm);
+    double Tmid = table.temperature(0.025, 0.0, OneAtm);
+    EXPECT_NEAR(Tmid, 0.5 * (T1 + T2), 1e-8);
+    EXPECT_GT(table.temperature(0.03, 0.0, OneAtm),
+              table.temperature(0.03, -2e5, OneAtm));
+
+    // Results are independent of the number of threads
+    EquilibriumTable table2(sol, "H2:1", "O2:1, AR:3.76", 300, 400);
+    table2.setGrid(Z, dh, P);
+    table2.build(3);
+    vector<double> v1(table.nValues()), v2(table.nValues());
+    table.interpolate(0.045, -1e5, 1.5 * OneAtm, v1.data());
+    table2.interpolate(0.045, -1e5, 1.5 * OneAtm, v2.data());
+    for (size_t n = 0; n < v1.size(); n++) {
+        EXPECT_NEAR(v1[n], v2[n], 1e-8 * (std::abs(v1[n]) + 1e-10));
+    }
+
+    // Round trip through a YAML file
+    table.save("equil-table.yaml", "table", "", true);
+    EquilibriumTable table3(sol, "", "", 0, 0);
+    table3.restore("equil-table.yaml", "table");
+    EXPECT_EQ(table3.mixtureFractionGrid().size(), Z.size());
+    table3.interpolate(0.045, -1e5, 1.5 * OneAtm, v2.data());
+    for (size_t n = 0; n < v1.size(); n++) {
+        EXPECT_NEAR(v1[n], v2[n], 1e-8 * (std::abs(v1[n]) + 1e-10));
+    }
+}
+
+TEST(EquilibriumTable, invalid_grid)
+{
+    auto sol = newSolution("h2o2.yaml", "", "none");
+    EquilibriumTable table(sol, "H2:1", "O2:1, AR:3.76", 300, 300);
+    EXPECT_THROW(table.setGrid({0.1, 0.05}, {0.0}, {OneAtm}), CanteraError);
+    EXPECT_THROW(table.setGrid({0.1, 1.5}, {0.0}, {OneAtm}), CanteraError);
+    EXPECT_THROW(table.setGrid({0.1}, {}, {OneAtm}), CanteraError);
+    EXPECT_THROW(table.temperature(0.1, 0.0, OneAtm), CanteraError);
+}
+
+TEST(InteriorPointEquil, gas_graphite)
+{
+    // Compare with the VCS solver for a fuel-rich mixture where solid carbon
+    // is formed at low temperature but not at high temperature
+    for (double T : {1000.0, 3000.0}) {
+        vector<vector<double>> moles;
+        for (string solver : {"vcs", "interior_point"}) {
+            auto gas = newThermo("gri30.yaml");
+            auto graphite = newThermo("graphite.yaml");
+            gas->setState_TPX(T, OneAtm, "CH4:1.0, O2:0.2, N2:0.5");
+            graphite->setState_TP(T, OneAtm);
+            MultiPhase mix;
+            mix.addPhase(gas.get(), 1.0);
+            mix.addPhase(graphite.get(), 0.0);
+            mix.init();
+            if (solver == "vcs") {
+                mix.equilibrate("TP", solver);
+            } else {
+                InteriorPointEquil eq(&mix);
+                eq.equilibrate(TP, 1e-10);
+                EXPECT_LT(eq.iterations(), 60);
+            }
+            moles.emplace_back(mix.nSpecies());
+            mix.getMoles(moles.back().data());
+        }
+        for (size_t k = 0; k < moles[0].size(); k++) {
+            EXPECT_NEAR(moles[0][k], moles[1][k], 1e-6 * moles[0][k] + 1e-12)
+                << "T = " << T << ", k = " << k;
+        }
+    }
+}
+
+TEST(VcsMultiPhaseEquil, parallel_stability_tests)
+{
+    // Several multispecies phases which are initially absent, so phase
+    // stability tests are required during the solution
+    vector<vector<double>> moles;
+    for (int nThreads : {1, 3}) {
+        auto gas = newThermo("equilibrium.yaml", "incomplete");
+        gas->setState_TPX(1500.0, OneAtm, "CH4:1.0, O2:1.5");
+        MultiPhase mix;
+        mix.addPhase(gas.get(), 1.0);
+        vector<shared_ptr<ThermoPhase>> others;
+        for (const char* name : {"complete", "complete", "overconstrained-1"}) {
+            others.push_back(newThermo("equilibrium.yaml", name));
+            others.back()->setState_TPX(1500.0, OneAtm, "O2:1.0");
+            mix.addPhase(others.back().get(), 0.0);
+        }
+        mix.init();
+        vcs_MultiPhaseEquil solver(&mix, 0);
+        solver.setNumThreads(nThreads);
+        solver.equilibrate_TP();
+        moles.emplace_back(mix.nSpecies());
+        for (size_t k = 0; k < mix.nSpecies(); k++) {
+            moles.back()[k] = mix.speciesMoles(k);
+        }
+    }
+    for (size_t k = 0; k < moles[0].size(); k++) {
+        EXPECT_NEAR(moles[0][k], moles[1][k], 1e-12);
+    }
+}
+
+// Provides access to internal settings and counters of the VCS solver
+class VcsSolverProbe : public vcs_MultiPhaseEquil
+{
+public:
+    using vcs_MultiPhaseEquil::vcs_MultiPhaseEquil;
+    void setReuseBasis(bool reuse) {
+        m_vsolve.m_reuseStoichCoeffs = reuse;
+    }
+    int basisReuses() const {
+        return m_vsolve.m_VCount->T_Basis_Reuse;
+    }
+};
+
+TEST(VcsMultiPhaseEquil, basis_reuse)
+{
+    // Solvers used repeatedly with and without reusing the stoichiometric
+    // coefficients of an unchanged basis must give identical results, including
+    // when graphite appears or disappears, which changes the set of components.
+    vector<shared_ptr<ThermoPhase>> phases;
+    vector<unique_ptr<MultiPhase>> mixes;
+    vector<unique_ptr<VcsSolverProbe>> solvers;
+    for (size_t i = 0; i < 3; i++) {
+        phases.push_back(newThermo("gri30.yaml"));
+        phases.back()->setState_TPX(1000.0, OneAtm, "CH4:1.0, O2:0.5, N2:0.5");
+        mixes.push_back(make_unique<MultiPhase>());
+        mixes.back()->addPhase(phases.back().get(), 1.0);
+        phases.push_back(newThermo("graphite.yaml"));
+        mixes.back()->addPhase(phases.back().get(), 0.0);
+        mixes.back()->init();
+        solvers.push_back(make_unique<VcsSolverProbe>(mixes.back().get(), 0));
+    }
+    size_t nsp = mixes[0]->nSpecies();
+    vector<double> moles0(nsp);
+    mixes[0]->getMoles(moles0.data());
+    solvers[1]->setReuseBasis(false);
+
+    for (double T : {1000.0, 1000.0, 2000.0, 1000.0, 2000.0, 2000.0}) {
+        vector<vector<double>> moles(3, vector<double>(nsp));
+        for (size_t i = 0; i < 3; i++) {
+            if (i == 2) {
+                // new solver for each state
+                solvers[2] = make_unique<VcsSolverProbe>(mixes[2].get(), 0);
+            }
+            mixes[i]->setMoles(moles0.data());
+            mixes[i]->setTemperature(T);
+            solvers[i]->equilibrate_TP();
+            mixes[i]->getMoles(moles[i].data());
+        }
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_EQ(moles[0][k], moles[1][k]) << "T = " << T << ", k = " << k;
+            EXPECT_NEAR(moles[0][k], moles[2][k], 1e-6 * moles[2][k] + 1e-16)
+                << "T = " << T << ", k = " << k;
+        }
+        if (T == 1000.0) {
+            EXPECT_GT(mixes[0]->phaseMoles(1), 0.0);
+        } else {
+            EXPECT_EQ(mixes[0]->phaseMoles(1), 0.0);
+        }
+    }
+    EXPECT_GT(solvers[0]->basisReuses(), 0);
+    EXPECT_EQ(solvers[1]->basisReuses(), 0);
+}
+
 int main(int argc, char** argv)
 {
     printf("Running main() from equil_gas.cpp\n");
@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 #include "cantera/base/Interface.h"
 #include "cantera/base/SolutionArray.h"
+#include <fstream>
 
 using namespace Cantera;
 
@@ -509,3 +510,259 @@ TEST(SolutionArray, extraSlicedStringArrays) {
     ASSERT_EQ(sliced->getAuxiliary(1)["spam"].asVector<string>()[0], "a");
     testMultiCol<string>(*sliced, vector<string>({"foo", "bar", "baz"}), true);
 }
+
+TEST(SolutionArray, appendEntry) {
+    auto gas = newSolution("h2o2.yaml",  "", "none");
+    string fname = "solutionarray-append.h5";
+    auto arr = SolutionArray::create(gas, 4);
+    arr->addExtra("spam");
+    AnyValue any;
+    any = vector<double>({1., 2., 3., 4.});
+    arr->setComponent("spam", any);
+    if (!usesHDF5()) {
+        ASSERT_THROW(arr->appendEntry(fname, "stream"), CanteraError);
+        return;
+    }
+    std::remove(fname.c_str());
+
+    ASSERT_EQ(arr->appendEntry(fname, "stream", "", 0, 3), 4u);
+    any = vector<double>({5., 6., 7., 8.});
+    arr->setComponent("spam", any);
+    any = vector<double>({400., 500., 600., 700.});
+    arr->setComponent("T", any);
+    ASSERT_EQ(arr->appendEntry(fname, "stream"), 8u);
+
+    auto other = SolutionArray::create(gas, 2);
+    ASSERT_THROW(other->appendEntry(fname, "stream"), CanteraError);
+
+    auto restored = SolutionArray::create(gas);
+    restored->restore(fname, "stream");
+    ASSERT_EQ(restored->size(), 8);
+    auto spam = restored->getComponent("spam").asVector<double>();
+    auto T = restored->getComponent("T").asVector<double>();
+    for (size_t i = 0; i < 8; i++) {
+        EXPECT_DOUBLE_EQ(spam[i], i + 1.);
+    }
+    EXPECT_DOUBLE_EQ(T[3], 300.);
+    EXPECT_DOUBLE_EQ(T[4], 400.);
+    std::remove(fname.c_str());
+}
+
+TEST(SolutionArray, csvRoundTrip) {
+    auto gas = newSolution("h2o2.yaml",  "", "none");
+    auto thermo = gas->thermo();
+    auto arr = SolutionArray::create(gas, 5);
+    vector<double> state(thermo->stateSize());
+    for (int i = 0; i < 5; i++) {
+        thermo->setState_TPX(300. + 100. * i, OneAtm * (i + 1),
+                             fmt::format("H2:{}, O2:1, AR:1", i + 1));
+        thermo->saveState(state);
+        arr->setState(i, state);
+    }
+    arr->addExtra("idx", false);
+    arr->addExtra("spam");
+    arr->addExtra("eggs");
+    AnyValue any;
+    any = vector<long int>({0, 1, 2, 3, 4});
+    arr->setComponent("idx", any);
+    any = vector<double>({0.5, 1.5, 2.5, 3.5, 4.5});
+    arr->setComponent("spam", any);
+    any = vector<string>({"a", "b, c", "d", "e", "f"});
+    arr->setComponent("eggs", any);
+
+    for (const string basis : {"Y", "X"}) {
+        string fname = "solutionarray-" + basis + ".csv";
+        arr->writeEntry(fname, true, basis);
+        auto restored = SolutionArray::create(gas);
+        restored->readEntry(fname);
+        ASSERT_EQ(restored->size(), 5);
+        ASSERT_EQ(restored->componentNames(), arr->componentNames());
+        for (int i = 0; i < 5; i++) {
+            auto expected = arr->getState(i);
+            auto actual = restored->getState(i);
+            for (size_t j = 0; j < expected.size(); j++) {
+                EXPECT_NEAR(actual[j], expected[j], 1e-8 * expected[j]);
+            }
+        }
+        ASSERT_TRUE(restored->getComponent("idx").isVector<long int>());
+        EXPECT_EQ(restored->getComponent("spam").asVector<double>()[2], 2.5);
+        EXPECT_EQ(restored->getComponent("eggs").asVector<string>()[1], "b, c");
+        std::remove(fname.c_str());
+    }
+}
+
+TEST(SolutionArray, csvRoundTripPureFluid) {
+    // The native state of a pure fluid does not contain the composition
+    auto water = newSolution("liquidvapor.yaml", "water", "none");
+    auto thermo = water->thermo();
+    auto arr = SolutionArray::create(water, 4);
+    vector<double> state(thermo->stateSize());
+    for (int i = 0; i < 4; i++) {
+        thermo->setState_TP(300. + 100. * i, 10 * OneAtm);
+        thermo->saveState(state);
+        arr->setState(i, state);
+    }
+
+    for (const string basis : {"Y", "X"}) {
+        string fname = "solutionarray-water-" + basis + ".csv";
+        arr->writeEntry(fname, true, basis);
+        auto restored = SolutionArray::create(water);
+        restored->readEntry(fname);
+        ASSERT_EQ(restored->size(), 4);
+        ASSERT_EQ(restored->componentNames(), arr->componentNames());
+        for (int i = 0; i < 4; i++) {
+            auto expected = arr->getState(i);
+            auto actual = restored->getState(i);
+            for (size_t j = 0; j < expected.size(); j++) {
+                EXPECT_NEAR(actual[j], expected[j], 1e-8 * expected[j]);
+            }
+        }
+        std::remove(fname.c_str());
+    }
+}
+
+TEST(SolutionArray, componentViews) {
+    auto gas = newSolution("h2o2.yaml",  "", "none");
+    auto thermo = gas->thermo();
+    auto arr = SolutionArray::create(gas, 6);
+    vector<double> state(thermo->stateSize());
+    for (int i = 0; i < 6; i++) {
+        thermo->setState_TPX(300. + 100. * i, OneAtm, "H2:1, O2:1, AR:1");
+        thermo->saveState(state);
+        arr->setState(i, state);
+    }
+    arr->addExtra("spam");
+    arr->addExtra("eggs");
+    AnyValue any;
+    any = vector<double>({0., 1., 2., 3., 4., 5.});
+    arr->setComponent("spam", any);
+    any = vector<long int>({0, 1, 2, 3, 4, 5});
+    arr->setComponent("eggs", any);
+
+    auto T = arr->componentView("T");
+    ASSERT_EQ(T.size(), 6);
+    EXPECT_DOUBLE_EQ(T[3], 600.);
+    T[3] = 650.;
+    EXPECT_DOUBLE_EQ(arr->getComponent("T").asVector<double>()[3], 650.);
+    auto spam = arr->componentView("spam");
+    EXPECT_DOUBLE_EQ(spam.sum(), 15.);
+    ASSERT_THROW(arr->componentView("eggs"), CanteraError);
+    ASSERT_THROW(arr->componentView("P"), CanteraError);
+
+    auto Y = arr->speciesView();
+    ASSERT_EQ(Y.rows(), 6);
+    ASSERT_EQ(Y.cols(), static_cast<long>(thermo->nSpecies()));
+    size_t kO2 = thermo->speciesIndex("O2");
+    auto yO2 = arr->getComponent("O2").asVector<double>();
+    for (int i = 0; i < 6; i++) {
+        EXPECT_DOUBLE_EQ(Y(i, kO2), yO2[i]);
+        EXPECT_NEAR(Y.row(i).sum(), 1., 1e-14);
+    }
+
+    auto sliced = arr->share({1, 3, 5});
+    auto Ts = sliced->componentView("T");
+    ASSERT_EQ(Ts.size(), 3);
+    EXPECT_DOUBLE_EQ(Ts[1], 650.);
+    EXPECT_DOUBLE_EQ(sliced->componentView("spam")[2], 5.);
+    EXPECT_DOUBLE_EQ(sliced->speciesView()(2, kO2), yO2[5]);
+    auto irregular = arr->share({0, 1, 3});
+    ASSERT_THROW(irregular->componentView("T"), CanteraError);
+}
+
+TEST(SolutionArray, columnMajor) {
+    auto gas = newSolution("h2o2.yaml",  "", "none");
+    auto thermo = gas->thermo();
+    auto arr = SolutionArray::create(gas, 4);
+    vector<double> state(thermo->stateSize());
+    vector<vector<double>> states;
+    for (int i = 0; i < 4; i++) {
+        thermo->setState_TPX(300. + 100. * i, OneAtm * (i + 1), "H2:1, O2:1, AR:1");
+        thermo->saveState(state);
+        arr->setState(i, state);
+        states.push_back(state);
+    }
+    ASSERT_FALSE(arr->columnMajor());
+    arr->setColumnMajor(true);
+    ASSERT_TRUE(arr->columnMajor());
+    for (int i = 0; i < 4; i++) {
+        EXPECT_EQ(arr->getState(i), states[i]);
+    }
+    auto T = arr->componentView("T");
+    EXPECT_EQ(T.innerStride(), 1);
+    EXPECT_DOUBLE_EQ(T[2], 500.);
+    EXPECT_EQ(arr->speciesView().innerStride(), 1);
+
+    arr->resize(6);
+    EXPECT_EQ(arr->getState(3), states[3]);
+    arr->setState(5, states[1]);
+    EXPECT_EQ(arr->getState(5), states[1]);
+    EXPECT_DOUBLE_EQ(arr->getComponent("D").asVector<double>()[5], states[1][1]);
+
+    string fname = "solutionarray-colmajor.csv";
+    arr->writeEntry(fname, true, "X");
+    auto restored = SolutionArray::create(gas);
+    restored->setColumnMajor(true);
+    restored->readEntry(fname);
+    ASSERT_EQ(restored->size(), 6);
+    for (size_t j = 0; j < state.size(); j++) {
+        EXPECT_NEAR(restored->getState(3)[j], states[3][j], 1e-8 * states[3][j]);
+    }
+    std::remove(fname.c_str());
+
+    auto sliced = arr->share({1, 2});
+    ASSERT_THROW(arr->setColumnMajor(false), CanteraError);
+    EXPECT_EQ(sliced->getState(1), states[2]);
+    sliced.reset();
+    arr->setColumnMajor(false);
+    EXPECT_EQ(arr->getState(3), states[3]);
+    EXPECT_EQ(arr->getState(5), states[1]);
+}
+
+TEST(SolutionArray, backingFile) {
+    auto gas = newSolution("h2o2.yaml",  "", "none");
+    auto thermo = gas->thermo();
+    auto arr = SolutionArray::create(gas, 3);
+    string fname = "solutionarray-states.bin";
+#ifdef _WIN32
+    ASSERT_THROW(arr->setBackingFile(fname), NotImplementedError);
+#else
+    vector<double> state(thermo->stateSize());
+    thermo->setState_TPX(500., OneAtm, "H2:1, O2:1");
+    thermo->saveState(state);
+    arr->setState(1, state);
+    arr->setBackingFile(fname);
+    EXPECT_EQ(arr->backingFile(), fname);
+    EXPECT_EQ(arr->getState(1), state);
+    ASSERT_THROW(arr->setBackingFile(fname), CanteraError);
+    ASSERT_THROW(arr->setColumnMajor(true), NotImplementedError);
+
+    // append entries beyond the initial size of the mapped file
+    AnyMap extra;
+    for (int i = 0; i < 2000; i++) {
+        thermo->setState_TPX(300. + i, OneAtm, "H2:1, O2:1");
+        thermo->saveState(state);
+        arr->append(state, extra);
+    }
+    ASSERT_EQ(arr->size(), 2003);
+    EXPECT_DOUBLE_EQ(arr->getComponent("T").asVector<double>()[1502], 1799.);
+    EXPECT_DOUBLE_EQ(arr->componentView("T")[1], 500.);
+    auto sliced = arr->share({1, 1001, 2001});
+    EXPECT_DOUBLE_EQ(sliced->componentView("T")[2], 2298.);
+    sliced.reset();
+    arr->resize(10);
+    EXPECT_EQ(arr->getState(1)[0], 500.);
+
+    arr.reset();
+    EXPECT_FALSE(std::ifstream(fname).good());
+
+    // column-major data are relocated within the mapped file
+    arr = SolutionArray::create(gas, 2);
+    arr->setColumnMajor(true);
+    arr->setState(1, state);
+    arr->setBackingFile(fname);
+    arr->resize(600);
+    EXPECT_EQ(arr->getState(1), state);
+    arr->resize(5);
+    EXPECT_EQ(arr->getState(1), state);
+#endif
+}
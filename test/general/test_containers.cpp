@@ -1,6 +1,10 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "cantera/base/AnyMap.h"
+#include "cantera/base/Solution.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/Kinetics.h"
+#include <thread>
 
 using namespace Cantera;
 
@@ -419,6 +423,65 @@ TEST(AnyMap, missingKeyAt)
     }
 }
 
+TEST(AnyMap, sharedYamlFile)
+{
+    AnyMap::clearCachedFile("h2o2.yaml");
+    auto shared1 = AnyMap::sharedYamlFile("h2o2.yaml");
+    auto shared2 = AnyMap::sharedYamlFile("h2o2.yaml");
+    EXPECT_EQ(shared1.get(), shared2.get());
+    AnyMap copy = AnyMap::fromYamlFile("h2o2.yaml");
+    EXPECT_EQ(copy["phases"], shared1->at("phases"));
+
+    // Clearing the cache causes the file to be parsed again, while existing
+    // handles remain valid
+    AnyMap::clearCachedFile("h2o2.yaml");
+    auto shared3 = AnyMap::sharedYamlFile("h2o2.yaml");
+    EXPECT_NE(shared1.get(), shared3.get());
+    EXPECT_EQ(shared1->at("reactions"), shared3->at("reactions"));
+
+    EXPECT_THROW(AnyMap::sharedYamlFile("does-not-exist.yaml"), CanteraError);
+}
+
+TEST(AnyMap, sharedYamlFileThreads)
+{
+    vector<string> files = {"h2o2.yaml", "gri30.yaml", "ideal-gas.yaml"};
+    for (const auto& name : files) {
+        AnyMap::clearCachedFile(name);
+    }
+    size_t nThreads = 6;
+    vector<shared_ptr<const AnyMap>> roots(nThreads);
+    vector<shared_ptr<Solution>> solutions(nThreads);
+    vector<std::exception_ptr> errors(nThreads);
+    vector<std::thread> threads;
+    for (size_t i = 0; i < nThreads; i++) {
+        threads.emplace_back([&, i]() {
+            try {
+                roots[i] = AnyMap::sharedYamlFile(files[i % files.size()]);
+                if (i % files.size() != 2) {
+                    solutions[i] = newSolution(files[i % files.size()]);
+                }
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    for (size_t i = 0; i < nThreads; i++) {
+        if (errors[i]) {
+            std::rethrow_exception(errors[i]);
+        }
+        // Threads loading the same file share a single parsed AnyMap
+        EXPECT_EQ(roots[i].get(), roots[i % files.size()].get());
+        EXPECT_EQ(roots[i].get(), AnyMap::sharedYamlFile(files[i % files.size()]).get());
+    }
+    EXPECT_EQ(solutions[0]->kinetics()->nReactions(),
+              solutions[3]->kinetics()->nReactions());
+    EXPECT_EQ(solutions[1]->thermo()->nSpecies(), 53u);
+    EXPECT_EQ(solutions[4]->kinetics()->nReactions(), 325u);
+}
+
 TEST(AnyMap, dumpYamlString)
 {
     AnyMap original = AnyMap::fromYamlFile("h2o2.yaml");
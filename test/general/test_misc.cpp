@@ -4,7 +4,13 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "cantera/base/global.h"
+#include "cantera/base/logger.h"
 #include "cantera/base/Solution.h"
+#include "cantera/base/PerfCounters.h"
+#include "cantera/base/AnyMap.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include <thread>
 
 using namespace Cantera;
 using ::testing::HasSubstr;
@@ -30,3 +36,101 @@ TEST(CanteraError, stacktrace) {
     }
     EXPECT_TRUE(raised);
 }
+
+TEST(PerfCounters, scoped_timers) {
+    resetPerfCounters();
+    auto work = [] {
+        for (int i = 0; i < 3; i++) {
+            ScopedTimer outer("test-outer");
+            for (int j = 0; j < 2; j++) {
+                ScopedTimer inner("test-inner");
+            }
+        }
+        ScopedTimer inner("test-inner");
+    };
+    work();
+    std::thread other(work);
+    other.join();
+
+    AnyMap report = perfCounterReport();
+    ASSERT_TRUE(report.hasKey("test-outer"));
+    auto& outer = report["test-outer"].as<AnyMap>();
+    EXPECT_EQ(outer["calls"].asInt(), 6);
+    EXPECT_GE(outer["time"].asDouble(), 0.0);
+    // Nested timers are reported as children of the enclosing timer; results from
+    // both threads are combined
+    auto& nested = outer["children"].as<AnyMap>()["test-inner"].as<AnyMap>();
+    EXPECT_EQ(nested["calls"].asInt(), 12);
+    EXPECT_FALSE(nested.hasKey("children"));
+    EXPECT_EQ(report["test-inner"].as<AnyMap>()["calls"].asInt(), 2);
+
+    resetPerfCounters();
+    EXPECT_FALSE(perfCounterReport().hasKey("test-outer"));
+
+    // Counters of threads which have exited are combined
+    for (int i = 0; i < 20; i++) {
+        std::thread(work).join();
+    }
+    report = perfCounterReport();
+    EXPECT_EQ(report["test-outer"]["calls"].asInt(), 60);
+    EXPECT_EQ(report["test-outer"]["children"]["test-inner"]["calls"].asInt(), 120);
+    EXPECT_EQ(report["test-inner"]["calls"].asInt(), 20);
+    resetPerfCounters();
+    EXPECT_FALSE(perfCounterReport().hasKey("test-outer"));
+}
+
+TEST(PerfCounters, instrumented_functions) {
+    if (!perfCountersEnabled()) {
+        GTEST_SKIP() << "Cantera was compiled without performance counters";
+    }
+    auto sol = newSolution("h2o2.yaml");
+    resetPerfCounters();
+    vector<double> ropf(sol->kinetics()->nReactions());
+    for (int i = 0; i < 5; i++) {
+        sol->thermo()->setState_TP(1000 + 10 * i, OneAtm);
+        sol->kinetics()->getFwdRatesOfProgress(ropf.data());
+    }
+    AnyMap report = perfCounterReport();
+    ASSERT_TRUE(report.hasKey("BulkKinetics::updateROP"));
+    EXPECT_EQ(report["BulkKinetics::updateROP"]["calls"].asInt(), 5);
+}
+
+namespace {
+
+//! Logger which stores messages instead of printing them
+class CaptureLogger : public Logger
+{
+public:
+    void write(const string& msg) override {
+        text.push_back(msg);
+    }
+    void warn(const string& warning, const string& msg) override {
+        warnings.push_back(msg);
+    }
+    vector<string> text;
+    vector<string> warnings;
+};
+
+}
+
+TEST(parallelFor, worker_messages)
+{
+    auto logger = new CaptureLogger();
+    setLogger(logger); // takes ownership
+    size_t n = 64;
+    vector<size_t> done(n, 0);
+    parallelFor(n, [&](size_t i) {
+        writelog("item {}", i);
+        warn_user("worker_messages", "warning {}", i);
+        done[i]++;
+    });
+    // Messages from all threads reach the logger of the calling thread, in order
+    ASSERT_EQ(logger->text.size(), n);
+    ASSERT_EQ(logger->warnings.size(), n);
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_EQ(done[i], 1u);
+        EXPECT_EQ(logger->text[i], fmt::format("item {}", i));
+        EXPECT_THAT(logger->warnings[i], HasSubstr(fmt::format("warning {}", i)));
+    }
+    setLogger(new Logger());
+}
@@ -3,10 +3,12 @@
 
 #include "gtest/gtest.h"
 #include "cantera/base/YamlWriter.h"
+#include "cantera/base/BinaryMechanism.h"
 #include "cantera/thermo.h"
 #include "cantera/thermo/SurfPhase.h"
 #include "cantera/base/Solution.h"
 #include "cantera/kinetics.h"
+#include "cantera/transport/Transport.h"
 #include "cantera/transport/TransportData.h"
 #include "cantera/base/Storage.h"
 #include <fstream>
@@ -401,6 +403,139 @@ TEST(YamlWriter, customHeader)
     ASSERT_EQ(soln->header()["spam"].asString(), "eggs");
 }
 
+void compareSolutions(shared_ptr<Solution> sol1, shared_ptr<Solution> sol2)
+{
+    auto thermo1 = sol1->thermo();
+    auto thermo2 = sol2->thermo();
+    ASSERT_EQ(thermo1->name(), thermo2->name());
+    ASSERT_EQ(thermo1->type(), thermo2->type());
+    ASSERT_EQ(thermo1->speciesNames(), thermo2->speciesNames());
+    ASSERT_EQ(thermo1->elementNames(), thermo2->elementNames());
+    size_t nsp = thermo1->nSpecies();
+    vector<double> X(nsp);
+    for (size_t k = 0; k < nsp; k++) {
+        X[k] = 1.0 + k % 5;
+    }
+    for (auto& thermo : {thermo1, thermo2}) {
+        thermo->setState_TPX(1400, 2 * OneAtm, X.data());
+    }
+    EXPECT_NEAR(thermo1->cp_mass(), thermo2->cp_mass(), 1e-12 * thermo1->cp_mass());
+    EXPECT_NEAR(thermo1->enthalpy_mass(), thermo2->enthalpy_mass(),
+                1e-12 * std::abs(thermo1->enthalpy_mass()));
+    EXPECT_NEAR(thermo1->entropy_mass(), thermo2->entropy_mass(),
+                1e-12 * thermo1->entropy_mass());
+    EXPECT_DOUBLE_EQ(thermo1->meanMolecularWeight(), thermo2->meanMolecularWeight());
+
+    auto kin1 = sol1->kinetics();
+    auto kin2 = sol2->kinetics();
+    ASSERT_EQ(kin1->nReactions(), kin2->nReactions());
+    size_t nr = kin1->nReactions();
+    vector<double> kf1(nr), kf2(nr), kr1(nr), kr2(nr);
+    kin1->getFwdRateConstants(kf1.data());
+    kin2->getFwdRateConstants(kf2.data());
+    kin1->getRevRateConstants(kr1.data());
+    kin2->getRevRateConstants(kr2.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_EQ(kin1->reaction(i)->equation(), kin2->reaction(i)->equation());
+        EXPECT_EQ(kin1->reaction(i)->type(), kin2->reaction(i)->type());
+        EXPECT_NEAR(kf1[i], kf2[i], 1e-12 * std::abs(kf1[i])) << "reaction " << i;
+        EXPECT_NEAR(kr1[i], kr2[i], 1e-12 * std::abs(kr1[i])) << "reaction " << i;
+    }
+}
+
+TEST(BinaryMechanism, gri30)
+{
+    auto original = newSolution("gri30.yaml", "", "mixture-averaged");
+    writeBinaryMechanism(original, "generated-gri30.ctb");
+    auto duplicate = newSolution("generated-gri30.ctb");
+    EXPECT_EQ(duplicate->transportModel(), "mixture-averaged");
+    compareSolutions(original, duplicate);
+
+    auto tran1 = original->transport();
+    auto tran2 = duplicate->transport();
+    EXPECT_NEAR(tran1->viscosity(), tran2->viscosity(), 1e-12 * tran1->viscosity());
+    EXPECT_NEAR(tran1->thermalConductivity(), tran2->thermalConductivity(),
+                1e-12 * tran1->thermalConductivity());
+}
+
+TEST(BinaryMechanism, rateTypes)
+{
+    for (string name : {"pdep-test.yaml", "explicit-third-bodies.yaml",
+                        "chemically-activated-reaction.yaml", "blowers-masel.yaml"})
+    {
+        SCOPED_TRACE(name);
+        auto original = newSolution(name, "", "none");
+        writeBinaryMechanism(original, "generated-rate-types.ctb");
+        auto duplicate = newSolutionFromBinary("generated-rate-types.ctb", "none");
+        compareSolutions(original, duplicate);
+    }
+}
+
+TEST(BinaryMechanism, customFields)
+{
+    // Reactions with input fields that are not part of the flat representation
+    // are stored using YAML
+    auto original = newSolution("h2o2.yaml", "", "none");
+    auto kin = original->kinetics();
+    kin->reaction(2)->input["custom-field"] = "spam";
+    kin->reaction(21)->input["custom-field"] = vector<double>{1.0, 2.0};
+    writeBinaryMechanism(original, "generated-custom-fields.ctb");
+    auto duplicate = newSolutionFromBinary("generated-custom-fields.ctb", "none");
+    compareSolutions(original, duplicate);
+    auto kin2 = duplicate->kinetics();
+    ASSERT_TRUE(kin2->reaction(2)->input.hasKey("custom-field"));
+    EXPECT_EQ(kin2->reaction(2)->input["custom-field"].asString(), "spam");
+    ASSERT_TRUE(kin2->reaction(21)->input.hasKey("custom-field"));
+    EXPECT_EQ(kin2->reaction(21)->input["custom-field"].asVector<double>()[1], 2.0);
+    EXPECT_FALSE(kin2->reaction(3)->input.hasKey("custom-field"));
+}
+
+TEST(BinaryMechanism, speciesFields)
+{
+    // Species with input fields that are not part of the flat representation,
+    // including fields of the thermo and transport data, are stored using YAML
+    auto original = newSolution("gri30.yaml", "", "mixture-averaged");
+    auto thermo = original->thermo();
+    for (size_t k = 0; k < thermo->nSpecies(); k++) {
+        thermo->species(k)->thermo->input().erase("note");
+    }
+    thermo->species("H2")->input["note"] = "spam";
+    thermo->species("O2")->thermo->input()["note"] = "eggs";
+    thermo->species("OH")->transport->input["custom-field"] = "ham";
+    writeBinaryMechanism(original, "generated-species-fields.ctb");
+    auto duplicate = newSolutionFromBinary("generated-species-fields.ctb",
+                                           "mixture-averaged");
+    compareSolutions(original, duplicate);
+    auto thermo2 = duplicate->thermo();
+    for (size_t k = 0; k < thermo->nSpecies(); k++) {
+        EXPECT_EQ(thermo->species(k)->parameters(thermo.get()),
+                  thermo2->species(k)->parameters(thermo2.get()))
+            << thermo->speciesName(k);
+    }
+    EXPECT_EQ(thermo2->species("H2")->input["note"].asString(), "spam");
+    EXPECT_EQ(thermo2->species("O2")->thermo->input()["note"].asString(), "eggs");
+    EXPECT_EQ(thermo2->species("OH")->transport->input["custom-field"].asString(),
+              "ham");
+    EXPECT_FALSE(thermo2->species("H")->thermo->input().hasKey("note"));
+}
+
+TEST(BinaryMechanism, badFiles)
+{
+    EXPECT_THROW(newSolutionFromBinary("h2o2.yaml"), CanteraError);
+    auto original = newSolution("h2o2.yaml", "", "none");
+    writeBinaryMechanism(original, "generated-h2o2.ctb");
+    EXPECT_THROW(newSolution("generated-h2o2.ctb", "spam"), CanteraError);
+
+    // truncated file
+    std::ifstream in("generated-h2o2.ctb", std::ios::binary);
+    string contents((std::istreambuf_iterator<char>(in)),
+                    std::istreambuf_iterator<char>());
+    std::ofstream out("generated-truncated.ctb", std::ios::binary);
+    out << contents.substr(0, contents.size() / 2);
+    out.close();
+    EXPECT_THROW(newSolution("generated-truncated.ctb"), CanteraError);
+}
+
 #if CT_USE_HDF5
 
 TEST(Storage, groups)
@@ -717,6 +852,83 @@ TEST(Storage, readCompressed)
     ASSERT_TRUE(data.isMatrix<string>());
 }
 
+TEST(Storage, appendData)
+{
+    const string fname = "appendData.h5";
+    if (std::ifstream(fname).good()) {
+        std::remove(fname.c_str());
+    }
+    auto file = unique_ptr<Storage>(new Storage(fname, true));
+    file->checkGroup("test", true); // implicitly creates group
+    file->setCompressionLevel(4);
+    file->setShuffle(true);
+    file->setChunkSize(2);
+
+    AnyValue any;
+    any = vector<double>({1.1, 2.2, 3.3});
+    EXPECT_EQ(file->appendData("test", "double-vector", any), 3u);
+    any = vector<long int>({1, 2});
+    EXPECT_EQ(file->appendData("test", "integer-vector", any), 2u);
+    any = vector<string>({"dog", "cat"});
+    EXPECT_EQ(file->appendData("test", "string-vector", any), 2u);
+    any = vector<vector<double>>({{1.1, 2.2}, {3.3, 4.4}});
+    EXPECT_EQ(file->appendData("test", "double-matrix", any), 2u);
+
+    // data sets created by writeData are not extendible
+    any = vector<double>({1.1, 2.2});
+    file->writeData("test", "fixed", any);
+    EXPECT_THROW(file->appendData("test", "fixed", any), CanteraError);
+
+    // inconsistent data types and shapes
+    EXPECT_THROW(file->appendData("test", "string-vector", any), CanteraError);
+    any = vector<vector<double>>({{1.1, 2.2, 3.3}});
+    EXPECT_THROW(file->appendData("test", "double-matrix", any), CanteraError);
+    EXPECT_THROW(file->appendData("test", "double-vector", any), CanteraError);
+    any = vector<vector<double>>({{}, {}});
+    EXPECT_THROW(file->appendData("test", "empty-matrix", any), CanteraError);
+
+    // attributes are only replaced if requested
+    AnyMap meta;
+    meta["size"] = 3;
+    meta["nested"]["label"] = "first";
+    file->writeAttributes("test", meta);
+    meta["size"] = 5;
+    meta["nested"]["label"] = "second";
+    EXPECT_THROW(file->writeAttributes("test", meta), NotImplementedError);
+    file->writeAttributes("test", meta, true);
+
+    // append to existing data sets after reopening the file
+    file = unique_ptr<Storage>(new Storage(fname, true));
+    any = vector<double>({4.4, 5.5});
+    EXPECT_EQ(file->appendData("test", "double-vector", any), 5u);
+    any = vector<long int>();
+    EXPECT_EQ(file->appendData("test", "integer-vector", any), 2u);
+    any = vector<string>({"mouse"});
+    EXPECT_EQ(file->appendData("test", "string-vector", any), 3u);
+    any = vector<vector<double>>({{5.5, 6.6}});
+    EXPECT_EQ(file->appendData("test", "double-matrix", any), 3u);
+
+    file = unique_ptr<Storage>(new Storage(fname, false));
+    auto data = file->readData("test", "double-vector", 5);
+    ASSERT_TRUE(data.isVector<double>());
+    EXPECT_EQ(data.asVector<double>(), vector<double>({1.1, 2.2, 3.3, 4.4, 5.5}));
+    data = file->readData("test", "integer-vector", 2);
+    EXPECT_EQ(data.asVector<long int>(), vector<long int>({1, 2}));
+    data = file->readData("test", "string-vector", 3);
+    EXPECT_EQ(data.asVector<string>(), vector<string>({"dog", "cat", "mouse"}));
+    data = file->readData("test", "double-matrix", 3, 2);
+    ASSERT_TRUE(data.isMatrix<double>());
+    auto& matrix = data.asVector<vector<double>>();
+    EXPECT_EQ(matrix[0], vector<double>({1.1, 2.2}));
+    EXPECT_EQ(matrix[2], vector<double>({5.5, 6.6}));
+
+    AnyMap attr = file->readAttributes("test", true);
+    EXPECT_EQ(attr["size"].asInt(), 5);
+    EXPECT_EQ(attr["nested"]["label"].asString(), "second");
+    file.reset();
+    std::remove(fname.c_str());
+}
+
 #else
 
 TEST(Storage, noSupport)
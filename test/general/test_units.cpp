@@ -2,6 +2,7 @@
 #include "gmock/gmock.h"
 #include "cantera/base/Units.h"
 #include "cantera/base/AnyMap.h"
+#include <thread>
 
 using namespace Cantera;
 using namespace ::testing;
@@ -35,6 +36,40 @@ TEST(Units, from_string_fail) {
     EXPECT_THROW(Units("0.001 m^3", true), CanteraError);
 }
 
+TEST(Units, from_string_cached) {
+    // Repeated parsing of the same string uses the cached result
+    Units first("kJ/mol");
+    for (size_t i = 0; i < 3; i++) {
+        Units again("kJ/mol");
+        EXPECT_TRUE(again == first);
+        EXPECT_DOUBLE_EQ(again.factor(), 1e6);
+    }
+    // Constraints and errors are checked on every use, not only on the first
+    EXPECT_NO_THROW(Units("cm^3"));
+    EXPECT_THROW(Units("cm^3", true), CanteraError);
+    EXPECT_THROW(Units("furlong"), CanteraError);
+    EXPECT_THROW(Units("furlong"), CanteraError);
+
+    // Concurrent parsing gives consistent results
+    vector<string> names = {"kg/m^3", "cal/mol", "0.001 m^3/kmol/s", "atm", "eV"};
+    vector<vector<double>> factors(4, vector<double>(names.size()));
+    vector<std::thread> threads;
+    for (size_t i = 0; i < factors.size(); i++) {
+        threads.emplace_back([&names, &out=factors[i]]() {
+            for (size_t j = 0; j < names.size(); j++) {
+                out[j] = Units(names[j]).factor();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (size_t i = 1; i < factors.size(); i++) {
+        EXPECT_EQ(factors[i], factors[0]);
+    }
+    EXPECT_DOUBLE_EQ(factors[0][1], 4184.0);
+}
+
 TEST(Units, convert_to_base_units) {
     UnitSystem U;
     EXPECT_DOUBLE_EQ(U.convert(1.0, "Pa", "kg/m/s^2"), 1.0);
@@ -6,13 +6,18 @@
 #include "cantera/kinetics/ReactionRateFactory.h"
 #include "cantera/kinetics/Reaction.h"
 #include "cantera/kinetics/Arrhenius.h"
+#include "cantera/kinetics/BatchSurfChem.h"
+#include "cantera/kinetics/ButlerVolmerEvaluator.h"
 #include "cantera/kinetics/ChebyshevRate.h"
 #include "cantera/kinetics/Custom.h"
 #include "cantera/kinetics/ElectronCollisionPlasmaRate.h"
 #include "cantera/kinetics/Falloff.h"
+#include "cantera/kinetics/ImplicitSurfChem.h"
+#include "cantera/kinetics/InterfaceKinetics.h"
 #include "cantera/kinetics/InterfaceRate.h"
 #include "cantera/kinetics/PlogRate.h"
 #include "cantera/kinetics/TwoTempPlasmaRate.h"
+#include "cantera/thermo/Species.h"
 #include "cantera/thermo/SurfPhase.h"
 #include "cantera/thermo/ThermoFactory.h"
 #include "cantera/base/Array.h"
@@ -687,6 +692,610 @@ TEST(Kinetics, ElectrochemFromYaml)
     EXPECT_NEAR(ropr[0], 0.045559670, 1e-8);
 }
 
+void checkPseudoSteadyState(shared_ptr<Interface> soln)
+{
+    auto kin = std::dynamic_pointer_cast<InterfaceKinetics>(soln->kinetics());
+    auto surf = std::dynamic_pointer_cast<SurfPhase>(soln->thermo());
+    size_t nsp = surf->nSpecies();
+    auto gas = soln->adjacent(0)->thermo();
+    gas->setState_TP(surf->temperature(), gas->pressure());
+    vector<double> theta0(nsp), theta1(nsp), theta2(nsp);
+    vector<double> wdot(kin->nTotalSpecies()), ropf(kin->nReactions());
+    surf->getCoverages(theta0.data());
+
+    kin->solvePseudoSteadyStateProblem();
+    surf->getCoverages(theta1.data());
+    kin->getNetProductionRates(wdot.data());
+    kin->getFwdRatesOfProgress(ropf.data());
+    double scale = *std::max_element(ropf.begin(), ropf.end());
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(wdot[k] / scale, 0.0, 1e-6) << surf->speciesName(k);
+    }
+
+    // Repeated calls start from the previous solution
+    kin->solvePseudoSteadyStateProblem();
+    surf->getCoverages(theta2.data());
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(theta2[k], theta1[k], 1e-8) << surf->speciesName(k);
+    }
+
+    // Start again from the initial coverages
+    surf->setCoverages(theta0.data());
+    kin->solvePseudoSteadyStateProblem();
+    surf->getCoverages(theta2.data());
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(theta2[k], theta1[k], 1e-8) << surf->speciesName(k);
+    }
+}
+
+TEST(Kinetics, PseudoSteadyStateAnalyticJacobian)
+{
+    checkPseudoSteadyState(newInterface("diamond.yaml", "diamond_100"));
+}
+
+TEST(Kinetics, PseudoSteadyStateCoverageDependence)
+{
+    checkPseudoSteadyState(newInterface("methane_pox_on_pt.yaml", "Pt_surf"));
+}
+
+TEST(Kinetics, PseudoSteadyStateMultiSiteSpecies)
+{
+    // The unknowns of the surface problem are the species concentrations, which
+    // solveSP sets as mole fractions scaled by the site density. Check that the
+    // analytic derivatives used for its Jacobian agree with finite differences
+    // with respect to these unknowns for species occupying several sites.
+    auto soln = newInterface("SiF4_NH3_mec.yaml", "SI3N4");
+    auto kin = std::dynamic_pointer_cast<InterfaceKinetics>(soln->kinetics());
+    auto surf = std::dynamic_pointer_cast<SurfPhase>(soln->thermo());
+    auto gas = soln->adjacent(0)->thermo();
+    surf->setState_TP(1500.0, OneAtm);
+    gas->setState_TPX(1500.0, OneAtm, "NH3:0.4, SIF4:0.1, HF:0.1, H2:0.2, N2:0.2");
+    surf->setCoveragesByName("HN_SIF(S):0.2, HN_NH2(S):0.2, F3SI_NH2(S):0.2, "
+                             "F2SINH(S):0.1, H2NFSINH(S):0.1, HN(FSINH)2(S):0.2");
+    size_t nsp = surf->nSpecies();
+    size_t nTotal = kin->nTotalSpecies();
+    double n0 = surf->siteDensity();
+
+    vector<double> conc(nsp), X(nsp), wdot1(nTotal), wdot2(nTotal);
+    surf->getConcentrations(conc.data());
+    Eigen::MatrixXd dwdot = kin->netProductionRates_ddCi();
+    auto setConcentrations = [&](const vector<double>& C) {
+        for (size_t k = 0; k < nsp; k++) {
+            X[k] = C[k] / n0;
+        }
+        surf->setMoleFractions_NoNorm(X.data());
+    };
+    double scale = 0.0;
+    for (size_t j = 0; j < nsp; j++) {
+        for (size_t k = 0; k < nsp; k++) {
+            scale = std::max(scale, std::abs(dwdot(k, j) * conc[j]));
+        }
+    }
+
+    for (size_t j = 0; j < nsp; j++) {
+        vector<double> conc1 = conc;
+        double dC = 1e-6 * conc[j];
+        conc1[j] = conc[j] + dC;
+        setConcentrations(conc1);
+        kin->getNetProductionRates(wdot1.data());
+        conc1[j] = conc[j] - dC;
+        setConcentrations(conc1);
+        kin->getNetProductionRates(wdot2.data());
+        for (size_t k = 0; k < nsp; k++) {
+            double fd = (wdot1[k] - wdot2[k]) / (2 * dC);
+            EXPECT_NEAR(dwdot(k, j) * conc[j], fd * conc[j], 1e-6 * scale)
+                << surf->speciesName(k) << " / " << surf->speciesName(j);
+        }
+    }
+    setConcentrations(conc);
+
+    checkPseudoSteadyState(soln);
+}
+
+void checkSurfaceDerivatives(shared_ptr<Interface> soln, double rtol=1e-5)
+{
+    // Compare analytic derivatives of the net rates of progress against central
+    // finite differences. Derivatives are scaled by the full-coverage site
+    // concentration, the total gas concentration, or the temperature, respectively.
+    auto kin = std::dynamic_pointer_cast<InterfaceKinetics>(soln->kinetics());
+    auto surf = std::dynamic_pointer_cast<SurfPhase>(soln->thermo());
+    auto gas = soln->adjacent(0)->thermo();
+    gas->setState_TP(surf->temperature(), gas->pressure());
+    size_t nsurf = surf->nSpecies();
+    size_t ngas = gas->nSpecies();
+    size_t nr = kin->nReactions();
+    size_t start = kin->kineticsSpeciesIndex(0, 1);
+    double T = surf->temperature();
+    double rho = gas->density();
+    double Ctot = gas->molarDensity();
+
+    vector<double> theta(nsurf), conc(ngas), ropf(nr), ropr(nr), rop1(nr), rop2(nr);
+    surf->getCoverages(theta.data());
+    gas->getConcentrations(conc.data());
+    kin->getFwdRatesOfProgress(ropf.data());
+    kin->getRevRatesOfProgress(ropr.data());
+    Eigen::MatrixXd drop = kin->netRatesOfProgress_ddCi();
+    vector<double> dropdT(nr);
+    kin->getNetRatesOfProgress_ddT(dropdT.data());
+
+    auto check = [&](double analytic, double fd, size_t i, const string& var) {
+        double tol = rtol * (std::abs(fd) + std::max(ropf[i], ropr[i]));
+        EXPECT_NEAR(analytic, fd, tol) << kin->reaction(i)->equation() << " / " << var;
+    };
+
+    // Derivatives with respect to concentrations of surface species
+    double dtheta = 1e-6;
+    for (size_t j = 0; j < nsurf; j++) {
+        vector<double> theta1 = theta;
+        theta1[j] = theta[j] + dtheta;
+        surf->setCoveragesNoNorm(theta1.data());
+        kin->getNetRatesOfProgress(rop1.data());
+        theta1[j] = theta[j] - dtheta;
+        surf->setCoveragesNoNorm(theta1.data());
+        kin->getNetRatesOfProgress(rop2.data());
+        double Cmax = surf->siteDensity() / surf->size(j);
+        for (size_t i = 0; i < nr; i++) {
+            double fd = (rop1[i] - rop2[i]) / (2 * dtheta);
+            check(drop(i, j) * Cmax, fd, i, surf->speciesName(j));
+        }
+    }
+    surf->setCoveragesNoNorm(theta.data());
+
+    // Derivatives with respect to concentrations of gas phase species
+    double dC = 1e-6 * Ctot;
+    for (size_t j = 0; j < ngas; j++) {
+        vector<double> conc1 = conc;
+        conc1[j] = conc[j] + dC;
+        gas->setConcentrations(conc1.data());
+        kin->getNetRatesOfProgress(rop1.data());
+        conc1[j] = conc[j] - dC;
+        gas->setConcentrations(conc1.data());
+        kin->getNetRatesOfProgress(rop2.data());
+        for (size_t i = 0; i < nr; i++) {
+            double fd = (rop1[i] - rop2[i]) / (2 * dC) * Ctot;
+            check(drop(i, start + j) * Ctot, fd, i, gas->speciesName(j));
+        }
+    }
+    gas->setConcentrations(conc.data());
+
+    // Temperature derivatives at constant concentrations
+    double dT = 1e-6 * T;
+    for (double Tnew : {T + dT, T - dT}) {
+        surf->setState_TP(Tnew, surf->pressure());
+        surf->setCoveragesNoNorm(theta.data());
+        gas->setState_TD(Tnew, rho);
+        kin->getNetRatesOfProgress(Tnew > T ? rop1.data() : rop2.data());
+    }
+    for (size_t i = 0; i < nr; i++) {
+        double fd = (rop1[i] - rop2[i]) / (2 * dT) * T;
+        check(dropdT[i] * T, fd, i, "T");
+    }
+}
+
+TEST(Kinetics, InterfaceDerivatives)
+{
+    auto soln = newInterface("methane_pox_on_pt.yaml", "Pt_surf");
+    soln->adjacent(0)->thermo()->setState_TPX(900.0, OneAtm, "CH4:0.1, O2:0.2, "
+        "CO:0.05, H2:0.05, H2O:0.1, CO2:0.1, AR:0.4");
+    auto surf = std::dynamic_pointer_cast<SurfPhase>(soln->thermo());
+    surf->setState_TP(900.0, OneAtm);
+    surf->setCoveragesByName(
+        "PT(S):0.4, H(S):0.1, O(S):0.2, CO(S):0.15, OH(S):0.05, H2O(S):0.05, "
+        "C(S):0.02, CH3(S):0.03");
+    checkSurfaceDerivatives(soln);
+}
+
+TEST(Kinetics, InterfacePhaseStateUpdates)
+{
+    // Rates evaluated after changing the state of individual phases must match
+    // the rates obtained after discarding all cached phase properties
+    auto soln = newInterface("methane_pox_on_pt.yaml", "Pt_surf");
+    auto kin = soln->kinetics();
+    auto gas = soln->adjacent(0)->thermo();
+    auto surf = std::dynamic_pointer_cast<SurfPhase>(soln->thermo());
+    gas->setState_TPX(900.0, OneAtm, "CH4:0.1, O2:0.2, H2O:0.1, CO2:0.1, AR:0.5");
+    surf->setState_TP(900.0, OneAtm);
+    surf->setCoveragesByName("PT(S):0.5, H(S):0.1, O(S):0.2, CO(S):0.2");
+
+    size_t nsp = kin->nTotalSpecies();
+    vector<double> wdot(nsp), wdotRef(nsp);
+    auto check = [&]() {
+        kin->getNetProductionRates(wdot.data());
+        kin->invalidateCache();
+        kin->getNetProductionRates(wdotRef.data());
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_DOUBLE_EQ(wdot[k], wdotRef[k]) << kin->kineticsSpeciesName(k);
+        }
+        return wdot;
+    };
+
+    auto w0 = check();
+    gas->setState_TP(900.0, 2 * OneAtm); // density only
+    auto w1 = check();
+    EXPECT_NE(w0[kin->kineticsSpeciesIndex("CH4")],
+              w1[kin->kineticsSpeciesIndex("CH4")]);
+    gas->setMoleFractionsByName("CH4:0.2, O2:0.1, H2O:0.1, CO2:0.1, AR:0.5");
+    check();
+    surf->setCoveragesByName("PT(S):0.6, H(S):0.1, O(S):0.1, CO(S):0.2");
+    check();
+    surf->setState_TP(950.0, OneAtm);
+    gas->setState_TP(950.0, OneAtm);
+    check();
+    gas->setState_TD(900.0, gas->density());
+    surf->setState_TP(900.0, OneAtm);
+    check();
+}
+
+TEST(Kinetics, InterfaceSpeciesModification)
+{
+    // Modifying the thermo data of a species must update the equilibrium constants
+    // of reversible reactions without any change of the phase state
+    auto soln = newInterface("ptcombust.yaml", "Pt_surf");
+    auto kin = soln->kinetics();
+    auto surf = std::dynamic_pointer_cast<SurfPhase>(soln->thermo());
+    soln->adjacent(0)->thermo()->setState_TPX(900.0, OneAtm, "H2:0.1, O2:0.1, AR:0.8");
+    surf->setState_TP(900.0, OneAtm);
+    surf->setCoveragesByName("PT(S):0.5, H(S):0.1, O(S):0.1, OH(S):0.2, H2O(S):0.1");
+
+    size_t nr = kin->nReactions();
+    vector<double> kr0(nr), kr1(nr), krRef(nr), wdot0(kin->nTotalSpecies());
+    vector<double> wdot1(kin->nTotalSpecies());
+    kin->getRevRateConstants(kr0.data());
+    kin->getNetProductionRates(wdot0.data());
+
+    size_t kOH = surf->speciesIndex("OH(S)");
+    AnyMap data = surf->species(kOH)->parameters(surf.get());
+    data.applyUnits();
+    auto coeffs = data["thermo"]["data"].asVector<vector<double>>();
+    for (auto& c : coeffs) {
+        c[5] -= 2000.0; // more stable OH(S)
+    }
+    data["thermo"]["data"] = coeffs;
+    surf->modifySpecies(kOH, newSpecies(data));
+
+    kin->getRevRateConstants(kr1.data());
+    kin->getNetProductionRates(wdot1.data());
+    kin->invalidateCache();
+    kin->getRevRateConstants(krRef.data());
+    size_t irxn = 11; // H(S) + O(S) <=> OH(S) + PT(S)
+    ASSERT_EQ(kin->reaction(irxn)->equation(), "H(S) + O(S) <=> OH(S) + PT(S)");
+    EXPECT_NE(kr1[irxn], kr0[irxn]);
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_DOUBLE_EQ(kr1[i], krRef[i]) << kin->reaction(i)->equation();
+    }
+    size_t kOHkin = kin->kineticsSpeciesIndex("OH(S)");
+    EXPECT_NE(wdot1[kOHkin], wdot0[kOHkin]);
+}
+
+TEST(Kinetics, CoverageDependentThermoDerivatives)
+{
+    AnyMap root = AnyMap::fromYamlString(R"(
+        units: {length: cm, quantity: mol, activation-energy: kJ/mol}
+        phases:
+        - name: covdep
+          thermo: coverage-dependent-surface
+          species: [Pt, OC_Pt, CO2_Pt, O_Pt]
+          kinetics: surface
+          reactions: [reactions]
+          site-density: 2.72e-09
+          reference-state-coverage: 0.22
+        species:
+        - name: Pt
+          composition: {Pt: 1}
+          thermo:
+            model: NASA7
+            temperature-ranges: [100.0, 1554.81, 5000.0]
+            data:
+            - [7.10129478e-03, -4.25609798e-05, 8.98507278e-08, -7.80169595e-11,
+              2.32458299e-14, -0.876096726, -0.0311207473]
+            - [0.16030291, -2.52239722e-04, 1.14183461e-07, -1.21476333e-11,
+              3.85825979e-16, -70.8116648, -0.909545048]
+        - name: OC_Pt
+          composition: {Pt: 1, C: 1, O: 1}
+          thermo:
+            model: NASA7
+            temperature-ranges: [100.0, 891.33, 5000.0]
+            data:
+            - [-1.38214121, 0.0375305409, -8.29758476e-05, 8.09701555e-08,
+              -2.85470829e-11, -3.45176032e+04, 4.3544767]
+            - [1.3809066, 8.0571901e-03, -4.6430896e-06, 8.91170699e-10,
+              -5.90048361e-14, -3.43319289e+04, -4.85318015]
+          coverage-dependencies:
+            OC_Pt: {model: linear, units: {energy: kJ, quantity: mol},
+                    enthalpy: -15.0, entropy: -0.01}
+            O_Pt: {model: piecewise-linear, units: {energy: kJ, quantity: mol},
+                   enthalpy-low: 5.0, enthalpy-high: 20.0, enthalpy-change: 0.3,
+                   entropy-low: 0.0, entropy-high: -0.02, entropy-change: 0.3,
+                   heat-capacity-a: 0.002, heat-capacity-b: -0.0156}
+        - name: CO2_Pt
+          composition: {Pt: 1, C: 1, O: 2}
+          thermo:
+            model: NASA7
+            temperature-ranges: [100.0, 953.59, 5000.0]
+            data:
+            - [3.09268931, 5.2927875e-03, 8.99447254e-06, -1.67129326e-08,
+              7.04909721e-12, -4.52128353e+04, -5.10056355]
+            - [5.99803259, 2.27485222e-03, -6.81092723e-07, 1.34432446e-10,
+              -1.11509701e-14, -4.61838262e+04, -21.1649844]
+        - name: O_Pt
+          composition: {Pt: 1, O: 1}
+          thermo:
+            model: NASA7
+            temperature-ranges: [100.0, 888.26, 5000.0]
+            data:
+            - [-0.759013067, 0.0189868498, -3.82473745e-05, 3.43558395e-08,
+              -1.13974372e-11, -1.72389494e+04, 1.76017396]
+            - [1.89893619, 2.03295425e-03, -1.19976574e-06, 2.32680659e-10,
+              -1.53508282e-14, -1.75144954e+04, -9.6410408]
+          coverage-dependencies:
+            O_Pt: {model: polynomial, units: {energy: kJ, quantity: mol},
+                   enthalpy-coefficients: [-10.0, 5.0, 0.0, 3.0],
+                   entropy-coefficients: [0.01, 0.0, -0.005, 0.0]}
+            OC_Pt: {model: interpolative, units: {energy: kJ, quantity: mol},
+                    enthalpy-coverages: [0.0, 0.2, 0.5, 1.0],
+                    enthalpies: [0.0, 2.0, 8.0, 20.0],
+                    entropy-coverages: [0.0, 0.5, 1.0],
+                    entropies: [0.0, -0.01, -0.03]}
+        reactions:
+        - equation: CO + Pt <=> OC_Pt
+          sticking-coefficient: {A: 0.84, b: 0.0, Ea: 0.0}
+        - equation: O2 + Pt + Pt <=> O_Pt + O_Pt
+          sticking-coefficient: {A: 0.07, b: 0.0, Ea: 0.0}
+          Motz-Wise: true
+        - equation: OC_Pt + O_Pt <=> CO2_Pt + Pt
+          rate-constant: {A: 3.7e+20, b: 0.0, Ea: 60.0}
+          coverage-dependencies:
+            OC_Pt: {a: 0.0, m: 0.0, E: -10.0}
+            O_Pt: {a: 0.1, m: 0.5, E: [5.0, -2.0, 1.0, 0.5]}
+        - equation: CO2_Pt <=> CO2 + Pt
+          rate-constant: {A: 1.0e+13, b: 0.0, Ea: 20.5}
+    )");
+    auto gas = newSolution("gri30.yaml", "gri30", "none");
+    gas->thermo()->setState_TPX(700.0, OneAtm, "CO:0.1, O2:0.2, CO2:0.05, AR:0.65");
+    auto soln = newInterface(root["phases"].getMapWhere("name", "covdep"), root,
+                             {gas});
+    auto surf = std::dynamic_pointer_cast<SurfPhase>(soln->thermo());
+    surf->setState_TP(700.0, OneAtm);
+    // coverages are chosen away from the nodes of the piecewise-linear models
+    surf->setCoveragesByName("Pt:0.48, OC_Pt:0.26, CO2_Pt:0.07, O_Pt:0.19");
+    checkSurfaceDerivatives(soln);
+}
+
+class BatchSurfChemTest : public testing::Test
+{
+public:
+    BatchSurfChemTest() {
+        soln = newInterface("methane_pox_on_pt.yaml", "Pt_surf");
+        gas = soln->adjacent(0)->thermo();
+        surf = std::dynamic_pointer_cast<SurfPhase>(soln->thermo());
+        batch = make_unique<BatchSurfChem>(soln, 3);
+        for (size_t i = 0; i < 3; i++) {
+            double T = 800.0 + 100.0 * i;
+            gas->setState_TPX(T, OneAtm, "CH4:0.1, O2:0.2, CO:0.05, H2:0.05, "
+                              "H2O:0.1, CO2:0.1, AR:0.4");
+            surf->setState_TP(T, OneAtm);
+            surf->setCoveragesByName(
+                "PT(S):0.4, H(S):0.1, O(S):0.2, CO(S):0.15, OH(S):0.05, "
+                "H2O(S):0.05, C(S):0.02, CH3(S):0.03");
+            batch->storeState(i);
+        }
+    }
+
+    shared_ptr<Interface> soln;
+    shared_ptr<ThermoPhase> gas;
+    shared_ptr<SurfPhase> surf;
+    unique_ptr<BatchSurfChem> batch;
+};
+
+TEST_F(BatchSurfChemTest, eval)
+{
+    size_t nsp = batch->nSurfSpecies();
+    ASSERT_EQ(batch->neq(), 3 * nsp);
+    vector<double> y(batch->neq()), ydot(batch->neq()), ydot2(batch->neq());
+    batch->getState(y.data());
+    batch->eval(0.0, y.data(), ydot.data(), nullptr);
+
+    vector<double> wdot(soln->kinetics()->nTotalSpecies());
+    for (size_t i = 0; i < 3; i++) {
+        batch->restoreState(i);
+        EXPECT_DOUBLE_EQ(gas->temperature(), 800.0 + 100.0 * i);
+        soln->kinetics()->getNetProductionRates(wdot.data());
+        double sum = 0.0;
+        for (size_t k = 0; k < nsp; k++) {
+            sum += ydot[i * nsp + k];
+            if (k > 0) {
+                EXPECT_NEAR(ydot[i * nsp + k],
+                            wdot[k] * surf->size(k) / surf->siteDensity(),
+                            1e-12 * std::abs(ydot[i * nsp + k]));
+            }
+        }
+        EXPECT_NEAR(sum, 0.0, 1e-12 * std::abs(ydot[i * nsp]));
+    }
+
+    batch->setThreads(2);
+    batch->eval(0.0, y.data(), ydot2.data(), nullptr);
+    for (size_t n = 0; n < batch->neq(); n++) {
+        EXPECT_DOUBLE_EQ(ydot[n], ydot2[n]);
+    }
+}
+
+TEST_F(BatchSurfChemTest, BlockJacobian)
+{
+    size_t nsp = batch->nSurfSpecies();
+    vector<double> y(batch->neq()), ydot0(batch->neq()), ydot1(batch->neq());
+    vector<double> jac(nsp * nsp);
+    batch->getState(y.data());
+    batch->eval(0.0, y.data(), ydot0.data(), nullptr);
+    for (size_t i = 0; i < 3; i++) {
+        batch->getBlockJacobian(i, jac.data());
+        for (size_t j = 0; j < nsp; j++) {
+            double theta = y[i * nsp + j];
+            double delta = 1e-6 * std::max(theta, 1e-3);
+            y[i * nsp + j] = theta + delta;
+            batch->eval(0.0, y.data(), ydot1.data(), nullptr);
+            y[i * nsp + j] = theta;
+            for (size_t n = 0; n < batch->neq(); n++) {
+                double fd = (ydot1[n] - ydot0[n]) / delta;
+                if (n / nsp != i) {
+                    // blocks are not coupled
+                    EXPECT_EQ(fd, 0.0);
+                    continue;
+                }
+                size_t k = n % nsp;
+                EXPECT_NEAR(jac[k + nsp * j], fd,
+                            1e-4 * std::abs(fd) + 1e-8 * std::abs(ydot0[n]) / delta)
+                    << "block " << i << ", row " << k << ", column " << j;
+            }
+        }
+    }
+}
+
+TEST_F(BatchSurfChemTest, integrate)
+{
+    size_t nsp = batch->nSurfSpecies();
+    batch->setThreads(2);
+    batch->integrate(0.0, 1e-3);
+
+    vector<double> theta(nsp), expected(nsp);
+    auto kin = std::dynamic_pointer_cast<InterfaceKinetics>(soln->kinetics());
+    for (size_t i = 0; i < 3; i++) {
+        double T = 800.0 + 100.0 * i;
+        gas->setState_TPX(T, OneAtm, "CH4:0.1, O2:0.2, CO:0.05, H2:0.05, "
+                          "H2O:0.1, CO2:0.1, AR:0.4");
+        surf->setState_TP(T, OneAtm);
+        surf->setCoveragesByName(
+            "PT(S):0.4, H(S):0.1, O(S):0.2, CO(S):0.15, OH(S):0.05, "
+            "H2O(S):0.05, C(S):0.02, CH3(S):0.03");
+        kin->advanceCoverages(1e-3);
+        surf->getCoverages(expected.data());
+        batch->getCoverages(i, theta.data());
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(theta[k], expected[k], 1e-5 * expected[k] + 1e-10)
+                << "block " << i << ", species " << surf->speciesName(k);
+        }
+    }
+}
+
+TEST(ImplicitSurfChem, eval_multiple_surfaces)
+{
+    // Each surface has its own block of the state vector, and the rate for the
+    // first species of each block makes the sum over that block zero
+    vector<shared_ptr<Interface>> solns;
+    vector<InterfaceKinetics*> kins;
+    for (size_t i = 0; i < 2; i++) {
+        solns.push_back(newInterface("methane_pox_on_pt.yaml", "Pt_surf"));
+        double T = 800.0 + 200.0 * i;
+        solns[i]->adjacent(0)->thermo()->setState_TPX(T, OneAtm,
+            "CH4:0.1, O2:0.2, CO:0.05, H2:0.05, H2O:0.1, CO2:0.1, AR:0.4");
+        solns[i]->thermo()->setState_TP(T, OneAtm);
+        kins.push_back(dynamic_cast<InterfaceKinetics*>(solns[i]->kinetics().get()));
+    }
+    std::dynamic_pointer_cast<SurfPhase>(solns[1]->thermo())->setCoveragesByName(
+        "PT(S):0.4, H(S):0.1, O(S):0.2, CO(S):0.15, OH(S):0.05, H2O(S):0.05, "
+        "C(S):0.02, CH3(S):0.03");
+    ImplicitSurfChem integ(kins);
+    size_t nsp = solns[0]->thermo()->nSpecies();
+    ASSERT_EQ(integ.neq(), 2 * nsp);
+    vector<double> y(integ.neq()), ydot(integ.neq());
+    integ.getState(y.data());
+    integ.eval(0.0, y.data(), ydot.data(), nullptr);
+
+    for (size_t i = 0; i < 2; i++) {
+        auto surf = std::dynamic_pointer_cast<SurfPhase>(solns[i]->thermo());
+        vector<double> wdot(kins[i]->nTotalSpecies());
+        kins[i]->getNetProductionRates(wdot.data());
+        double sum = 0.0;
+        for (size_t k = 1; k < nsp; k++) {
+            double expected = wdot[k] * surf->size(k) / surf->siteDensity();
+            EXPECT_NEAR(ydot[i * nsp + k], expected, 1e-12 * std::abs(expected))
+                << "surface " << i << ", species " << k;
+            sum += expected;
+        }
+        EXPECT_NEAR(ydot[i * nsp], -sum, 1e-12 * std::abs(sum)) << "surface " << i;
+    }
+}
+
+TEST(ButlerVolmerEvaluator, LithiumIonAnode)
+{
+    auto soln = newInterface("lithium_ion_battery.yaml", "edge_anode_electrolyte");
+    auto kin = soln->kinetics();
+    auto& anode = kin->thermo(kin->phaseIndex("anode"));
+    auto& electron = kin->thermo(kin->phaseIndex("electron"));
+    auto& elyte = kin->thermo(kin->phaseIndex("electrolyte"));
+    size_t iLi = kin->kineticsSpeciesIndex("Li+[elyt]");
+    anode.setMoleFractionsByName("Li[anode]:0.4, V[anode]:0.6");
+    // electrolyte potential close to the equilibrium potential of the electrode
+    elyte.setElectricPotential(2.9);
+
+    ButlerVolmerEvaluator bv(soln, "electron", "Li+[elyt]");
+    EXPECT_EQ(bv.nChargeTransferReactions(), 1u);
+
+    vector<double> T{298.15, 298.15, 310.0, 310.0};
+    vector<double> phi{-0.1, -0.02, 0.01, 0.05};
+    vector<double> xLi{0.05, 0.1, 0.08, 0.02};
+    size_t nNodes = T.size();
+    vector<double> conc(nNodes), ref(nNodes), actConc(kin->nTotalSpecies());
+    for (size_t i = 0; i < nNodes; i++) {
+        for (size_t n = 0; n < kin->nPhases(); n++) {
+            kin->thermo(n).setState_TP(T[i], OneAtm);
+        }
+        elyte.setMoleFractionsByName(fmt::format(
+            "C3H4O3[elyt]:0.45, C4H6O3[elyt]:0.45, Li+[elyt]:{0}, PF6-[elyt]:{0}",
+            xLi[i]));
+        electron.setElectricPotential(phi[i]);
+        kin->getActivityConcentrations(actConc.data());
+        conc[i] = actConc[iLi];
+        ref[i] = kin->interfaceCurrent(kin->phaseIndex("electron"));
+    }
+
+    vector<double> current(nNodes), dphi(nNodes), dconc(nNodes);
+    bv.eval(nNodes, T.data(), conc.data(), phi.data(), current.data(), dphi.data(),
+            dconc.data());
+    EXPECT_EQ(bv.nCachedTemperatures(), 2u);
+    for (size_t i = 0; i < nNodes; i++) {
+        EXPECT_NEAR(current[i], ref[i], 1e-10 * std::abs(ref[i]));
+    }
+
+    // Derivatives
+    vector<double> cur1(nNodes), cur2(nNodes), pert(nNodes);
+    for (size_t i = 0; i < nNodes; i++) {
+        pert[i] = phi[i] + 1e-6;
+    }
+    bv.eval(nNodes, T.data(), conc.data(), pert.data(), cur1.data());
+    for (size_t i = 0; i < nNodes; i++) {
+        pert[i] = phi[i] - 1e-6;
+    }
+    bv.eval(nNodes, T.data(), conc.data(), pert.data(), cur2.data());
+    for (size_t i = 0; i < nNodes; i++) {
+        double fd = (cur1[i] - cur2[i]) / 2e-6;
+        EXPECT_NEAR(dphi[i], fd, 1e-6 * std::abs(fd));
+    }
+    for (size_t i = 0; i < nNodes; i++) {
+        pert[i] = conc[i] * (1 + 1e-6);
+    }
+    bv.eval(nNodes, T.data(), pert.data(), phi.data(), cur1.data());
+    for (size_t i = 0; i < nNodes; i++) {
+        pert[i] = conc[i] * (1 - 1e-6);
+    }
+    bv.eval(nNodes, T.data(), pert.data(), phi.data(), cur2.data());
+    for (size_t i = 0; i < nNodes; i++) {
+        double fd = (cur1[i] - cur2[i]) / (2e-6 * conc[i]);
+        EXPECT_NEAR(dconc[i], fd, 1e-6 * std::abs(fd));
+    }
+
+    // Changing the state of the electrode invalidates the stored rate factors
+    anode.setMoleFractionsByName("Li[anode]:0.7, V[anode]:0.3");
+    kin->getActivityConcentrations(actConc.data());
+    double T0 = anode.temperature();
+    double c0 = actConc[iLi];
+    double phi0 = electron.electricPotential();
+    double cur0;
+    bv.eval(1, &T0, &c0, &phi0, &cur0);
+    EXPECT_EQ(bv.nCachedTemperatures(), 1u);
+    double ref0 = kin->interfaceCurrent(kin->phaseIndex("electron"));
+    EXPECT_NEAR(cur0, ref0, 1e-10 * std::abs(ref0));
+}
+
 TEST(KineticsFromYaml, NoKineticsModelOrReactionsField1)
 {
     auto soln = newSolution("phase-reaction-spec1.yaml",
@@ -782,6 +1391,204 @@ TEST(KineticsFromYaml, InvalidExtension)
                  CanteraError);
 }
 
+TEST(KineticsFromYaml, ConcurrentSetup)
+{
+    // Reactions are created concurrently and added in a single batch. Compare
+    // with adding the same reactions one at a time.
+    auto sol = newSolution("nDodecane_Reitz.yaml", "", "none");
+    auto kin = sol->kinetics();
+    auto root = AnyMap::fromYamlFile("nDodecane_Reitz.yaml");
+    auto serial = newKinetics("bulk");
+    serial->addThermo(sol->thermo());
+    serial->init();
+    for (auto& R : root["reactions"].asVector<AnyMap>()) {
+        serial->addReaction(newReaction(R, *serial), false);
+    }
+    serial->resizeReactions();
+
+    ASSERT_EQ(kin->nReactions(), serial->nReactions());
+    sol->thermo()->setState_TP(1200, 2 * OneAtm);
+    vector<double> kf(kin->nReactions()), kf_serial(kin->nReactions());
+    kin->getFwdRateConstants(kf.data());
+    serial->getFwdRateConstants(kf_serial.data());
+    for (size_t i = 0; i < kin->nReactions(); i++) {
+        EXPECT_EQ(kin->reaction(i)->equation(), serial->reaction(i)->equation());
+        EXPECT_DOUBLE_EQ(kf[i], kf_serial[i]) << kin->reaction(i)->equation();
+    }
+
+    // Batch addition skipping reactions with undeclared species
+    auto thermo = newThermo("h2o2.yaml");
+    auto kin2 = newKinetics("bulk");
+    kin2->addThermo(thermo);
+    kin2->init();
+    kin2->skipUndeclaredSpecies(true);
+    vector<shared_ptr<Reaction>> reactions;
+    auto rate = make_shared<ArrheniusRate>(3.87e1, 2.7, 2.619184e+07);
+    reactions.push_back(make_shared<Reaction>("H2 + O <=> H + OH", rate));
+    reactions.push_back(make_shared<Reaction>("CH4 + O <=> CH3 + OH",
+        make_shared<ArrheniusRate>(1.02e6, 1.5, 3.6e7)));
+    EXPECT_EQ(kin2->addReactions(reactions), 1u);
+    EXPECT_EQ(kin2->nReactions(), 1u);
+
+    // Errors for individual reactions do not prevent adding later reactions
+    kin2->skipUndeclaredSpecies(false);
+    reactions.push_back(make_shared<Reaction>("H + O2 <=> O + OH",
+        make_shared<ArrheniusRate>(2.65e13, -0.67, 6.29e7)));
+    vector<string> errors;
+    EXPECT_EQ(kin2->addReactions(reactions, false, &errors), 2u);
+    EXPECT_EQ(kin2->nReactions(), 3u);
+    ASSERT_EQ(errors.size(), 1u);
+    EXPECT_NE(errors[0].find("CH4"), string::npos);
+    EXPECT_EQ(kin2->reaction(2)->equation(), "H + O2 <=> O + OH");
+    EXPECT_THROW(kin2->addReactions(reactions), CanteraError);
+}
+
+TEST(KineticsFromYaml, FalloffEvaluators)
+{
+    // Rate constants evaluated for all Troe and SRI reactions at once match
+    // evaluations of individual rate objects
+    for (string mech : {"gri30.yaml", "sri-falloff.yaml",
+                        "chemically-activated-reaction.yaml"})
+    {
+        auto sol = newSolution(mech, "", "none");
+        auto thermo = sol->thermo();
+        auto kin = sol->kinetics();
+        vector<double> X(thermo->nSpecies(), 1.0);
+        vector<double> kf(kin->nReactions()), concm(kin->nReactions());
+        size_t nFalloff = 0;
+        for (double T : {300.0, 900.0, 1800.0}) {
+            for (double P : {0.01 * OneAtm, OneAtm, 100 * OneAtm}) {
+                thermo->setState_TPX(T, P, X.data());
+                kin->getFwdRateConstants(kf.data());
+                kin->getThirdBodyConcentrations(concm.data());
+                for (size_t i = 0; i < kin->nReactions(); i++) {
+                    auto rate = kin->reaction(i)->rate();
+                    if (rate->subType() != "Troe" && rate->subType() != "SRI") {
+                        continue;
+                    }
+                    double expected = rate->eval(T, concm[i]);
+                    EXPECT_NEAR(kf[i], expected, 1e-13 * std::abs(expected))
+                        << mech << ": " << kin->reaction(i)->equation();
+                    nFalloff++;
+                }
+            }
+        }
+        EXPECT_GT(nFalloff, 0u) << mech;
+    }
+}
+
+TEST(KineticsFromYaml, PressureDependentEvaluators)
+{
+    // Rate constants evaluated for all PLOG and Chebyshev reactions at once match
+    // evaluations of individual rate objects, including after pressure changes
+    // that move reactions between pressure intervals in both directions
+    auto sol = newSolution("pdep-test.yaml", "", "none");
+    auto thermo = sol->thermo();
+    auto kin = sol->kinetics();
+    vector<double> X(thermo->nSpecies(), 1.0);
+    vector<double> kf(kin->nReactions());
+    size_t nPlog = 0;
+    size_t nCheb = 0;
+    for (double P : {0.001, 0.1, 10.0, 1000.0, 1.0, 0.01, 1e5}) {
+        for (double T : {500.0, 1500.0}) {
+            thermo->setState_TPX(T, P * OneAtm, X.data());
+            kin->getFwdRateConstants(kf.data());
+            for (size_t i = 0; i < kin->nReactions(); i++) {
+                auto rate = kin->reaction(i)->rate();
+                if (rate->type() == "pressure-dependent-Arrhenius") {
+                    nPlog++;
+                } else if (rate->type() == "Chebyshev") {
+                    nCheb++;
+                } else {
+                    continue;
+                }
+                double expected = rate->eval(T, P * OneAtm);
+                EXPECT_NEAR(kf[i], expected, 1e-13 * std::abs(expected))
+                    << kin->reaction(i)->equation() << " at P = " << P << " atm";
+            }
+        }
+    }
+    EXPECT_GT(nPlog, 0u);
+    EXPECT_GT(nCheb, 0u);
+}
+
+TEST(KineticsFromYaml, ThirdBodyConcentrations)
+{
+    auto sol = newSolution("gri30.yaml", "", "none");
+    auto thermo = sol->thermo();
+    auto kin = sol->kinetics();
+    thermo->setState_TPX(1200, OneAtm, "CH4:1, O2:2, H2O:0.5, CO2:0.3, AR:1, N2:6");
+    vector<double> conc(thermo->nSpecies()), concm(kin->nReactions());
+    thermo->getConcentrations(conc.data());
+    kin->getThirdBodyConcentrations(concm.data());
+    size_t nThirdBody = 0;
+    for (size_t i = 0; i < kin->nReactions(); i++) {
+        auto R = kin->reaction(i);
+        if (!R->usesThirdBody() || R->thirdBody()->name() != "M") {
+            continue;
+        }
+        double expected = 0.0;
+        for (size_t k = 0; k < thermo->nSpecies(); k++) {
+            expected += R->thirdBody()->efficiency(thermo->speciesName(k)) * conc[k];
+        }
+        EXPECT_NEAR(concm[i], expected, 1e-14 * expected) << R->equation();
+        nThirdBody++;
+    }
+    EXPECT_GT(nThirdBody, 20u);
+}
+
+TEST(KineticsFromYaml, InPlaceDerivatives)
+{
+    auto sol = newSolution("gri30.yaml", "", "none");
+    auto thermo = sol->thermo();
+    auto kin = sol->kinetics();
+    vector<double> X(thermo->nSpecies(), 1.0);
+    thermo->setState_TPX(1500, OneAtm, X.data());
+
+    auto compare = [](const Eigen::SparseMatrix<double>& actual,
+                      const Eigen::SparseMatrix<double>& expected)
+    {
+        ASSERT_EQ(actual.rows(), expected.rows());
+        ASSERT_EQ(actual.cols(), expected.cols());
+        Eigen::MatrixXd diff = Eigen::MatrixXd(actual) - Eigen::MatrixXd(expected);
+        double scale = Eigen::MatrixXd(expected).cwiseAbs().maxCoeff();
+        EXPECT_LE(diff.cwiseAbs().maxCoeff(), 1e-12 * scale);
+    };
+
+    Eigen::SparseMatrix<double> ropX, ropC, wdotX, wdotC;
+    for (bool skip : {false, true}) {
+        AnyMap settings;
+        settings["skip-third-bodies"] = skip;
+        kin->setDerivativeSettings(settings);
+        for (double T : {1500.0, 1800.0}) {
+            thermo->setState_TP(T, 2 * OneAtm);
+            kin->getNetRatesOfProgress_ddX(ropX);
+            kin->getNetRatesOfProgress_ddCi(ropC);
+            kin->getNetProductionRates_ddX(wdotX);
+            kin->getNetProductionRates_ddCi(wdotC);
+            compare(ropX, kin->netRatesOfProgress_ddX());
+            compare(ropC, kin->netRatesOfProgress_ddCi());
+            compare(wdotX, kin->netProductionRates_ddX());
+            compare(wdotC, kin->netProductionRates_ddCi());
+        }
+
+        // Values are updated in place for subsequent calls
+        const double* values = wdotC.valuePtr();
+        const int* indices = wdotC.innerIndexPtr();
+        thermo->setState_TP(2000, OneAtm);
+        kin->getNetProductionRates_ddCi(wdotC);
+        EXPECT_EQ(wdotC.valuePtr(), values);
+        EXPECT_EQ(wdotC.innerIndexPtr(), indices);
+        compare(wdotC, kin->netProductionRates_ddCi());
+    }
+
+    // A matrix with a different sparsity pattern is replaced
+    Eigen::SparseMatrix<double> other(3, 3);
+    other.insert(1, 2) = 1.0;
+    kin->getNetProductionRates_ddX(other);
+    compare(other, kin->netProductionRates_ddX());
+}
+
 class ReactionToYaml : public testing::Test
 {
 public:
@@ -276,12 +276,14 @@ class TestKineticsFromReactions:
     def test_coverage_dependence_flags(self):
         surf = ct.Interface("ptcombust.yaml", "Pt_surf")
         surf.TP = 900, ct.one_atm
-        surf.coverages = {"PT(S)": 1}
-        with pytest.raises(NotImplementedError):
-            surf.net_rates_of_progress_ddCi
-        # set skip and try to get jacobian again
+        surf.coverages = {"PT(S)": 0.6, "H(S)": 0.2, "O(S)": 0.2}
+        drop = surf.net_rates_of_progress_ddCi.toarray()
+        # set skip and get jacobian without coverage dependence
         surf.derivative_settings = {"skip-coverage-dependence": True}
-        surf.net_rates_of_progress_ddCi
+        assert surf.derivative_settings["skip-coverage-dependence"]
+        assert not surf.derivative_settings["skip-electrochemistry"]
+        drop_skip = surf.net_rates_of_progress_ddCi.toarray()
+        assert not np.allclose(drop, drop_skip)
 
     def test_electrochemistry_flags(self):
         anode_int = ct.Interface("lithium_ion_battery.yaml", "edge_anode_electrolyte")
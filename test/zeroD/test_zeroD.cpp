@@ -125,6 +125,149 @@ TEST(MoleReactorTestSet, test_mole_reactor_get_state)
     EXPECT_NEAR(reactor.pressure(), OneAtm, tol);
 }
 
+// Compare adjoint sensitivities of the final temperature and water content to
+// those obtained by integrating the forward sensitivity equations. The
+// IdealGasReactor uses a finite difference Jacobian for the adjoint equations, while
+// the IdealGasMoleReactor uses the exact reactor Jacobian.
+TEST(zerodim, adjoint_sensitivities)
+{
+    double T0 = 1000.0;
+    string X0 = "H2:2.0, O2:1.0, AR:7.0";
+    vector<size_t> reactions = {0, 1, 2, 5, 9};
+    vector<string> components = {"temperature", "H2O"};
+    double tEnd = 2e-4;
+
+    // sensitivities of each component with respect to each reaction
+    auto runNetwork = [&](const string& type, const string& method,
+                          vector<vector<double>>& sens) {
+        auto sol = newSolution("h2o2.yaml");
+        sol->thermo()->setState_TPX(T0, OneAtm, X0);
+        auto reactor = std::dynamic_pointer_cast<Reactor>(newReactor(type, sol));
+        ReactorNet network;
+        network.addReactor(*reactor);
+        for (size_t i : reactions) {
+            reactor->addSensitivityReaction(i);
+        }
+        network.setTolerances(1e-10, 1e-16);
+        network.setSensitivityTolerances(1e-8, 1e-10);
+        network.setSensitivityMethod(method);
+        network.advance(tEnd);
+        double T = reactor->temperature();
+        sens.clear();
+        if (method == "forward") {
+            for (auto& name : components) {
+                sens.emplace_back(network.nparams());
+                for (size_t p = 0; p < network.nparams(); p++) {
+                    sens.back()[p] = network.sensitivity(name, p);
+                }
+            }
+            return;
+        }
+        EXPECT_THROW(network.sensitivity("temperature", 0), CanteraError);
+        // Evaluate several objectives from the same forward solution
+        for (auto& name : components) {
+            vector<double> dgdy(network.neq(), 0.0);
+            size_t k = network.globalComponentIndex(name);
+            dgdy[k] = 1.0;
+            vector<double> y(network.neq());
+            network.getState(y.data());
+            sens.push_back(network.adjointSensitivities(dgdy));
+            for (auto& s : sens.back()) {
+                s /= y[k];
+            }
+            EXPECT_NEAR(reactor->temperature(), T, 1e-10 * T);
+        }
+        // The forward integration can be continued afterwards
+        network.advance(2 * tEnd);
+        EXPECT_DOUBLE_EQ(network.time(), 2 * tEnd);
+        EXPECT_GT(reactor->temperature(), T);
+    };
+
+    for (string type : {"IdealGasReactor", "IdealGasMoleReactor"}) {
+        vector<vector<double>> forward, adjoint;
+        runNetwork(type, "forward", forward);
+        runNetwork(type, "adjoint", adjoint);
+        ASSERT_EQ(adjoint.size(), components.size());
+        for (size_t m = 0; m < components.size(); m++) {
+            ASSERT_EQ(adjoint[m].size(), reactions.size());
+            double scale = 0.0;
+            for (double s : forward[m]) {
+                scale = std::max(scale, std::abs(s));
+            }
+            ASSERT_GT(scale, 0.0);
+            for (size_t p = 0; p < reactions.size(); p++) {
+                EXPECT_NEAR(adjoint[m][p], forward[m][p], 1e-3 * scale)
+                    << type << ", " << components[m] << ", parameter " << p;
+            }
+        }
+    }
+
+    ReactorNet network;
+    EXPECT_THROW(network.setSensitivityMethod("backward"), CanteraError);
+    EXPECT_THROW(network.adjointSensitivities({}), CanteraError);
+}
+
+// The Jacobian of a closed IdealGasMoleReactor without pressure-dependent rates is
+// exact, and can be used for the adjoint equations
+TEST(zerodim, mole_reactor_exact_jacobian)
+{
+    auto sol = newSolution("h2o2.yaml");
+    sol->thermo()->setState_TPX(1200.0, OneAtm,
+        "H2:2.0, O2:1.0, H:0.01, O:0.01, OH:0.02, H2O:0.1, HO2:0.001, H2O2:0.001, "
+        "AR:7.0, N2:0.5");
+    IdealGasMoleReactor reactor(sol);
+    reactor.initialize();
+    EXPECT_FALSE(IdealGasReactor(sol).jacobianIsExact());
+    ASSERT_TRUE(reactor.jacobianIsExact());
+    Eigen::SparseMatrix<double> jac = reactor.jacobian();
+
+    // Compare with central differences, excluding the volume column which is
+    // omitted by jacobian()
+    size_t n = reactor.neq();
+    vector<double> y0(n), y(n), ydotPlus(n), ydotMinus(n);
+    reactor.getState(y0.data());
+    auto evalYdot = [&](vector<double>& ydot) {
+        vector<double> lhs(n, 1.0), rhs(n, 0.0);
+        reactor.updateState(y.data());
+        reactor.eval(0.0, lhs.data(), rhs.data());
+        for (size_t i = 0; i < n; i++) {
+            ydot[i] = rhs[i] / lhs[i];
+        }
+    };
+    for (size_t j = 0; j < n; j++) {
+        if (j == 1) {
+            continue;
+        }
+        double dy = 1e-6 * y0[j];
+        y = y0;
+        y[j] += dy;
+        evalYdot(ydotPlus);
+        y[j] -= 2 * dy;
+        evalYdot(ydotMinus);
+        double scale = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            scale = std::max(scale, std::abs(ydotPlus[i] - ydotMinus[i]) / (2 * dy));
+        }
+        for (size_t i = 0; i < n; i++) {
+            EXPECT_NEAR(jac.coeff(i, j), (ydotPlus[i] - ydotMinus[i]) / (2 * dy),
+                        1e-5 * scale) << "element (" << i << ", " << j << ")";
+        }
+    }
+    reactor.updateState(y0.data());
+
+    AnyMap settings;
+    settings["skip-third-bodies"] = true;
+    reactor.setDerivativeSettings(settings);
+    EXPECT_FALSE(reactor.jacobianIsExact());
+
+    auto sol2 = newSolution("h2o2.yaml");
+    IdealGasMoleReactor reactor2(sol2);
+    Reservoir env(sol2);
+    Wall wall;
+    wall.install(reactor2, env);
+    EXPECT_FALSE(reactor2.jacobianIsExact());
+}
+
 TEST(AdaptivePreconditionerTests, test_adaptive_precon_utils)
 {
     // setting the tolerance